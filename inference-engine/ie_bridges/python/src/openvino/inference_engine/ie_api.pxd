@@ -25,6 +25,8 @@ cdef class InferRequest:
     cpdef async_infer(self, inputs = ?)
     cpdef wait(self, timeout = ?)
     cpdef get_perf_counts(self)
+    cdef object _py_callback
+    cdef dict _bound_inputs
     cdef public:
         _inputs_list, _outputs_list
 
@@ -8,9 +8,9 @@ from libcpp.pair cimport pair
 from libcpp.map cimport map
 from libcpp.memory cimport unique_ptr
 from libc.stdint cimport int64_t
+from cpython.ref cimport Py_INCREF, Py_DECREF
 import os
 import numpy as np
-from copy import deepcopy
 import warnings
 from collections import OrderedDict
 
@@ -144,7 +144,8 @@ cdef class ExecutableNetwork:
     def infer(self, inputs=None):
         current_request = self.requests[0]
         current_request.infer(inputs)
-        return deepcopy(current_request.outputs)
+        # views of the output blobs, they are overwritten by the next inference of the first request
+        return current_request.outputs
 
     def start_async(self, request_id, inputs=None):
         if request_id not in list(range(len(self.requests))):
@@ -155,19 +156,29 @@ cdef class ExecutableNetwork:
 
     @property
     def requests(self):
-        requests = []
-        for i in range(deref(self.impl).infer_requests.size()):
-            infer_request = InferRequest()
-            infer_request.impl = &(deref(self.impl).infer_requests[i])
-            infer_request._inputs_list = self.inputs
-            infer_request._outputs_list = self.outputs
-            requests.append(infer_request)
-        return requests
+        # the same objects are returned every time, they keep the bound inputs and the callbacks of the requests
+        if not self._requests:
+            for i in range(deref(self.impl).infer_requests.size()):
+                infer_request = InferRequest()
+                infer_request.impl = &(deref(self.impl).infer_requests[i])
+                infer_request._inputs_list = self.inputs
+                infer_request._outputs_list = self.outputs
+                self._requests.append(infer_request)
+        return self._requests
+
+cdef void c_callback(void *args, int status) noexcept with gil:
+    cdef InferRequest request = <InferRequest> args
+    # the reference taken by async_infer for the posted callback, the local variable keeps the request alive
+    Py_DECREF(request)
+    callback, userdata = request._py_callback
+    callback(status, userdata)
 
 cdef class InferRequest:
     def __init__(self):
         self._inputs_list = []
         self._outputs_list = []
+        self._py_callback = None
+        self._bound_inputs = {}
 
     cpdef BlobBuffer _get_blob_buffer(self, const string & blob_name):
         cdef BlobBuffer buffer = BlobBuffer()
@@ -180,18 +191,63 @@ cdef class InferRequest:
         if inputs is not None:
             self._fill_inputs(inputs)
 
-        deref(self.impl).infer()
+        cdef C.InferRequestWrap *impl = self.impl
+        with nogil:
+            impl.infer()
 
     cpdef async_infer(self, inputs=None):
         if inputs is not None:
             self._fill_inputs(inputs)
 
-        deref(self.impl).infer_async()
+        cdef C.InferRequestWrap *impl = self.impl
+        cdef C.cy_callback callback = NULL
+        cdef void *args = NULL
+        if self._py_callback is not None:
+            # the request must outlive the callback posted by the inference, c_callback releases the reference
+            Py_INCREF(self)
+            callback = c_callback
+            args = <void *> self
+        try:
+            with nogil:
+                impl.infer_async(callback, args)
+        except:
+            # the inference is not started, so the callback is not posted
+            if callback != NULL:
+                Py_DECREF(self)
+            raise
 
     cpdef wait(self, timeout=None):
         if timeout is None:
             timeout = -1
-        return deref(self.impl).wait(<int64_t> timeout)
+        cdef C.InferRequestWrap *impl = self.impl
+        cdef int64_t c_timeout = timeout
+        cdef int status
+        with nogil:
+            status = impl.wait(c_timeout)
+        return status
+
+    def bind_input(self, name, array):
+        """Makes the input use the memory of the numpy array, so the input data is not copied.
+        The array must be C-contiguous and match the shape and the precision of the input.
+        The request keeps a reference to the array until another array is bound to the input,
+        the array must not be modified while an inference of the request is running."""
+        if name not in self._inputs_list:
+            raise ValueError("No input with name {} found in network".format(name))
+        expected = self._get_blob_buffer(name.encode()).to_numpy()
+        if not isinstance(array, np.ndarray) or not array.flags['C_CONTIGUOUS']:
+            raise ValueError("Only C-contiguous numpy arrays can be bound to the input {}".format(name))
+        if array.dtype != expected.dtype or array.shape != expected.shape:
+            raise ValueError("Array of {} {} doesn't match the input {} of {} {}".format(
+                array.dtype, array.shape, name, expected.dtype, expected.shape))
+        cdef size_t data = array.ctypes.data
+        deref(self.impl).setBlobBuffer(name.encode(), <void *> data, array.nbytes)
+        self._bound_inputs[name] = array
+
+    def set_completion_callback(self, py_callback, py_data=None):
+        """Sets a function called as py_callback(status, py_data) when an asynchronous inference is finished.
+        The callbacks are called in a separate thread, not in the thread of the inference.
+        The callback is used by the inferences started after this call."""
+        self._py_callback = (py_callback, py_data)
 
     cpdef get_perf_counts(self):
         cdef map[string, C.ProfileInfo] c_profile = deref(self.impl).getPerformanceCounts()
@@ -213,10 +269,12 @@ cdef class InferRequest:
 
     @property
     def outputs(self):
+        """Views of the output blobs, they stay valid while the request exists
+        and are overwritten by the next inference of the request."""
         outputs = {}
         for output in self._outputs_list:
             outputs[output] = self._get_blob_buffer(output.encode()).to_numpy()
-        return deepcopy(outputs)
+        return outputs
 
     @property
     def latency(self):
@@ -230,7 +288,7 @@ cdef class InferRequest:
     def _fill_inputs(self, inputs):
         for k, v in inputs.items():
             assert k in self._inputs_list, "No input with name {} found in network".format(k)
-            self.inputs[k][:] = v
+            self._get_blob_buffer(k.encode()).to_numpy()[:] = v
 
 
 class LayerStats:
@@ -385,7 +443,7 @@ cdef class IEPlugin:
         lib_location = os.path.dirname(os.path.realpath(__file__))
         plugin_dirs.append(lib_location)
 
-        cpdef string device_ = <string> device.encode()
+        cdef string device_ = <string> device.encode()
         cdef vector[string] dirs_
         for d in plugin_dirs:
             dirs_.push_back(<string> d.encode())
@@ -17,6 +17,12 @@
 #include "ie_iinfer_request.hpp"
 #include "details/ie_cnn_network_tools.h"
 
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
 std::map<std::string, InferenceEngine::Precision> precision_map = {{"FP32", InferenceEngine::Precision::FP32},
                                                                    {"FP16", InferenceEngine::Precision::FP16},
                                                                    {"Q78",  InferenceEngine::Precision::Q78},
@@ -339,16 +345,119 @@ void InferenceEnginePython::InferRequestWrap::setBatch(int size) {
     IE_CHECK_CALL(request_ptr->SetBatch(size, &response));
 }
 
-void latency_callback(InferenceEngine::IInferRequest::Ptr request, InferenceEngine::StatusCode code){
-    if (code != InferenceEngine::StatusCode::OK) {
-        THROW_IE_EXCEPTION << "Async Infer Request failed with status code " << code;
+void InferenceEnginePython::InferRequestWrap::setBlobBuffer(const std::string &blob_name, void *data, size_t byte_size) {
+    InferenceEngine::ResponseDesc response;
+    InferenceEngine::Blob::Ptr current;
+    IE_CHECK_CALL(request_ptr->GetBlob(blob_name.c_str(), current, &response));
+    if (current->byteSize() != byte_size) {
+        THROW_IE_EXCEPTION << "Buffer of " << byte_size << " bytes doesn't match the size of blob " << blob_name
+                           << " (" << current->byteSize() << " bytes)";
+    }
+
+    // the blob refers to the memory of the buffer, the caller keeps the buffer alive while the blob is set
+    InferenceEngine::TensorDesc desc = current->getTensorDesc();
+    InferenceEngine::Blob::Ptr blob;
+    switch (desc.getPrecision()) {
+        case InferenceEngine::Precision::FP32:
+            blob = InferenceEngine::make_shared_blob<float>(desc, static_cast<float *>(data));
+            break;
+        case InferenceEngine::Precision::FP16:
+        case InferenceEngine::Precision::Q78:
+        case InferenceEngine::Precision::I16:
+            blob = InferenceEngine::make_shared_blob<int16_t>(desc, static_cast<int16_t *>(data));
+            break;
+        case InferenceEngine::Precision::U16:
+            blob = InferenceEngine::make_shared_blob<uint16_t>(desc, static_cast<uint16_t *>(data));
+            break;
+        case InferenceEngine::Precision::U8:
+            blob = InferenceEngine::make_shared_blob<uint8_t>(desc, static_cast<uint8_t *>(data));
+            break;
+        case InferenceEngine::Precision::I8:
+            blob = InferenceEngine::make_shared_blob<int8_t>(desc, static_cast<int8_t *>(data));
+            break;
+        case InferenceEngine::Precision::I32:
+            blob = InferenceEngine::make_shared_blob<int32_t>(desc, static_cast<int32_t *>(data));
+            break;
+        default:
+            THROW_IE_EXCEPTION << "Unsupported precision " << desc.getPrecision() << " of blob " << blob_name;
+    }
+    IE_CHECK_CALL(request_ptr->SetBlob(blob_name.c_str(), blob, &response));
+}
+
+namespace {
+/**
+ * Runs user callbacks in a dedicated thread, so infer threads don't wait for the GIL
+ */
+class CallbackDispatcher {
+public:
+    static CallbackDispatcher &instance() {
+        static CallbackDispatcher dispatcher;
+        return dispatcher;
+    }
+
+    void post(std::function<void()> callback) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            queue.push_back(std::move(callback));
+        }
+        cond_var.notify_one();
+    }
+
+private:
+    CallbackDispatcher() : stopped(false), worker([this] { run(); }) {}
+
+    ~CallbackDispatcher() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopped = true;
+        }
+        cond_var.notify_one();
+        worker.join();
     }
+
+    void run() {
+        while (true) {
+            std::function<void()> callback;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cond_var.wait(lock, [this] { return stopped || !queue.empty(); });
+                // pending callbacks are dropped on exit, the interpreter may be finalized already
+                if (stopped)
+                    return;
+                callback = std::move(queue.front());
+                queue.pop_front();
+            }
+            callback();
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable cond_var;
+    std::deque<std::function<void()>> queue;
+    bool stopped;
+    std::thread worker;
+};
+}  // namespace
+
+void latency_callback(InferenceEngine::IInferRequest::Ptr request, InferenceEngine::StatusCode code){
     InferenceEnginePython::InferRequestWrap *requestWrap;
     InferenceEngine::ResponseDesc dsc;
     request->GetUserData(reinterpret_cast<void**>(&requestWrap), &dsc);
     auto end_time = Time::now();
     auto execTime = std::chrono::duration_cast<ns>(end_time - requestWrap->start_time);
     requestWrap->exec_time = static_cast<double>(execTime.count()) * 0.000001;
+
+    // the callback is taken by the completion, so it is posted exactly once per started inference
+    auto callback = requestWrap->user_callback;
+    auto args = requestWrap->user_args;
+    requestWrap->user_callback = nullptr;
+    requestWrap->user_args = nullptr;
+    if (callback) {
+        CallbackDispatcher::instance().post([callback, args, code] { callback(args, static_cast<int>(code)); });
+    }
+    if (code != InferenceEngine::StatusCode::OK) {
+        THROW_IE_EXCEPTION << "Async Infer Request failed with status code " << code;
+    }
 }
 
 void InferenceEnginePython::InferRequestWrap::infer() {
@@ -361,12 +470,21 @@ void InferenceEnginePython::InferRequestWrap::infer() {
 }
 
 
-void InferenceEnginePython::InferRequestWrap::infer_async() {
+void InferenceEnginePython::InferRequestWrap::infer_async(cy_callback callback, void *args) {
     InferenceEngine::ResponseDesc response;
     start_time = Time::now();
+    // fails while the previous inference is running, so its callback is not replaced
     IE_CHECK_CALL(request_ptr->SetUserData(this, &response));
     request_ptr->SetCompletionCallback(latency_callback);
-    IE_CHECK_CALL(request_ptr->StartAsync(&response));
+    user_callback = callback;
+    user_args = args;
+    InferenceEngine::StatusCode code = request_ptr->StartAsync(&response);
+    if (code != InferenceEngine::StatusCode::OK) {
+        // the completion is not called, the caller releases the arguments of the callback
+        user_callback = nullptr;
+        user_args = nullptr;
+        THROW_IE_EXCEPTION << response.msg;
+    }
 }
 
 int InferenceEnginePython::InferRequestWrap::wait(int64_t timeout) {
@@ -114,18 +114,26 @@ struct IENetwork {
     IENetwork() = default;
 };
 
+typedef void (*cy_callback)(void *args, int status);
+
 struct InferRequestWrap {
     InferenceEngine::IInferRequest::Ptr request_ptr;
     Time::time_point start_time;
     double exec_time;
+    // callback of the running asynchronous inference, it is posted once by the completion of the inference
+    cy_callback user_callback = nullptr;
+    void *user_args = nullptr;
+
     void infer();
 
-    void infer_async();
+    void infer_async(cy_callback callback = nullptr, void *args = nullptr);
 
     int  wait(int64_t timeout);
 
     void getBlobPtr(const std::string &blob_name, InferenceEngine::Blob::Ptr &blob_ptr);
 
+    void setBlobBuffer(const std::string &blob_name, void *data, size_t byte_size);
+
     void setBatch(int size);
 
     std::map<std::string, InferenceEnginePython::ProfileInfo> getPerformanceCounts();
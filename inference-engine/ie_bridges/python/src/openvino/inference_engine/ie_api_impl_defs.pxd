@@ -26,6 +26,8 @@ cdef extern from "<inference_engine.hpp>" namespace "InferenceEngine":
 
 
 cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
+    ctypedef void (*cy_callback) (void*, int)
+
     cdef cppclass IENetLayer:
         string name
         string type
@@ -102,10 +104,11 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
     cdef cppclass InferRequestWrap:
         double exec_time;
         void getBlobPtr(const string &blob_name, Blob.Ptr &blob_ptr) except +
+        void setBlobBuffer(const string &blob_name, void *data, size_t byte_size) except +
         map[string, ProfileInfo] getPerformanceCounts() except +
-        void infer() except +
-        void infer_async() except +
-        int wait(int64_t timeout) except +
+        void infer() nogil except +
+        void infer_async(cy_callback callback, void *args) nogil except +
+        int wait(int64_t timeout) nogil except +
         void setBatch(int size) except +
 
     cdef T*get_buffer[T](Blob &)
@@ -0,0 +1,175 @@
+"""
+Tests of the inference path of the Python API: bound inputs, completion callbacks and output views.
+The built openvino module must be in PYTHONPATH and the Inference Engine libraries in LD_LIBRARY_PATH:
+    python3 -m unittest discover -s tests
+"""
+import os
+import shutil
+import sys
+import tempfile
+import threading
+import time
+import unittest
+
+import numpy as np
+
+from openvino.inference_engine import IENetwork, IEPlugin
+
+# the network computes 2 * data + 1, it has no weights
+MODEL = """<?xml version="1.0" ?>
+<net batch="1" name="power" version="2">
+    <layers>
+        <layer id="0" name="data" precision="FP32" type="Input">
+            <output>
+                <port id="0"><dim>1</dim><dim>3</dim><dim>2</dim><dim>2</dim></port>
+            </output>
+        </layer>
+        <layer id="1" name="power" precision="FP32" type="Power">
+            <data power="1" scale="2" shift="1"/>
+            <input>
+                <port id="0"><dim>1</dim><dim>3</dim><dim>2</dim><dim>2</dim></port>
+            </input>
+            <output>
+                <port id="1"><dim>1</dim><dim>3</dim><dim>2</dim><dim>2</dim></port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+</net>
+"""
+
+SHAPE = (1, 3, 2, 2)
+TIMEOUT = 10
+
+
+class InferRequestTests(unittest.TestCase):
+    @classmethod
+    def setUpClass(cls):
+        cls.model_dir = tempfile.mkdtemp()
+        cls.xml = os.path.join(cls.model_dir, "power.xml")
+        cls.bin = os.path.join(cls.model_dir, "power.bin")
+        with open(cls.xml, "w") as f:
+            f.write(MODEL)
+        open(cls.bin, "wb").close()
+        cls.plugin = IEPlugin(device=os.environ.get("IE_TEST_DEVICE", "CPU"))
+
+    @classmethod
+    def tearDownClass(cls):
+        shutil.rmtree(cls.model_dir)
+
+    def setUp(self):
+        self.exec_net = self.plugin.load(network=IENetwork(model=self.xml, weights=self.bin), num_requests=2)
+
+    @staticmethod
+    def data(value):
+        return np.arange(np.prod(SHAPE), dtype=np.float32).reshape(SHAPE) + value
+
+    @staticmethod
+    def wait_for_refcount(obj, refs):
+        # the callback thread holds the object until the callback returns
+        deadline = time.time() + TIMEOUT
+        while sys.getrefcount(obj) != refs and time.time() < deadline:
+            time.sleep(0.01)
+        return sys.getrefcount(obj)
+
+    def test_requests_are_the_same_objects(self):
+        self.assertIs(self.exec_net.requests[1], self.exec_net.requests[1])
+
+    def test_bind_input_uses_memory_of_array(self):
+        request = self.exec_net.requests[0]
+        array = self.data(0)
+        request.bind_input("data", array)
+        request.infer()
+        np.testing.assert_array_equal(request.outputs["power"], array * 2 + 1)
+        # the array is not copied, so its changes are seen by the next inference
+        array[:] = self.data(5)
+        request.infer()
+        np.testing.assert_array_equal(request.outputs["power"], array * 2 + 1)
+
+    def test_bind_input_keeps_array_alive(self):
+        request = self.exec_net.requests[0]
+        array = self.data(1)
+        refs = sys.getrefcount(array)
+        request.bind_input("data", array)
+        self.assertEqual(refs + 1, sys.getrefcount(array))
+        del array
+        request.infer()
+        np.testing.assert_array_equal(request.outputs["power"], self.data(1) * 2 + 1)
+
+    def test_bind_input_rejects_mismatching_arrays(self):
+        request = self.exec_net.requests[0]
+        with self.assertRaises(ValueError):
+            request.bind_input("data", self.data(0).astype(np.float64))
+        with self.assertRaises(ValueError):
+            request.bind_input("data", self.data(0).reshape(1, 3, 4))
+        with self.assertRaises(ValueError):
+            request.bind_input("data", np.asfortranarray(self.data(0)))
+        with self.assertRaises(ValueError):
+            request.bind_input("unknown", self.data(0))
+
+    def test_completion_callback_is_called_with_user_data(self):
+        request = self.exec_net.requests[1]
+        done = threading.Event()
+        calls = []
+
+        def callback(status, user_data):
+            calls.append((status, user_data, threading.current_thread()))
+            done.set()
+
+        request.set_completion_callback(callback, "user data")
+        refs = sys.getrefcount(request)
+        request.async_infer({"data": self.data(2)})
+        self.assertEqual(0, request.wait())
+        self.assertTrue(done.wait(TIMEOUT))
+        self.assertEqual(1, len(calls))
+        self.assertEqual(0, calls[0][0])
+        self.assertEqual("user data", calls[0][1])
+        self.assertIsNot(threading.current_thread(), calls[0][2])
+        np.testing.assert_array_equal(request.outputs["power"], self.data(2) * 2 + 1)
+        # the reference taken for the posted callback is released by it
+        self.assertEqual(refs, self.wait_for_refcount(request, refs))
+
+    def test_completion_callback_outlives_network(self):
+        request = self.exec_net.requests[0]
+        done = threading.Event()
+        request.set_completion_callback(lambda status, user_data: done.set())
+        request.async_infer({"data": self.data(3)})
+        # the callback may still be queued when the network and the request objects are released
+        del request
+        self.exec_net = None
+        self.assertTrue(done.wait(TIMEOUT))
+
+    def test_completion_callback_is_called_once_per_inference(self):
+        request = self.exec_net.requests[0]
+        semaphore = threading.Semaphore(0)
+        request.set_completion_callback(lambda status, user_data: semaphore.release())
+        for i in range(10):
+            request.async_infer({"data": self.data(i)})
+            request.wait()
+        for i in range(10):
+            self.assertTrue(semaphore.acquire(timeout=TIMEOUT))
+        self.assertFalse(semaphore.acquire(timeout=0.1))
+
+    def test_outputs_are_views_of_output_blobs(self):
+        request = self.exec_net.requests[0]
+        request.infer({"data": self.data(0)})
+        outputs = request.outputs
+        request.infer({"data": self.data(1)})
+        # the views are overwritten by the next inference of the request
+        np.testing.assert_array_equal(outputs["power"], self.data(1) * 2 + 1)
+
+    def test_executable_network_infer_returns_views_of_first_request(self):
+        first = self.exec_net.infer({"data": self.data(0)})
+        saved = first["power"].copy()
+        second = self.exec_net.infer({"data": self.data(1)})
+        np.testing.assert_array_equal(saved, self.data(0) * 2 + 1)
+        np.testing.assert_array_equal(second["power"], self.data(1) * 2 + 1)
+        # the result of the previous call is overwritten, a copy must be taken to keep it
+        np.testing.assert_array_equal(first["power"], second["power"])
+        self.assertTrue(np.shares_memory(first["power"], self.exec_net.requests[0].outputs["power"]))
+
+
+if __name__ == "__main__":
+    unittest.main()
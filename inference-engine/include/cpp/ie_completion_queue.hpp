@@ -0,0 +1,190 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file that provides the CompletionQueue class delivering completed asynchronous inferences
+ * @file ie_completion_queue.hpp
+ */
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "cpp/ie_infer_request.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief A queue of completed asynchronous inferences. The requests of any networks and plugins are started
+ * through the queue, and a few threads take the completed ones from it instead of waiting for every request.
+ * The queue takes the completion callback of a request over, the completion is pushed by the callback, so
+ * the executor of the request is held only for a short locked push. The queue keeps the requests started
+ * through it, so they do not have to be kept by the application while they run.
+ */
+class CompletionQueue {
+public:
+    /**
+     * @brief A completed inference: the request, its status and the tag passed to StartAsync
+     */
+    struct Completion {
+        InferRequest request;
+        StatusCode status = OK;
+        void *tag = nullptr;
+    };
+
+    using Ptr = std::shared_ptr<CompletionQueue>;
+
+    CompletionQueue() : state(std::make_shared<State>()) {}
+
+    CompletionQueue(const CompletionQueue &) = delete;
+
+    CompletionQueue &operator=(const CompletionQueue &) = delete;
+
+    /**
+     * @brief Shuts the queue down and waits until the started inferences are completed
+     */
+    ~CompletionQueue() {
+        Shutdown();
+        std::vector<InferRequest> requests;
+        {
+            std::unique_lock<std::mutex> lock(state->mutex);
+            state->idle.wait(lock, [this] { return state->inFlight == 0; });
+            for (auto &started : state->started)
+                requests.push_back(started.second.request);
+        }
+        // a callback holds the state until it returns, so it could be the last owner of the state and release
+        // the requests kept by the queue on the thread running them; the requests are waited for to return first
+        for (auto &request : requests)
+            request.Wait(IInferRequest::WaitMode::RESULT_READY);
+    }
+
+    /**
+     * @brief Starts the asynchronous inference of the request, its completion is delivered by the queue
+     * @param request the request to start, it must not be busy
+     * @param tag a value identifying the inference for the application, it is returned with the completion
+     */
+    void StartAsync(InferRequest &request, void *tag = nullptr) {
+        IInferRequest::Ptr &actual = request;
+        void *userData = nullptr;
+        ResponseDesc resp;
+        actual->GetUserData(&userData, &resp);
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            auto &started = state->started[actual.get()];
+            // the callback is set once, so it is not replaced while the previous completion is being pushed
+            if (started.callback == nullptr || started.callback != userData) {
+                std::weak_ptr<State> queueState = state;
+                request.SetCompletionCallback(std::function<void(InferRequest, StatusCode)>(
+                        [queueState](InferRequest completed, StatusCode status) {
+                            if (auto lockedState = queueState.lock())
+                                lockedState->push(completed, status);
+                        }));
+                actual->GetUserData(&started.callback, &resp);
+                // the copy keeps the callback set to the request
+                started.request = request;
+            }
+            started.tag = tag;
+            state->inFlight++;
+        }
+        try {
+            request.StartAsync();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->inFlight--;
+            throw;
+        }
+    }
+
+    /**
+     * @brief Takes the next completed inference, waiting for it if the queue is empty
+     * @param completion the completed inference
+     * @param millis_timeout maximum time to wait in milliseconds, IInferRequest::WaitMode::RESULT_READY waits
+     * until an inference is completed or the queue is shut down
+     * @return false if no inference is completed in time or the queue is shut down and empty
+     */
+    bool Next(Completion &completion, int64_t millis_timeout = IInferRequest::WaitMode::RESULT_READY) {
+        std::unique_lock<std::mutex> lock(state->mutex);
+        auto isReady = [this] { return !state->completed.empty() || state->isShutdown; };
+        if (millis_timeout < 0)
+            state->ready.wait(lock, isReady);
+        else if (!state->ready.wait_for(lock, std::chrono::milliseconds(millis_timeout), isReady))
+            return false;
+        if (state->completed.empty())
+            return false;
+        completion = std::move(state->completed.front());
+        state->completed.pop_front();
+        return true;
+    }
+
+    /**
+     * @brief Takes the next completed inference if there is one, it does not wait
+     */
+    bool TryNext(Completion &completion) {
+        return Next(completion, 0);
+    }
+
+    /**
+     * @brief Returns the number of the started inferences which are not taken from the queue yet
+     */
+    size_t Pending() const {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        return state->inFlight + state->completed.size();
+    }
+
+    /**
+     * @brief Wakes up the waiting threads. The inferences completed before are still taken, then Next returns false,
+     * the inferences completed after are dropped.
+     */
+    void Shutdown() {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->isShutdown = true;
+        state->ready.notify_all();
+    }
+
+private:
+    struct Started {
+        void *callback = nullptr;
+        void *tag = nullptr;
+        InferRequest request;
+    };
+
+    // shared with the callbacks of the requests, which may outlive the queue
+    struct State {
+        mutable std::mutex mutex;
+        std::condition_variable ready;
+        std::condition_variable idle;
+        std::unordered_map<IInferRequest *, Started> started;
+        std::deque<Completion> completed;
+        size_t inFlight = 0;
+        bool isShutdown = false;
+
+        void push(InferRequest &request, StatusCode status) {
+            IInferRequest::Ptr &actual = request;
+            std::lock_guard<std::mutex> lock(mutex);
+            if (inFlight > 0 && --inFlight == 0)
+                idle.notify_all();
+            if (isShutdown)
+                return;
+            Completion completion;
+            completion.request = request;
+            completion.status = status;
+            auto found = started.find(actual.get());
+            if (found != started.end()) {
+                completion.request = found->second.request;
+                completion.tag = found->second.tag;
+            }
+            completed.push_back(std::move(completion));
+            ready.notify_one();
+        }
+    };
+
+    std::shared_ptr<State> state;
+};
+
+}  // namespace InferenceEngine
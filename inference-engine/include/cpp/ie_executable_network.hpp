@@ -14,6 +14,8 @@
 #include <memory>
 #include <algorithm>
 #include "ie_iexecutable_network.hpp"
+#include "ie_isequences.hpp"
+#include "ie_executable_network_metrics.hpp"
 #include "cpp/ie_infer_request.hpp"
 #include "cpp/ie_memory_state.hpp"
 #include "cpp/ie_cnn_network.h"
@@ -139,6 +141,30 @@ public:
         return controller;
     }
 
+    /**
+     *@brief see original function InferenceEngine::ISequenceExecutableNetwork::ReleaseSequence,
+     * NotImplemented is thrown if the plugin has no such interface
+     */
+    void ReleaseSequence(size_t sequenceId) {
+        ResponseDesc resp;
+        auto sequences = dynamic_cast<ISequenceExecutableNetwork *>(actual.get());
+        auto res = sequences ? sequences->ReleaseSequence(sequenceId, &resp) : NOT_IMPLEMENTED;
+        if (res != OK) InferenceEngine::details::extract_exception(res, resp.msg);
+    }
+
+    /**
+     *@brief see original function InferenceEngine::IMetricsExecutableNetwork::GetMetrics,
+     * NotImplemented is thrown if the plugin has no such interface
+     */
+    ExecutableNetworkMetrics GetMetrics(bool reset = false) {
+        ExecutableNetworkMetrics metrics;
+        ResponseDesc resp;
+        auto collector = dynamic_cast<IMetricsExecutableNetwork *>(actual.get());
+        auto res = collector ? collector->GetMetrics(metrics, reset, &resp) : NOT_IMPLEMENTED;
+        if (res != OK) InferenceEngine::details::extract_exception(res, resp.msg);
+        return metrics;
+    }
+
 
     using Ptr = std::shared_ptr<ExecutableNetwork>;
 };
@@ -12,6 +12,7 @@
 #include <string>
 #include <map>
 #include "ie_iinfer_request.hpp"
+#include "ie_isequences.hpp"
 #include "details/ie_exception_conversion.hpp"
 
 namespace InferenceEngine {
@@ -143,6 +144,18 @@ public:
         CALL_STATUS_FNC(SetBatch, batch);
     }
 
+    /**
+    * @brief Binds memory states of the given sequences to the request for all the following inference calls.
+    * The request is queried for ISequenceInferRequest, NotImplemented is thrown if the plugin has no such interface.
+    * @param sequenceIds ids of the sequences to be processed by the request, one per batch item.
+    */
+    void SetSequences(const std::vector<size_t> &sequenceIds) {
+        ResponseDesc resp;
+        auto sequences = dynamic_cast<ISequenceInferRequest *>(actual.get());
+        auto res = sequences ? sequences->SetSequences(sequenceIds, &resp) : NOT_IMPLEMENTED;
+        if (res != OK) InferenceEngine::details::extract_exception(res, resp.msg);
+    }
+
     /**
      * constructs InferRequest from initialised shared_pointer
      * @param actual
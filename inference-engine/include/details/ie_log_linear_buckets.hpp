@@ -0,0 +1,68 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Bucketing of log-linear histograms shared by the collectors of durations
+ * @file ie_log_linear_buckets.hpp
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Buckets of a histogram with a bounded relative error, in the manner of HDR histograms.
+ * Values below 2^(subBucketBits + 1) are counted exactly, the larger ones fall into buckets whose width
+ * doubles every power of two, so every value is kept with the relative error 2^-subBucketBits at most
+ * and the memory of the histogram does not depend on the number of values.
+ * The class keeps no counts, the histograms store them as they need (atomic, narrow, growing).
+ */
+class LogLinearBuckets {
+public:
+    static constexpr size_t count(unsigned subBucketBits) {
+        return static_cast<size_t>(64 - subBucketBits + 1) << subBucketBits;
+    }
+
+    static size_t index(uint64_t value, unsigned subBucketBits) {
+        if (value >> (subBucketBits + 1) == 0)
+            return static_cast<size_t>(value);
+        unsigned msb = subBucketBits + 1;
+        while (msb < 63 && (value >> (msb + 1)) != 0)
+            msb++;
+        // the value is counted by its top subBucketBits + 1 bits
+        unsigned shift = msb - subBucketBits;
+        return (static_cast<size_t>(shift) << subBucketBits) + static_cast<size_t>(value >> shift);
+    }
+
+    static uint64_t highestEquivalent(size_t index, unsigned subBucketBits) {
+        if (index >> (subBucketBits + 1) == 0)
+            return index;
+        unsigned shift = static_cast<unsigned>(index >> subBucketBits) - 1;
+        uint64_t subBucket = index - (static_cast<uint64_t>(shift) << subBucketBits);
+        return ((subBucket + 1) << shift) - 1;
+    }
+
+    /**
+     * @brief Returns the highest value equivalent to the value of the given rank (1-based) limited by max,
+     * so the reported tail is never less than the measured one and never more than the largest value
+     * @param counts Counts of the count(subBucketBits) buckets, any type convertible to uint64_t
+     */
+    template <typename T>
+    static uint64_t valueAtRank(const T *counts, unsigned subBucketBits, uint64_t rank, uint64_t max) {
+        uint64_t seen = 0;
+        for (size_t i = 0; i < count(subBucketBits); i++) {
+            seen += static_cast<uint64_t>(counts[i]);
+            if (seen >= rank)
+                return std::min(highestEquivalent(i, subBucketBits), max);
+        }
+        return max;
+    }
+};
+
+}  // namespace details
+}  // namespace InferenceEngine
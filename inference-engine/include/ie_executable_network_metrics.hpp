@@ -0,0 +1,77 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the ExecutableNetworkMetrics struct and the optional interface reporting it
+ * @file ie_executable_network_metrics.hpp
+ */
+
+#pragma once
+
+#include "ie_common.h"
+#include <cstdint>
+#include <vector>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Distribution of durations measured for the requests, in microseconds.
+ * The percentiles are estimated with the relative error of 1/8 at most.
+ */
+struct DurationMetric {
+    uint64_t count = 0;
+    uint64_t totalUs = 0;
+    uint64_t maxUs = 0;
+    uint64_t p50Us = 0;
+    uint64_t p90Us = 0;
+    uint64_t p99Us = 0;
+};
+
+/**
+ * @brief Counters of an executable network collected since its creation or the last reset.
+ * The counters are always collected, their cost is a few clock readings and atomic increments per request.
+ */
+struct ExecutableNetworkMetrics {
+    // time passed since creation of the network or the last reset
+    uint64_t intervalUs = 0;
+
+    // completed and failed inferences
+    uint64_t requests = 0;
+    uint64_t failedRequests = 0;
+
+    // time from the start of a request until the executor takes it from the queue
+    DurationMetric queueWait;
+    // time of the execution of a request by the executor, including pre-processing and copying of blobs
+    DurationMetric execution;
+    // time of pre-processing (resize) of the input blobs, only the requests having pre-processing are counted
+    DurationMetric preprocessing;
+
+    // bytes copied between the blobs of requests and the network, the blobs used in place are not counted
+    uint64_t inputCopyBytes = 0;
+    uint64_t outputCopyBytes = 0;
+
+    // busy time of every stream, the utilization of a stream is its busy time divided by intervalUs
+    std::vector<uint64_t> streamBusyUs;
+};
+
+/**
+ * @brief An optional interface of an executable network which collects ExecutableNetworkMetrics.
+ * It is not a part of IExecutableNetwork, the network is queried for it with dynamic_cast.
+ */
+class IMetricsExecutableNetwork {
+public:
+    /**
+     * @brief Gets a snapshot of the counters collected by the executable network, see ExecutableNetworkMetrics
+     * @param metrics Reference to the object to fill in
+     * @param reset If true, the counters are reset after the snapshot, so the next one covers a new interval
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: OK (0) for success, NOT_IMPLEMENTED (-2) if the plugin doesn't collect metrics
+     */
+    virtual StatusCode GetMetrics(ExecutableNetworkMetrics &metrics, bool reset, ResponseDesc *resp) noexcept = 0;
+
+protected:
+    virtual ~IMetricsExecutableNetwork() = default;
+};
+
+}  // namespace InferenceEngine
@@ -0,0 +1,57 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the optional interfaces of memory states kept per sequence
+ * @file ie_isequences.hpp
+ */
+
+#pragma once
+
+#include "ie_common.h"
+#include <vector>
+
+namespace InferenceEngine {
+
+/**
+ * @brief An optional interface of an infer request which binds memory states of sequences.
+ * It is not a part of IInferRequest, the request is queried for it with dynamic_cast.
+ * Plugins which don't keep memory states per sequence return NOT_IMPLEMENTED or don't implement it at all.
+ */
+class ISequenceInferRequest {
+public:
+    /**
+    * @brief Binds memory states of the given sequences to the request for all the following inference calls.
+    * A state of each sequence is kept by the executable network and is created on the first use of the sequence id.
+    * The i-th sequence takes the i-th item of the batch, so the number of sequences must not exceed the batch size.
+    * An empty list returns the request to the memory state of the executable network itself.
+    * @param sequenceIds ids of the sequences to be processed by the request
+    * @param resp Optional: a pointer to an already allocated object to contain extra information of a failure (if occurred)
+    * @return Enumeration of the resulted action: OK (0) for success
+    */
+    virtual StatusCode SetSequences(const std::vector<size_t> &sequenceIds, ResponseDesc *resp) noexcept = 0;
+
+protected:
+    virtual ~ISequenceInferRequest() = default;
+};
+
+/**
+ * @brief An optional interface of an executable network which keeps memory states of sequences.
+ * It is not a part of IExecutableNetwork, the network is queried for it with dynamic_cast.
+ */
+class ISequenceExecutableNetwork {
+public:
+    /**
+     * @brief Releases a memory state kept for the sequence, the next use of the sequence id starts a new sequence
+     * @param sequenceId id of the sequence passed to ISequenceInferRequest::SetSequences
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: OK (0) for success, NOT_FOUND (-5) no memory state for given sequence
+     */
+    virtual StatusCode ReleaseSequence(size_t sequenceId, ResponseDesc *resp) noexcept = 0;
+
+protected:
+    virtual ~ISequenceExecutableNetwork() = default;
+};
+
+}  // namespace InferenceEngine
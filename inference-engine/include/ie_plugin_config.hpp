@@ -59,11 +59,54 @@ DECLARE_CONFIG_KEY(CPU_BIND_THREAD);
 *   this is the most portable option if you have no insights into how many cores you target machine will have
 *   (and what is the optimal number of streams)
 * - finally, specifying the positive integer value creates the requested number of streams
+* If threads are bound to cores, every stream is confined to the cores of a single NUMA node,
+* the placements of the streams are printed on load if KEY_LOG_LEVEL is set to LOG_DEBUG
 */
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_AUTO);
 DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS);
 
+/**
+* @brief The names for setting the sharing of the CPU streams by the executable networks of the process.
+* - KEY_CPU_SHARED_STREAMS runs the requests of the network on the streams shared by the networks loaded with the key,
+*   should be used with values PluginConfigParams::YES or PluginConfigParams::NO. The first network loaded with the key
+*   partitions the cores into its streams (see KEY_CPU_THROUGHPUT_STREAMS and KEY_CPU_THREADS_NUM), the partitions are
+*   kept until the last of the networks is released. Every network keeps KEY_CPU_THROUGHPUT_STREAMS copies of its
+*   intermediate data, so as many of its requests run at once, and an idle stream runs the requests of any network.
+* - KEY_CPU_STREAMS_WEIGHT sets the share of the streams the network gets while the networks compete for them,
+*   should be used with positive integer values, default value is 1.
+* The partitions of the shared streams and the weight of the network are printed on load if KEY_LOG_LEVEL is set
+* to LOG_DEBUG, then the stream taking every request of the network is printed with the reason of its choice
+*/
+DECLARE_CONFIG_KEY(CPU_SHARED_STREAMS);
+DECLARE_CONFIG_KEY(CPU_STREAMS_WEIGHT);
+
+/**
+* @brief The name for setting the per-node parallelism of the CPU plugin.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with non-negative integer values.
+* The value is the minimal estimated work (number of multiply-adds or processed elements) of a node per thread,
+* nodes with less work, e.g. small reorders, eltwises or SoftMax over 1000 values, are run by fewer threads
+* to save the fork/join overhead, while large convolutions still use all threads of the stream.
+* 0 disables the policy, so every node uses all threads of the stream. Default value is 0,
+* the grain has to be tuned for the target hardware, 32768 is a reasonable value to start with.
+*/
+DECLARE_CONFIG_KEY(CPU_PARALLEL_GRAIN);
+
+/**
+* @brief The names for setting the memory allocation options of the CPU plugin,
+* they affect the memory of intermediate data of the graphs and blobs of the infer requests.
+* It is passed to IInferencePlugin::SetConfig(), these options should be used with values:
+* PluginConfigParams::YES or PluginConfigParams::NO
+* - KEY_CPU_MEMORY_POOLING keeps released memory in size classes and reuses it for the next allocations
+* - KEY_CPU_HUGE_PAGES requests 2MB (transparent) huge pages for allocations of 2MB and more
+* - KEY_CPU_NUMA_MEMORY_BINDING places the memory of every stream on the NUMA node of its cores
+*   and keeps a replica of the weights on every node used by the streams,
+*   it has no effect if threads are not bound to cores (see KEY_CPU_BIND_THREAD)
+* The statistics of the allocators are printed on load if KEY_LOG_LEVEL is set to LOG_DEBUG
+*/
+DECLARE_CONFIG_KEY(CPU_MEMORY_POOLING);
+DECLARE_CONFIG_KEY(CPU_HUGE_PAGES);
+DECLARE_CONFIG_KEY(CPU_NUMA_MEMORY_BINDING);
 
 /**
 * @brief The name for setting performance counters option.
@@ -72,6 +115,16 @@ DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS);
 */
 DECLARE_CONFIG_KEY(PERF_COUNT);
 
+/**
+* @brief The name for setting the sampling of the performance counters of the CPU plugin.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with positive integer values.
+* If KEY_PERF_COUNT is enabled, the nodes are measured on 1 of N inferences on average, the inferences are
+* chosen randomly, so the profiling of live traffic costs little and does not follow its periodic patterns.
+* The counters of a node report its average time, the execution graph reports also the minimal time, the 99th
+* percentile and the achieved GFLOP/s. Default value is 1, every inference is measured.
+*/
+DECLARE_CONFIG_KEY(CPU_PERF_COUNT_SAMPLING);
+
 /**
 * @brief The key defines dynamic limit of batch processing.
 * Specified value is applied to all following Infer() calls. Inference Engine processes
@@ -88,6 +141,17 @@ DECLARE_CONFIG_KEY(DYN_BATCH_LIMIT);
 
 DECLARE_CONFIG_KEY(DYN_BATCH_ENABLED);
 
+/**
+* @brief The key enables coalescing of single-item requests into batched inferences.
+* Requests created by the executable network take a single item of the batch and their inferences are
+* gathered into one inference with batch up to DYN_BATCH_LIMIT, requires DYN_BATCH_ENABLED.
+*
+* The paired parameter value should be convertible to integer number. Acceptable values:
+* 0 - Do not coalesce requests (default)
+* >0 - Maximum time in microseconds the first request of a batch waits for the others
+*/
+DECLARE_CONFIG_KEY(DYN_BATCH_COALESCE_TIMEOUT);
+
 /**
 * @brief The key controls threading inside Inference Engine.
 * It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
@@ -128,6 +192,7 @@ DECLARE_CONFIG_KEY(TUNING_FILE);
 * @brief the key for setting desirable log level.
 * This option should be used with values: PluginConfigParams::LOG_NONE (default),
 * PluginConfigParams::LOG_WARNING, PluginConfigParams::LOG_INFO, PluginConfigParams::LOG_DEBUG
+* The CPU plugin prints the facts of the network load which are not layers with LOG_DEBUG to the standard output
 */
 DECLARE_CONFIG_KEY(LOG_LEVEL);
 
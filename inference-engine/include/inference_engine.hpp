@@ -25,6 +25,7 @@
 #include <cpp/ie_cnn_net_reader.h>
 #include <cpp/ie_plugin_cpp.hpp>
 #include <cpp/ie_executable_network.hpp>
+#include <cpp/ie_completion_queue.hpp>
 #include <ie_version.hpp>
 
 namespace InferenceEngine {
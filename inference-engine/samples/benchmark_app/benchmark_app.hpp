@@ -26,7 +26,8 @@ static const char image_message[] = "Required. Path to a folder with images or t
 static const char multi_input_message[] = "Path to multi input file containing.";
 
 /// @brief message for model argument
-static const char model_message[] = "Required. Path to an .xml file with a trained model.";
+static const char model_message[] = "Required. Path to an .xml file with a trained model. " \
+"In the open-loop mode, a comma-separated list of models executed concurrently is accepted.";
 
 /// @brief message for plugin_path argument
 static const char plugin_path_message[] = "Optional. Path to a plugin folder.";
@@ -58,6 +59,24 @@ static const char custom_cldnn_message[] = "Required for GPU custom kernels. Abs
 
 static const char batch_size_message[] = "Optional. Batch size value. If not specified, the batch size value is determined from Intermediate Representation.";
 
+/// @brief message for coalescing of requests
+static const char coalesce_timeout_message[] = "Optional. Enable coalescing of single-image infer requests into batched inferences " \
+"with the given latency budget in microseconds. The batch size of the network is used as the batch limit (CPU only).";
+
+/// @brief message for open-loop arrival rate
+static const char qps_message[] = "Optional. Enable the open-loop mode: requests arrive at the given rate per second for each model " \
+"regardless of their completion, and the queueing and service latency percentiles are reported (async API only).";
+
+/// @brief message for open-loop arrival pattern
+static const char arrival_message[] = "Optional. Arrival pattern of the open-loop mode: \"poisson\" (default value) or \"constant\".";
+
+/// @brief message for open-loop warm-up
+static const char warmup_message[] = "Optional. Duration of the open-loop warm-up in seconds, its requests are not measured. " \
+"Default value is 5.";
+
+/// @brief message for JSON report
+static const char json_report_message[] = "Optional. Path to a .json file where the open-loop latency statistics are stored.";
+
 // @brief message for CPU threads pinning option
 static const char infer_threads_pinning_message[] = "Optional. Enable (\"YES\" is default value) or disable (\"NO\") " \
                                                     "CPU threads pinning for CPU-involved inference.";
@@ -123,6 +142,23 @@ DEFINE_uint32(nthreads, 0, infer_num_threads_message);
 /// Default is 0 (that means don't specify)
 DEFINE_uint32(b, 0, batch_size_message);
 
+/// @brief Latency budget of requests coalescing in microseconds <br>
+/// Default is 0 (that means requests are not coalesced)
+DEFINE_uint32(coalesce_timeout, 0, coalesce_timeout_message);
+
+/// @brief Arrival rate of the open-loop mode <br>
+/// Default is 0 (that means the closed loop over the infer requests)
+DEFINE_double(qps, 0.0, qps_message);
+
+/// @brief Arrival pattern of the open-loop mode
+DEFINE_string(arrival, "poisson", arrival_message);
+
+/// @brief Warm-up of the open-loop mode in seconds
+DEFINE_uint32(warmup, 5, warmup_message);
+
+/// @brief Path to a file where the open-loop statistics are stored
+DEFINE_string(json_report, "", json_report_message);
+
 // @brief Enable plugin messages
 DEFINE_string(pin, "YES", infer_threads_pinning_message);
 
@@ -159,9 +195,15 @@ static void showUsage() {
     std::cout << "    -nireq \"<integer>\"        " << infer_requests_count_message << std::endl;
     std::cout << "    -b \"<integer>\"            " << batch_size_message << std::endl;
     std::cout << "    -stream_output            " << stream_output_message << std::endl;
+    std::cout << std::endl << "  Open-loop options:" << std::endl;
+    std::cout << "    -qps \"<float>\"            " << qps_message << std::endl;
+    std::cout << "    -arrival \"<pattern>\"      " << arrival_message << std::endl;
+    std::cout << "    -warmup \"<integer>\"       " << warmup_message << std::endl;
+    std::cout << "    -json_report \"<path>\"     " << json_report_message << std::endl;
     std::cout << std::endl << "  CPU-specific performance options:" << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
     std::cout << "    -pin \"YES\"/\"NO\"           " << infer_threads_pinning_message << std::endl;
+    std::cout << "    -coalesce_timeout \"<integer>\" " << coalesce_timeout_message << std::endl;
     std::cout << std::endl << "  Statistics dumping options:" << std::endl;
     std::cout << "    -report_type \"<type>\"     " << report_type_message << std::endl;
     std::cout << "    -report_folder            " << report_folder_message << std::endl;
@@ -8,6 +8,7 @@
 #include <map>
 #include <string>
 #include <chrono>
+#include <functional>
 
 #include "inference_engine.hpp"
 
@@ -23,9 +24,16 @@ public:
         _request.SetCompletionCallback(
                 [&]() {
                     _endTime = Time::now();
+                    if (_completionHandler)
+                        _completionHandler();
                 });
     }
 
+    /// @brief Sets a function called after an asynchronous execution is completed, must be set before the execution is started
+    void setCompletionHandler(const std::function<void()> &handler) {
+        _completionHandler = handler;
+    }
+
     void startAsync() {
         _startTime = Time::now();
         _request.StartAsync();
@@ -57,8 +65,17 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    Time::time_point getStartTime() const {
+        return _startTime;
+    }
+
+    Time::time_point getEndTime() const {
+        return _endTime;
+    }
+
 private:
     InferenceEngine::InferRequest _request;
     Time::time_point _startTime;
     Time::time_point _endTime;
+    std::function<void()> _completionHandler;
 };
\ No newline at end of file
@@ -0,0 +1,84 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <details/ie_log_linear_buckets.hpp>
+
+/**
+ * @brief Histogram of latencies in nanoseconds with the relative error 2^-subBucketBits at most,
+ * see InferenceEngine::details::LogLinearBuckets. Histograms of the same precision can be merged.
+ */
+class LatencyHistogram {
+public:
+    explicit LatencyHistogram(unsigned subBucketBits = 7) : _subBucketBits(subBucketBits),
+        _counts(Buckets::count(subBucketBits), 0) {}
+
+    void add(uint64_t value) {
+        _counts[Buckets::index(value, _subBucketBits)]++;
+        if (_total == 0 || value < _min)
+            _min = value;
+        _max = std::max(_max, value);
+        _sum += static_cast<double>(value);
+        _total++;
+    }
+
+    void merge(const LatencyHistogram &other) {
+        if (other._subBucketBits != _subBucketBits) {
+            throw std::logic_error("Histograms of different precision can't be merged");
+        }
+        if (other._total == 0)
+            return;
+        for (size_t i = 0; i < _counts.size(); i++)
+            _counts[i] += other._counts[i];
+        _min = _total == 0 ? other._min : std::min(_min, other._min);
+        _max = std::max(_max, other._max);
+        _sum += other._sum;
+        _total += other._total;
+    }
+
+    uint64_t count() const {
+        return _total;
+    }
+
+    uint64_t min() const {
+        return _min;
+    }
+
+    uint64_t max() const {
+        return _max;
+    }
+
+    double mean() const {
+        return _total == 0 ? 0.0 : _sum / _total;
+    }
+
+    /**
+     * @brief Returns the highest value equivalent to the value at the given percentile (0..100),
+     * so the reported tail latency is never less than the measured one
+     */
+    uint64_t percentile(double p) const {
+        if (_total == 0)
+            return 0;
+        uint64_t rank = static_cast<uint64_t>(p / 100.0 * _total + 0.5);
+        rank = std::min(std::max(rank, uint64_t(1)), _total);
+
+        return std::max(Buckets::valueAtRank(_counts.data(), _subBucketBits, rank, _max), _min);
+    }
+
+private:
+    using Buckets = InferenceEngine::details::LogLinearBuckets;
+
+    unsigned _subBucketBits;
+    std::vector<uint64_t> _counts;
+    uint64_t _total = 0;
+    uint64_t _min = 0;
+    uint64_t _max = 0;
+    double _sum = 0.0;
+};
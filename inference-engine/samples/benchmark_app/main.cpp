@@ -4,8 +4,10 @@
 
 #include <algorithm>
 #include <chrono>
+#include <fstream>
 #include <memory>
 #include <map>
+#include <sstream>
 #include <string>
 #include <vector>
 #include <utility>
@@ -21,6 +23,7 @@
 
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
+#include "open_loop.hpp"
 #include "progress_bar.hpp"
 #include "statistics_report.hpp"
 
@@ -36,6 +39,25 @@ void fillBlobWithImage(
 
 static const size_t progressBarDefaultTotalCount = 1000;
 
+/// @brief Network loaded to the plugin with its infer requests
+struct LoadedNetwork {
+    std::string model;
+    InferenceEngine::ExecutableNetwork exeNetwork;
+    std::vector<InferReqWrap::Ptr> inferRequests;
+    size_t batchSize;
+};
+
+std::vector<std::string> parseList(const std::string& str) {
+    std::vector<std::string> result;
+    std::stringstream stream(str);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty())
+            result.push_back(item);
+    }
+    return result;
+}
+
 bool ParseAndCheckCommandLine(int argc, char *argv[]) {
     // ---------------------------Parsing and validation of input args--------------------------------------
     slog::info << "Parsing input parameters" << slog::endl;
@@ -49,6 +71,10 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("Model required is not set. Please use -h.");
     }
 
+    if (FLAGS_qps < 0.0) {
+        throw std::logic_error("arrival rate must be positive (invalid -qps option value)");
+    }
+
     if (FLAGS_api.empty()) {
         throw std::logic_error("API not selected. Please use -h.");
     }
@@ -68,9 +94,253 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error(err);
     }
 
+    if (FLAGS_coalesce_timeout != 0) {
+        if (FLAGS_d != "CPU") {
+            throw std::logic_error("coalescing of requests is supported only for CPU (invalid -coalesce_timeout option value)");
+        }
+        if (FLAGS_report_type == detailedCntReport || FLAGS_report_type == medianCntReport) {
+            throw std::logic_error("performance counters are not available for coalesced requests "
+                                   "(invalid -report_type option value)");
+        }
+    }
+
+    if (FLAGS_qps != 0.0) {
+        if (FLAGS_api != "async") {
+            throw std::logic_error("open-loop mode is supported only for async API (invalid -api option value)");
+        }
+        if (FLAGS_arrival != poissonArrival && FLAGS_arrival != constantArrival) {
+            throw std::logic_error("only " + std::string(poissonArrival) + "/" + std::string(constantArrival) +
+                                   " arrival patterns are supported (invalid -arrival option value)");
+        }
+        if (!FLAGS_report_type.empty() || !FLAGS_exec_graph_path.empty()) {
+            throw std::logic_error("statistics of the open-loop mode are stored by -json_report only "
+                                   "(invalid -report_type or -exec_graph_path option value)");
+        }
+    } else {
+        if (parseList(FLAGS_m).size() != 1) {
+            throw std::logic_error("several models are executed only in the open-loop mode (invalid -m option value)");
+        }
+        if (!FLAGS_json_report.empty()) {
+            throw std::logic_error("JSON report is stored only in the open-loop mode (invalid -json_report option value)");
+        }
+    }
+
     return true;
 }
 
+/**
+* @brief Reads the model, loads it to the plugin and creates infer requests with the input blobs filled with images
+*/
+LoadedNetwork loadNetwork(InferencePlugin &plugin, const std::string &model, const std::vector<std::string> &inputImages,
+                          ProgressBar &progressBar) {
+    // --------------------------- 2. Read IR Generated by ModelOptimizer (.xml and .bin files) ------------
+
+    std::cout << "[Step 3/8] Read IR network" << std::endl;
+    progressBar.newBar(1);
+
+    slog::info << "Loading network files " << model << slog::endl;
+
+    InferenceEngine::CNNNetReader netBuilder;
+    netBuilder.ReadNetwork(model);
+    const std::string binFileName = fileNameNoExt(model) + ".bin";
+    netBuilder.ReadWeights(binFileName);
+
+    InferenceEngine::CNNNetwork cnnNetwork = netBuilder.getNetwork();
+    const InferenceEngine::InputsDataMap inputInfo(cnnNetwork.getInputsInfo());
+    if (inputInfo.empty()) {
+        throw std::logic_error("no inputs info is provided");
+    }
+
+    if (inputInfo.size() != 1) {
+        throw std::logic_error("only networks with one input are supported");
+    }
+
+    // --------------------------- 3. Resize network to match image sizes and given batch----------------------
+
+    if (FLAGS_b != 0) {
+        // We support models having only one input layers
+        ICNNNetwork::InputShapes shapes = cnnNetwork.getInputShapes();
+        const ICNNNetwork::InputShapes::iterator& it = shapes.begin();
+        if (it->second.size() != 4) {
+            throw std::logic_error("Unsupported model for batch size changing in automatic mode");
+        }
+        it->second[0] = FLAGS_b;
+        slog::info << "Resizing network to batch = " << FLAGS_b << slog::endl;
+        cnnNetwork.reshape(shapes);
+    }
+
+    // with coalescing every request keeps a single image and the network batch is the coalescing limit
+    const bool coalesce = FLAGS_coalesce_timeout != 0;
+    const size_t batchLimit = cnnNetwork.getBatchSize();
+    const size_t batchSize = coalesce ? 1 : batchLimit;
+    if (coalesce && FLAGS_api == "async" && FLAGS_nireq < batchLimit) {
+        slog::warn << "Number of infer requests " << FLAGS_nireq << " is less than the batch limit " << batchLimit <<
+            ", batches will never be full" << slog::endl;
+    }
+    const Precision precision = inputInfo.begin()->second->getPrecision();
+    slog::info << (FLAGS_b != 0 ? "Network batch size was changed to: " : "Network batch size: ") << batchLimit <<
+        ", precision: " << precision << slog::endl;
+
+    progressBar.addProgress(1);
+    progressBar.finish();
+
+    // --------------------------- 4. Configure input & output ---------------------------------------------
+
+    std::cout << "[Step 4/8] Configure input & output of the model" << std::endl;
+    progressBar.newBar(1);
+
+    const InferenceEngine::Precision inputPrecision = InferenceEngine::Precision::U8;
+    for (auto& item : inputInfo) {
+        /** Set the precision of input data provided by the user, should be called before load of the network to the plugin **/
+        item.second->setInputPrecision(inputPrecision);
+    }
+
+    const size_t imagesCount = inputImages.size();
+    if (batchSize > imagesCount) {
+        slog::warn << "Network batch size " << batchSize << " is greater than images count " << imagesCount <<
+            ", some input files will be duplicated" << slog::endl;
+    } else if (batchSize < imagesCount) {
+        slog::warn << "Network batch size " << batchSize << " is less then images count " << imagesCount <<
+            ", some input files will be ignored" << slog::endl;
+    }
+
+    // ------------------------------ Prepare output blobs -------------------------------------------------
+    slog::info << "Preparing output blobs" << slog::endl;
+    InferenceEngine::OutputsDataMap outputInfo(cnnNetwork.getOutputsInfo());
+    InferenceEngine::BlobMap outputBlobs;
+    for (auto& item : outputInfo) {
+        const InferenceEngine::DataPtr outData = item.second;
+        if (!outData) {
+            throw std::logic_error("output data pointer is not valid");
+        }
+        InferenceEngine::SizeVector outputDims = outData->dims;
+        const InferenceEngine::Precision outputPrecision = InferenceEngine::Precision::FP32;
+
+        /** Set the precision of output data provided by the user, should be called before load of the network to the plugin **/
+        outData->setPrecision(outputPrecision);
+        InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        output->allocate();
+        outputBlobs[item.first] = output;
+    }
+
+    progressBar.addProgress(1);
+    progressBar.finish();
+
+    // --------------------------- 5. Loading model to the plugin ------------------------------------------
+
+    std::cout << "[Step 5/8] Loading model to the plugin " << std::endl;
+    progressBar.newBar(1);
+
+    std::map<std::string, std::string> networkConfig;
+    if (FLAGS_d.find("CPU") != std::string::npos) {  // CPU supports few special performance-oriented keys
+        // limit threading for CPU portion of inference
+        if (FLAGS_nthreads != 0)
+            networkConfig[PluginConfigParams::KEY_CPU_THREADS_NUM] = std::to_string(FLAGS_nthreads);
+        // pin threads for CPU portion of inference
+        networkConfig[PluginConfigParams::KEY_CPU_BIND_THREAD] = FLAGS_pin;
+        // for pure CPU execution, more throughput-oriented execution via streams
+        if (coalesce) {
+            // requests are gathered into batches, which are executed by a single stream
+            networkConfig[PluginConfigParams::KEY_DYN_BATCH_ENABLED] = PluginConfigParams::YES;
+            networkConfig[PluginConfigParams::KEY_DYN_BATCH_LIMIT] = std::to_string(batchLimit);
+            networkConfig[PluginConfigParams::KEY_DYN_BATCH_COALESCE_TIMEOUT] = std::to_string(FLAGS_coalesce_timeout);
+        } else if (FLAGS_api == "async" && FLAGS_d == "CPU") {
+            networkConfig[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = std::to_string(FLAGS_nireq);
+        }
+    }
+
+    if (FLAGS_report_type == detailedCntReport || FLAGS_report_type == medianCntReport) {
+        networkConfig[PluginConfigParams::KEY_PERF_COUNT] = PluginConfigParams::YES;
+    }
+
+    InferenceEngine::ExecutableNetwork exeNetwork = plugin.LoadNetwork(cnnNetwork, networkConfig);
+
+    progressBar.addProgress(1);
+    progressBar.finish();
+
+    // --------------------------- 6. Create infer requests and fill input blobs ---------------------------
+
+    std::cout << "[Step 6/8] Create infer requests and fill input blobs with images" << std::endl;
+    progressBar.newBar(1);
+
+    std::vector<InferReqWrap::Ptr> inferRequests;
+    auto numOfReq = (FLAGS_api == "async") ? FLAGS_nireq : 1;
+    inferRequests.reserve(numOfReq);
+
+    for (size_t i = 0; i < numOfReq; i++) {
+        inferRequests.push_back(std::make_shared<InferReqWrap>(exeNetwork));
+        slog::info << "Infer Request " << i << " created" << slog::endl;
+
+        for (const InputsDataMap::value_type& item : inputInfo) {
+            Blob::Ptr inputBlob = inferRequests[i]->getBlob(item.first);
+            fillBlobWithImage(inputBlob, inputImages, batchSize, *item.second);
+        }
+    }
+
+    progressBar.addProgress(1);
+    progressBar.finish();
+
+    return {model, exeNetwork, inferRequests, batchSize};
+}
+
+/**
+* @brief Issues requests to all the networks concurrently at the target rate and reports the latency percentiles
+*/
+void runOpenLoop(const std::vector<LoadedNetwork> &networks, ProgressBar &progressBar) {
+    long long durationInNanoseconds;
+    if (FLAGS_niter != 0) {
+        // the number of iterations is the number of the measured arrivals
+        durationInNanoseconds = static_cast<long long>(FLAGS_niter / FLAGS_qps * 1000000000.0);
+    } else {
+        durationInNanoseconds = getDurationInNanoseconds(FLAGS_d);
+    }
+
+    std::cout << "[Step 7/8] Start inference in the open loop (" << FLAGS_arrival << " arrivals, " << FLAGS_qps <<
+        " requests per second, " << FLAGS_warmup << " s warm-up, " << durationInNanoseconds * 0.000001 << " ms duration, " <<
+        networks.size() << " models, " << FLAGS_nireq << " inference requests per model)" << std::endl;
+    progressBar.newBar(networks.size());
+
+    std::vector<std::unique_ptr<OpenLoopGenerator>> generators;
+    for (size_t i = 0; i < networks.size(); i++) {
+        // every model gets its own arrival stream
+        OpenLoopGenerator::Config config = {
+            FLAGS_qps,
+            FLAGS_arrival,
+            FLAGS_warmup * 1000000000LL,
+            durationInNanoseconds,
+            static_cast<unsigned>(i)
+        };
+        generators.emplace_back(new OpenLoopGenerator(networks[i].model, networks[i].inferRequests, config));
+    }
+    for (auto &generator : generators) {
+        generator->start();
+    }
+    for (auto &generator : generators) {
+        generator->join();
+        progressBar.addProgress(1);
+    }
+    progressBar.finish();
+
+    std::cout << "[Step 8/8] Dump statistics report" << std::endl;
+    for (const auto &generator : generators) {
+        generator->print();
+    }
+
+    if (!FLAGS_json_report.empty()) {
+        std::ofstream out(FLAGS_json_report);
+        if (!out.is_open()) {
+            throw std::logic_error("Can't open " + FLAGS_json_report);
+        }
+        out << "{\"models\": [";
+        for (size_t i = 0; i < generators.size(); i++) {
+            out << (i == 0 ? "" : ", ");
+            generators[i]->dumpJson(out);
+        }
+        out << "]}" << std::endl;
+        slog::info << "statistics report is stored to " << FLAGS_json_report << slog::endl;
+    }
+}
+
 /**
 * @brief The entry point the benchmark application
 */
@@ -131,139 +401,22 @@ int main(int argc, char *argv[]) {
         progressBar.addProgress(1);
         progressBar.finish();
 
-        // --------------------------- 2. Read IR Generated by ModelOptimizer (.xml and .bin files) ------------
-
-        std::cout << "[Step 3/8] Read IR network" << std::endl;
-        progressBar.newBar(1);
-
-        slog::info << "Loading network files" << slog::endl;
-
-        InferenceEngine::CNNNetReader netBuilder;
-        netBuilder.ReadNetwork(FLAGS_m);
-        const std::string binFileName = fileNameNoExt(FLAGS_m) + ".bin";
-        netBuilder.ReadWeights(binFileName);
-
-        InferenceEngine::CNNNetwork cnnNetwork = netBuilder.getNetwork();
-        const InferenceEngine::InputsDataMap inputInfo(cnnNetwork.getInputsInfo());
-        if (inputInfo.empty()) {
-            throw std::logic_error("no inputs info is provided");
-        }
-
-        if (inputInfo.size() != 1) {
-            throw std::logic_error("only networks with one input are supported");
-        }
-
-        // --------------------------- 3. Resize network to match image sizes and given batch----------------------
+        // --------------------------- 2-6. Read, load the networks and create infer requests -------------------
 
-        if (FLAGS_b != 0) {
-            // We support models having only one input layers
-            ICNNNetwork::InputShapes shapes = cnnNetwork.getInputShapes();
-            const ICNNNetwork::InputShapes::iterator& it = shapes.begin();
-            if (it->second.size() != 4) {
-                throw std::logic_error("Unsupported model for batch size changing in automatic mode");
-            }
-            it->second[0] = FLAGS_b;
-            slog::info << "Resizing network to batch = " << FLAGS_b << slog::endl;
-            cnnNetwork.reshape(shapes);
+        // several models are loaded in the open-loop mode only
+        std::vector<LoadedNetwork> networks;
+        for (const auto &model : parseList(FLAGS_m)) {
+            networks.push_back(loadNetwork(plugin, model, inputImages, progressBar));
         }
-
-        const size_t batchSize = cnnNetwork.getBatchSize();
-        const Precision precision = inputInfo.begin()->second->getPrecision();
-        slog::info << (FLAGS_b != 0 ? "Network batch size was changed to: " : "Network batch size: ") << batchSize <<
-            ", precision: " << precision << slog::endl;
-
-        progressBar.addProgress(1);
-        progressBar.finish();
-
-        // --------------------------- 4. Configure input & output ---------------------------------------------
-
-        std::cout << "[Step 4/8] Configure input & output of the model" << std::endl;
-        progressBar.newBar(1);
-
-        const InferenceEngine::Precision inputPrecision = InferenceEngine::Precision::U8;
-        for (auto& item : inputInfo) {
-            /** Set the precision of input data provided by the user, should be called before load of the network to the plugin **/
-            item.second->setInputPrecision(inputPrecision);
-        }
-
-        const size_t imagesCount = inputImages.size();
-        if (batchSize > imagesCount) {
-            slog::warn << "Network batch size " << batchSize << " is greater than images count " << imagesCount <<
-                ", some input files will be duplicated" << slog::endl;
-        } else if (batchSize < imagesCount) {
-            slog::warn << "Network batch size " << batchSize << " is less then images count " << imagesCount <<
-                ", some input files will be ignored" << slog::endl;
-        }
-
-        // ------------------------------ Prepare output blobs -------------------------------------------------
-        slog::info << "Preparing output blobs" << slog::endl;
-        InferenceEngine::OutputsDataMap outputInfo(cnnNetwork.getOutputsInfo());
-        InferenceEngine::BlobMap outputBlobs;
-        for (auto& item : outputInfo) {
-            const InferenceEngine::DataPtr outData = item.second;
-            if (!outData) {
-                throw std::logic_error("output data pointer is not valid");
-            }
-            InferenceEngine::SizeVector outputDims = outData->dims;
-            const InferenceEngine::Precision outputPrecision = InferenceEngine::Precision::FP32;
-
-            /** Set the precision of output data provided by the user, should be called before load of the network to the plugin **/
-            outData->setPrecision(outputPrecision);
-            InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
-            output->allocate();
-            outputBlobs[item.first] = output;
-        }
-
-        progressBar.addProgress(1);
-        progressBar.finish();
-
-        // --------------------------- 5. Loading model to the plugin ------------------------------------------
-
-        std::cout << "[Step 5/8] Loading model to the plugin " << std::endl;
-        progressBar.newBar(1);
-
-        std::map<std::string, std::string> networkConfig;
-        if (FLAGS_d.find("CPU") != std::string::npos) {  // CPU supports few special performance-oriented keys
-            // limit threading for CPU portion of inference
-            if (FLAGS_nthreads != 0)
-                networkConfig[PluginConfigParams::KEY_CPU_THREADS_NUM] = std::to_string(FLAGS_nthreads);
-            // pin threads for CPU portion of inference
-            networkConfig[PluginConfigParams::KEY_CPU_BIND_THREAD] = FLAGS_pin;
-            // for pure CPU execution, more throughput-oriented execution via streams
-            if (FLAGS_api == "async" && FLAGS_d == "CPU")
-                networkConfig[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = std::to_string(FLAGS_nireq);
-        }
-
-        if (FLAGS_report_type == detailedCntReport || FLAGS_report_type == medianCntReport) {
-            networkConfig[PluginConfigParams::KEY_PERF_COUNT] = PluginConfigParams::YES;
-        }
-
-        InferenceEngine::ExecutableNetwork exeNetwork = plugin.LoadNetwork(cnnNetwork, networkConfig);
-
-        progressBar.addProgress(1);
-        progressBar.finish();
-
-        // --------------------------- 6. Create infer requests and fill input blobs ---------------------------
-
-        std::cout << "[Step 6/8] Create infer requests and fill input blobs with images" << std::endl;
-        progressBar.newBar(1);
-
-        std::vector<InferReqWrap::Ptr> inferRequests;
-        auto numOfReq = (FLAGS_api == "async") ? FLAGS_nireq : 1;
-        inferRequests.reserve(numOfReq);
-
-        for (size_t i = 0; i < numOfReq; i++) {
-            inferRequests.push_back(std::make_shared<InferReqWrap>(exeNetwork));
-            slog::info << "Infer Request " << i << " created" << slog::endl;
-
-            for (const InputsDataMap::value_type& item : inputInfo) {
-                Blob::Ptr inputBlob = inferRequests[i]->getBlob(item.first);
-                fillBlobWithImage(inputBlob, inputImages, batchSize, *item.second);
-            }
+        if (FLAGS_qps != 0.0) {
+            runOpenLoop(networks, progressBar);
+            return 0;
         }
 
-        progressBar.addProgress(1);
-        progressBar.finish();
+        LoadedNetwork &network = networks.front();
+        InferenceEngine::ExecutableNetwork &exeNetwork = network.exeNetwork;
+        std::vector<InferReqWrap::Ptr> &inferRequests = network.inferRequests;
+        const size_t batchSize = network.batchSize;
 
         // --------------------------- 7. Performance measurements stuff ------------------------------------------
 
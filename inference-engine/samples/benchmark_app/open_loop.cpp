@@ -0,0 +1,178 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <samples/slog.hpp>
+
+#include "open_loop.hpp"
+
+namespace {
+
+std::string escapeJson(const std::string &str) {
+    std::string escaped;
+    for (char c : str) {
+        if (c == '"' || c == '\\')
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+void dumpLatencies(std::ostream &out, const LatencyHistogram &histogram) {
+    // the histogram keeps nanoseconds, the report is in milliseconds as the other ones of the application
+    auto ms = [](double value) { return value * 0.000001; };
+    out << "{\"p50\": " << ms(histogram.percentile(50.0)) <<
+        ", \"p90\": " << ms(histogram.percentile(90.0)) <<
+        ", \"p99\": " << ms(histogram.percentile(99.0)) <<
+        ", \"p99.9\": " << ms(histogram.percentile(99.9)) <<
+        ", \"max\": " << ms(histogram.max()) <<
+        ", \"mean\": " << ms(histogram.mean()) << "}";
+}
+
+}  // namespace
+
+OpenLoopGenerator::OpenLoopGenerator(const std::string &name, const std::vector<InferReqWrap::Ptr> &requests,
+                                     const Config &config) :
+        _name(name), _requests(requests), _config(config), _random(config.seed), _exponential(config.qps),
+        _arrivals(requests.size()) {
+    if (_config.qps <= 0.0) {
+        throw std::logic_error("Arrival rate of the open-loop mode must be positive");
+    }
+    if (_config.arrival != poissonArrival && _config.arrival != constantArrival) {
+        throw std::logic_error("Unknown arrival pattern " + _config.arrival);
+    }
+
+    for (size_t i = _requests.size(); i > 0; i--) {
+        size_t request = i - 1;
+        _freeRequests.push_back(request);
+        _requests[request]->setCompletionHandler([this, request] {
+            onCompleted(request);
+        });
+    }
+}
+
+OpenLoopGenerator::~OpenLoopGenerator() {
+    if (_thread.joinable())
+        _thread.join();
+}
+
+void OpenLoopGenerator::start() {
+    _thread = std::thread(&OpenLoopGenerator::run, this);
+}
+
+void OpenLoopGenerator::join() {
+    _thread.join();
+}
+
+Time::duration OpenLoopGenerator::nextInterval() {
+    double seconds = _config.arrival == poissonArrival ? _exponential(_random) : 1.0 / _config.qps;
+    return std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(seconds));
+}
+
+void OpenLoopGenerator::run() {
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    const auto begin = Time::now();
+    const auto finish = begin + ns(_config.warmupNs + _config.durationNs);
+    _measureStart = begin + ns(_config.warmupNs);
+
+    auto nextArrival = begin;
+    std::vector<size_t> toStart;
+    while (true) {
+        const auto now = Time::now();
+        while (nextArrival <= now && nextArrival < finish) {
+            _pending.push_back(nextArrival);
+            if (nextArrival >= _measureStart)
+                _arrived++;
+            nextArrival += nextInterval();
+        }
+        _maxQueue = std::max(_maxQueue, _pending.size());
+
+        toStart.clear();
+        while (!_pending.empty() && !_freeRequests.empty()) {
+            size_t request = _freeRequests.back();
+            _freeRequests.pop_back();
+            _arrivals[request] = _pending.front();
+            _pending.pop_front();
+            toStart.push_back(request);
+        }
+        if (!toStart.empty()) {
+            // a request may be completed before StartAsync returns, so its handler must be able to take the lock
+            lock.unlock();
+            for (size_t request : toStart)
+                _requests[request]->startAsync();
+            lock.lock();
+            continue;
+        }
+
+        if (nextArrival >= finish)
+            break;
+        _completed.wait_until(lock, nextArrival);
+    }
+
+    // the requests still waiting are not executed, otherwise an overloaded device would never finish the run
+    _dropped = static_cast<size_t>(std::count_if(_pending.begin(), _pending.end(),
+            [&](const Time::time_point &arrival) { return arrival >= _measureStart; }));
+    _pending.clear();
+    _completed.wait(lock, [&] { return _freeRequests.size() == _requests.size(); });
+}
+
+void OpenLoopGenerator::onCompleted(size_t request) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    const auto arrival = _arrivals[request];
+    if (arrival >= _measureStart) {
+        const auto startTime = _requests[request]->getStartTime();
+        const auto endTime = _requests[request]->getEndTime();
+        _queueing.add(std::chrono::duration_cast<ns>(startTime - arrival).count());
+        _service.add(std::chrono::duration_cast<ns>(endTime - startTime).count());
+        _total.add(std::chrono::duration_cast<ns>(endTime - arrival).count());
+    }
+
+    _freeRequests.push_back(request);
+    _completed.notify_one();
+}
+
+void OpenLoopGenerator::dumpJson(std::ostream &out) const {
+    out << "{\"model\": \"" << escapeJson(_name) << "\"" <<
+        ", \"arrival\": \"" << _config.arrival << "\"" <<
+        ", \"target_qps\": " << _config.qps <<
+        ", \"achieved_qps\": " << _total.count() * 1000000000.0 / _config.durationNs <<
+        ", \"infer_requests\": " << _requests.size() <<
+        ", \"arrived\": " << _arrived <<
+        ", \"completed\": " << _total.count() <<
+        ", \"dropped\": " << _dropped <<
+        ", \"max_queue\": " << _maxQueue <<
+        ", \"queueing_ms\": ";
+    dumpLatencies(out, _queueing);
+    out << ", \"service_ms\": ";
+    dumpLatencies(out, _service);
+    out << ", \"total_ms\": ";
+    dumpLatencies(out, _total);
+    out << "}";
+}
+
+void OpenLoopGenerator::print() const {
+    auto percentiles = [](const LatencyHistogram &histogram) {
+        std::string str;
+        for (double p : {50.0, 90.0, 99.0, 99.9}) {
+            str += std::to_string(histogram.percentile(p) * 0.000001) + " / ";
+        }
+        return str + std::to_string(histogram.max() * 0.000001);
+    };
+
+    slog::info << _name << slog::endl;
+    slog::info << "\tArrived: " << _arrived << ", completed: " << _total.count() << ", dropped: " << _dropped <<
+        ", max queue: " << _maxQueue << slog::endl;
+    slog::info << "\tThroughput: " << _total.count() * 1000000000.0 / _config.durationNs << " of " << _config.qps <<
+        " requests per second" << slog::endl;
+    slog::info << "\tLatency p50 / p90 / p99 / p99.9 / max, ms" << slog::endl;
+    slog::info << "\t\tqueueing: " << percentiles(_queueing) << slog::endl;
+    slog::info << "\t\tservice:  " << percentiles(_service) << slog::endl;
+    slog::info << "\t\ttotal:    " << percentiles(_total) << slog::endl;
+}
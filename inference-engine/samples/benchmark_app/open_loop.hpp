@@ -0,0 +1,80 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <ostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "infer_request_wrap.hpp"
+#include "latency_histogram.hpp"
+
+// @brief arrival patterns of the open-loop mode
+static constexpr char poissonArrival[] = "poisson";
+static constexpr char constantArrival[] = "constant";
+
+/**
+ * @brief Issues requests to a pool of infer requests at the target rate regardless of how fast they are completed,
+ * as independent clients of a server do. An arrival waits in the queue until an infer request is free,
+ * the time it waits is reported as the queueing latency and the execution time as the service latency.
+ */
+class OpenLoopGenerator {
+public:
+    struct Config {
+        // arrivals per second
+        double qps;
+        std::string arrival;
+        // the requests arrived during the warm-up are executed but not measured
+        long long warmupNs;
+        long long durationNs;
+        unsigned seed;
+    };
+
+    OpenLoopGenerator(const std::string &name, const std::vector<InferReqWrap::Ptr> &requests, const Config &config);
+    ~OpenLoopGenerator();
+
+    void start();
+    void join();
+
+    /// @brief Writes the measured statistics as a JSON object
+    void dumpJson(std::ostream &out) const;
+
+    /// @brief Prints the measured statistics to the log
+    void print() const;
+
+private:
+    void run();
+    void onCompleted(size_t request);
+    Time::duration nextInterval();
+
+    std::string _name;
+    std::vector<InferReqWrap::Ptr> _requests;
+    const Config _config;
+    std::mt19937 _random;
+    std::exponential_distribution<double> _exponential;
+    std::thread _thread;
+
+    std::mutex _mutex;
+    std::condition_variable _completed;
+    // arrival times of the requests waiting for a free infer request
+    std::deque<Time::time_point> _pending;
+    std::vector<size_t> _freeRequests;
+    // arrival time of the request being executed by each infer request
+    std::vector<Time::time_point> _arrivals;
+    Time::time_point _measureStart;
+
+    LatencyHistogram _queueing;
+    LatencyHistogram _service;
+    LatencyHistogram _total;
+    size_t _arrived = 0;
+    // requests still waiting in the queue when the run ended
+    size_t _dropped = 0;
+    size_t _maxQueue = 0;
+};
@@ -252,6 +252,8 @@ void Int8Calibrator::validateInt8Config(const InferenceEngine::NetworkStatsMap &
     for (auto l : network) {
         if (l->type == "FullyConnected") {
             l->params["quantization_level"] = (convertFullyConnected == false) ? "FP32" : "I8";
+        } else if (isQuantizableRNN(l)) {
+            l->params["quantization_level"] = "I8";
         }
     }
 
@@ -555,6 +557,11 @@ void Int8Calibrator::calculateLayersAccuracyDrop() {
     _singleLayerRequests.clear();
 }
 
+bool Int8Calibrator::isQuantizableRNN(const CNNLayerPtr &layer) {
+    auto rnn = std::dynamic_pointer_cast<RNNCellBase>(layer);
+    return rnn && rnn->cellType == RNNCellBase::LSTM;
+}
+
 std::map<std::string, float> Int8Calibrator::layersAccuracyDrop() {
     return _layersAccuracyDrop;
 }
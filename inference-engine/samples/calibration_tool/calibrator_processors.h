@@ -86,6 +86,12 @@ public:
      */
     std::map<std::string, float> layersAccuracyDrop();
 
+    /**
+     * Returns true for recurrent layers which are executed in int8 if marked by quantization_level
+     * parameter. Their data and weights are quantized inside of the layer.
+     */
+    static bool isQuantizableRNN(const InferenceEngine::CNNLayerPtr &layer);
+
 protected:
     /**
      * This function should be called from final callibrator after and each Infer for each picture
@@ -283,6 +283,10 @@ void SaveCalibratedIR(const std::string &originalName,
                 layer->params["quantization_level"] = "I8";
                 std::cout << layer->name << ": " << "I8" << std::endl;
             }
+        } else if (Int8Calibrator::isQuantizableRNN(layer)) {
+            auto it = layersToInt8.find(layer->name);
+            layer->params["quantization_level"] = (it != layersToInt8.end() && it->second == false) ? "FP32" : "I8";
+            std::cout << layer->name << ": " << layer->params["quantization_level"] << std::endl;
         }
     }
 
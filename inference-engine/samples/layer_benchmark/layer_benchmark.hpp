@@ -0,0 +1,119 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <gflags/gflags.h>
+#include <iostream>
+
+/// @brief message for help argument
+static const char help_message[] = "Print a usage message";
+
+/// @brief message for plugin_path argument
+static const char plugin_path_message[] = "Optional. Path to a plugin folder.";
+
+/// @brief message for user library argument
+static const char custom_cpu_library_message[] = "Optional. Absolute path to a shared library with the kernels implementations.";
+
+/// @brief message for layers argument
+static const char layers_message[] = "Optional. Comma-separated list of layers to benchmark: " \
+"conv, eltwise, permute, concat, gemm, softmax, mvn, resample. All layers are benchmarked by default.";
+
+/// @brief message for layouts argument
+static const char layouts_message[] = "Optional. Comma-separated list of layouts of the input and output blobs: NCHW, NHWC. " \
+"Default value is \"NCHW,NHWC\".";
+
+/// @brief message for precisions argument
+static const char precisions_message[] = "Optional. Comma-separated list of execution precisions: FP32, I8. " \
+"I8 is benchmarked for the layers supporting int8 execution only. Default value is \"FP32,I8\".";
+
+/// @brief message for #threads argument
+static const char infer_num_threads_message[] = "Optional. Comma-separated list of numbers of threads to use for inference. " \
+"0 means the default number of threads. Default value is \"1,0\".";
+
+/// @brief message for iterations count
+static const char iterations_count_message[] = "Optional. Number of measured iterations of every benchmark. Default value is 100.";
+
+/// @brief message for warm-up iterations count
+static const char warmup_count_message[] = "Optional. Number of not measured iterations run before the measured ones. " \
+"Default value is 5.";
+
+/// @brief message for report argument
+static const char report_message[] = "Optional. Path to a file where the results are stored.";
+
+/// @brief message for report format argument
+static const char report_format_message[] = "Optional. Format of the results file: csv or json. Default value is \"csv\".";
+
+/// @brief message for baseline argument
+static const char baseline_message[] = "Optional. Path to a csv results file of a previous run to compare the results with. " \
+"The application returns a non-zero code if some benchmark regressed.";
+
+/// @brief message for threshold argument
+static const char threshold_message[] = "Optional. Allowed slowdown against the baseline in percent. Default value is 5.";
+
+/// @brief Define flag for showing help message <br>
+DEFINE_bool(h, false, help_message);
+
+/// @brief Define parameter for set path to plugins <br>
+DEFINE_string(pp, "", plugin_path_message);
+
+/// @brief Absolute path to CPU library with user layers <br>
+DEFINE_string(l, "", custom_cpu_library_message);
+
+/// @brief Layers to benchmark <br>
+/// Default is empty (that means all layers)
+DEFINE_string(layers, "", layers_message);
+
+/// @brief Layouts of the input and output blobs
+DEFINE_string(layouts, "NCHW,NHWC", layouts_message);
+
+/// @brief Execution precisions
+DEFINE_string(precisions, "FP32,I8", precisions_message);
+
+/// @brief Numbers of threads to use for inference
+DEFINE_string(nthreads, "1,0", infer_num_threads_message);
+
+/// @brief Measured iterations count
+DEFINE_uint32(niter, 100, iterations_count_message);
+
+/// @brief Warm-up iterations count
+DEFINE_uint32(nwarmup, 5, warmup_count_message);
+
+/// @brief Path to a results file
+DEFINE_string(report, "", report_message);
+
+/// @brief Format of a results file
+DEFINE_string(report_format, "csv", report_format_message);
+
+/// @brief Path to a baseline results file
+DEFINE_string(baseline, "", baseline_message);
+
+/// @brief Allowed slowdown in percent
+DEFINE_double(threshold, 5.0, threshold_message);
+
+/**
+* @brief This function show a help message
+*/
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "layer_benchmark [OPTION]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << std::endl;
+    std::cout << "    -h                        " << help_message << std::endl;
+    std::cout << "    -pp \"<path>\"              " << plugin_path_message << std::endl;
+    std::cout << "    -l \"<absolute_path>\"      " << custom_cpu_library_message << std::endl;
+    std::cout << "    -layers \"<list>\"          " << layers_message << std::endl;
+    std::cout << "    -layouts \"<list>\"         " << layouts_message << std::endl;
+    std::cout << "    -precisions \"<list>\"      " << precisions_message << std::endl;
+    std::cout << "    -nthreads \"<list>\"        " << infer_num_threads_message << std::endl;
+    std::cout << "    -niter \"<integer>\"        " << iterations_count_message << std::endl;
+    std::cout << "    -nwarmup \"<integer>\"      " << warmup_count_message << std::endl;
+    std::cout << std::endl << "  Results options:" << std::endl;
+    std::cout << "    -report \"<path>\"          " << report_message << std::endl;
+    std::cout << "    -report_format \"<format>\" " << report_format_message << std::endl;
+    std::cout << "    -baseline \"<path>\"        " << baseline_message << std::endl;
+    std::cout << "    -threshold \"<double>\"     " << threshold_message << std::endl;
+}
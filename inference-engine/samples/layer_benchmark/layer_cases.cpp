@@ -0,0 +1,259 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ie_builders.hpp>
+
+#include "layer_cases.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+size_t elementsCount(const SizeVector& dims) {
+    size_t count = 1;
+    for (auto dim : dims)
+        count *= dim;
+    return count;
+}
+
+std::string dims2str(const SizeVector& dims) {
+    std::stringstream str;
+    for (size_t i = 0; i < dims.size(); i++)
+        str << (i ? "x" : "") << dims[i];
+    return str.str();
+}
+
+Blob::CPtr randomBlob(size_t size, float low, float high) {
+    auto blob = make_shared_blob<float>(TensorDesc(Precision::FP32, {size}, Layout::C));
+    blob->allocate();
+    fillRandom(blob, low, high);
+    return blob;
+}
+
+NetworkNodeStatsPtr rangeStatistics(size_t channels, float low, float high) {
+    auto stats = std::make_shared<NetworkNodeStats>(static_cast<int>(channels));
+    stats->_minOutputs.assign(channels, low);
+    stats->_maxOutputs.assign(channels, high);
+    return stats;
+}
+
+CNNNetwork buildNetwork(Builder::Network& builder, idx_t layerId) {
+    builder.addLayer({PortInfo(layerId)}, Builder::OutputLayer("out"));
+    return CNNNetwork{Builder::convertToICNNNetwork(builder.build())};
+}
+
+struct ConvParams {
+    SizeVector dims;
+    size_t outDepth;
+    size_t kernel;
+    size_t stride;
+    size_t group;
+};
+
+LayerCase convolutionCase(const ConvParams& p) {
+    size_t pad = p.kernel / 2;
+    size_t inDepth = p.dims[1];
+    SizeVector outDims = {p.dims[0], p.outDepth,
+                          (p.dims[2] + 2 * pad - p.kernel) / p.stride + 1,
+                          (p.dims[3] + 2 * pad - p.kernel) / p.stride + 1};
+    size_t weightsSize = p.outDepth * inDepth / p.group * p.kernel * p.kernel;
+
+    LayerCase result;
+    result.layer = "conv";
+    result.shape = dims2str(p.dims) + "_k" + std::to_string(p.kernel) + "_s" + std::to_string(p.stride) +
+                   "_g" + std::to_string(p.group) + "_oc" + std::to_string(p.outDepth);
+    result.nodeName = "conv";
+    result.operations = 2.0 * elementsCount(outDims) * (inDepth / p.group) * p.kernel * p.kernel;
+    result.bytes = sizeof(float) * (elementsCount(p.dims) + elementsCount(outDims) + weightsSize + p.outDepth);
+    // the input is uniform in [0, 1) and the weights are uniform in [-0.5, 0.5)
+    float outputBound = 0.5f * weightsSize / p.outDepth;
+    result.int8Statistics["data"] = rangeStatistics(inDepth, 0.f, 1.f);
+    result.int8Statistics["conv"] = rangeStatistics(p.outDepth, -outputBound, outputBound);
+    result.createNetwork = [p, pad, weightsSize]() {
+        Builder::Network builder("conv");
+        idx_t dataId = builder.addLayer(Builder::InputLayer("data").setPort(Port(p.dims)));
+        idx_t weightsId = builder.addLayer(Builder::ConstLayer("weights").setData(randomBlob(weightsSize, -0.5f, 0.5f)));
+        idx_t biasesId = builder.addLayer(Builder::ConstLayer("biases").setData(randomBlob(p.outDepth, -0.5f, 0.5f)));
+        idx_t layerId = builder.addLayer({{dataId}, {weightsId}, {biasesId}}, Builder::ConvolutionLayer("conv")
+                .setKernel({p.kernel, p.kernel}).setStrides({p.stride, p.stride}).setDilation({1, 1})
+                .setGroup(p.group).setOutDepth(p.outDepth).setPaddingsBegin({pad, pad}).setPaddingsEnd({pad, pad}));
+        return buildNetwork(builder, layerId);
+    };
+    return result;
+}
+
+LayerCase eltwiseCase(const SizeVector& dims) {
+    LayerCase result;
+    result.layer = "eltwise";
+    result.shape = dims2str(dims) + "_sum";
+    result.nodeName = "eltwise";
+    result.operations = elementsCount(dims);
+    result.bytes = sizeof(float) * 3.0 * elementsCount(dims);
+    result.createNetwork = [dims]() {
+        Builder::Network builder("eltwise");
+        idx_t data0Id = builder.addLayer(Builder::InputLayer("data0").setPort(Port(dims)));
+        idx_t data1Id = builder.addLayer(Builder::InputLayer("data1").setPort(Port(dims)));
+        idx_t layerId = builder.addLayer({{data0Id}, {data1Id}}, Builder::EltwiseLayer("eltwise")
+                .setEltwiseType(Builder::EltwiseLayer::SUM));
+        return buildNetwork(builder, layerId);
+    };
+    return result;
+}
+
+LayerCase permuteCase(const SizeVector& dims, const SizeVector& order) {
+    LayerCase result;
+    result.layer = "permute";
+    result.shape = dims2str(dims) + "_order" + dims2str(order);
+    result.nodeName = "permute";
+    result.bytes = sizeof(float) * 2.0 * elementsCount(dims);
+    result.createNetwork = [dims, order]() {
+        Builder::Network builder("permute");
+        idx_t dataId = builder.addLayer(Builder::InputLayer("data").setPort(Port(dims)));
+        idx_t layerId = builder.addLayer({{dataId}}, Builder::PermuteLayer("permute").setOrder(order));
+        return buildNetwork(builder, layerId);
+    };
+    return result;
+}
+
+LayerCase concatCase(const SizeVector& dims, size_t axis) {
+    LayerCase result;
+    result.layer = "concat";
+    result.shape = "2x" + dims2str(dims) + "_axis" + std::to_string(axis);
+    result.nodeName = "concat";
+    result.bytes = sizeof(float) * 4.0 * elementsCount(dims);
+    result.createNetwork = [dims, axis]() {
+        Builder::Network builder("concat");
+        idx_t data0Id = builder.addLayer(Builder::InputLayer("data0").setPort(Port(dims)));
+        idx_t data1Id = builder.addLayer(Builder::InputLayer("data1").setPort(Port(dims)));
+        idx_t layerId = builder.addLayer({{data0Id}, {data1Id}}, Builder::ConcatLayer("concat")
+                .setInputPorts({Port(dims), Port(dims)}).setAxis(axis));
+        return buildNetwork(builder, layerId);
+    };
+    return result;
+}
+
+LayerCase gemmCase(size_t m, size_t n, size_t k) {
+    LayerCase result;
+    result.layer = "gemm";
+    result.shape = "m" + std::to_string(m) + "_n" + std::to_string(n) + "_k" + std::to_string(k);
+    result.nodeName = "gemm";
+    result.operations = 2.0 * m * n * k;
+    result.bytes = sizeof(float) * (m * k + k * n + m * n);
+    result.createNetwork = [m, n, k]() {
+        Builder::Network builder("gemm");
+        idx_t aId = builder.addLayer(Builder::InputLayer("a").setPort(Port({1, 1, m, k})));
+        idx_t bId = builder.addLayer(Builder::InputLayer("b").setPort(Port({1, 1, k, n})));
+        idx_t layerId = builder.addLayer({{aId}, {bId}}, Builder::Layer("Gemm", "gemm")
+                .setParameters({{"alpha", 1.f}, {"beta", 1.f}})
+                .setInputPorts({Port({1, 1, m, k}), Port({1, 1, k, n})})
+                .setOutputPorts({Port({1, 1, m, n})}));
+        return buildNetwork(builder, layerId);
+    };
+    return result;
+}
+
+LayerCase softmaxCase(const SizeVector& dims) {
+    LayerCase result;
+    result.layer = "softmax";
+    result.shape = dims2str(dims) + "_axis1";
+    result.nodeName = "softmax";
+    // subtraction of the maximum, accumulation and division, the exponent is not counted
+    result.operations = 3.0 * elementsCount(dims);
+    result.bytes = sizeof(float) * 2.0 * elementsCount(dims);
+    result.createNetwork = [dims]() {
+        Builder::Network builder("softmax");
+        idx_t dataId = builder.addLayer(Builder::InputLayer("data").setPort(Port(dims)));
+        idx_t layerId = builder.addLayer({{dataId}}, Builder::SoftMaxLayer("softmax").setAxis(1));
+        return buildNetwork(builder, layerId);
+    };
+    return result;
+}
+
+LayerCase mvnCase(const SizeVector& dims, bool acrossChannels) {
+    LayerCase result;
+    result.layer = "mvn";
+    result.shape = dims2str(dims) + (acrossChannels ? "_across" : "_within");
+    result.nodeName = "mvn";
+    // accumulation of the values and of the squares, subtraction of the mean and division, the root is not counted
+    result.operations = 5.0 * elementsCount(dims);
+    result.bytes = sizeof(float) * 2.0 * elementsCount(dims);
+    result.createNetwork = [dims, acrossChannels]() {
+        Builder::Network builder("mvn");
+        idx_t dataId = builder.addLayer(Builder::InputLayer("data").setPort(Port(dims)));
+        idx_t layerId = builder.addLayer({{dataId}}, Builder::MVNLayer("mvn")
+                .setAcrossChannels(acrossChannels).setNormalize(true).setEpsilon(1e-9f));
+        return buildNetwork(builder, layerId);
+    };
+    return result;
+}
+
+LayerCase resampleCase(const SizeVector& dims, size_t factor) {
+    LayerCase result;
+    result.layer = "resample";
+    result.shape = dims2str(dims) + "_nearest_x" + std::to_string(factor);
+    result.nodeName = "resample";
+    result.bytes = sizeof(float) * (1.0 + factor * factor) * elementsCount(dims);
+    result.createNetwork = [dims, factor]() {
+        Builder::Network builder("resample");
+        idx_t dataId = builder.addLayer(Builder::InputLayer("data").setPort(Port(dims)));
+        idx_t layerId = builder.addLayer({{dataId}}, Builder::ResampleLayer("resample")
+                .setResampleType("caffe.ResampleParameter.NEAREST").setAntialias(false)
+                .setFactor(static_cast<float>(factor)));
+        return buildNetwork(builder, layerId);
+    };
+    return result;
+}
+
+}  // namespace
+
+void fillRandom(const Blob::Ptr& blob, float low, float high) {
+    static std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(low, high);
+    float *data = blob->buffer().as<float *>();
+    for (size_t i = 0; i < blob->size(); i++)
+        data[i] = distribution(generator);
+}
+
+std::vector<std::string> getLayerKinds() {
+    return {"conv", "eltwise", "permute", "concat", "gemm", "softmax", "mvn", "resample"};
+}
+
+std::vector<LayerCase> getLayerCases(const std::string& layer) {
+    if (layer == "conv") {
+        return {convolutionCase({{1, 3, 224, 224}, 64, 7, 2, 1}),
+                convolutionCase({{1, 64, 56, 56}, 64, 3, 1, 1}),
+                convolutionCase({{1, 256, 14, 14}, 1024, 1, 1, 1}),
+                convolutionCase({{1, 128, 56, 56}, 128, 3, 1, 128})};
+    } else if (layer == "eltwise") {
+        return {eltwiseCase({1, 64, 56, 56}),
+                eltwiseCase({1, 256, 14, 14}),
+                eltwiseCase({1, 16, 4, 4})};
+    } else if (layer == "permute") {
+        return {permuteCase({1, 64, 56, 56}, {0, 2, 3, 1}),
+                permuteCase({1, 256, 14, 14}, {0, 3, 1, 2}),
+                permuteCase({1, 16, 4, 4}, {0, 3, 1, 2})};
+    } else if (layer == "concat") {
+        return {concatCase({1, 64, 56, 56}, 1),
+                concatCase({1, 256, 14, 14}, 1)};
+    } else if (layer == "gemm") {
+        return {gemmCase(256, 256, 256),
+                gemmCase(64, 1024, 512),
+                gemmCase(8, 8, 8)};
+    } else if (layer == "softmax") {
+        return {softmaxCase({1, 1000, 1, 1}),
+                softmaxCase({1, 21, 64, 64})};
+    } else if (layer == "mvn") {
+        return {mvnCase({1, 64, 56, 56}, false),
+                mvnCase({1, 64, 56, 56}, true)};
+    } else if (layer == "resample") {
+        return {resampleCase({1, 64, 56, 56}, 2)};
+    }
+    return {};
+}
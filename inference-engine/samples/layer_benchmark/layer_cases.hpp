@@ -0,0 +1,49 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <inference_engine.hpp>
+#include <ie_icnn_network_stats.hpp>
+
+/**
+ * @brief Single-layer network benchmarked by the application
+ */
+struct LayerCase {
+    /// kind of the layer, the name used in the -layers option
+    std::string layer;
+    /// shape and attributes of the layer, unique within the kind
+    std::string shape;
+    /// name of the benchmarked layer in the network and in the performance counters
+    std::string nodeName;
+    /// arithmetic operations of a single inference
+    double operations = 0.0;
+    /// bytes of the inputs, the outputs and the weights of a single inference
+    double bytes = 0.0;
+    /// statistics to run the layer in int8, empty if the layer has no int8 implementation
+    InferenceEngine::NetworkStatsMap int8Statistics;
+    /// creates the network of a single layer with random weights
+    std::function<InferenceEngine::CNNNetwork()> createNetwork;
+};
+
+/**
+ * @brief Returns the benchmarks of the layer kind
+ * @param layer - kind of the layer, e.g. "conv"
+ * @return the benchmarks, empty if the kind is unknown
+ */
+std::vector<LayerCase> getLayerCases(const std::string& layer);
+
+/**
+ * @brief Returns kinds of all layers known to the application
+ */
+std::vector<std::string> getLayerKinds();
+
+/**
+ * @brief Fills the FP32 blob with uniformly distributed values
+ */
+void fillRandom(const InferenceEngine::Blob::Ptr& blob, float low, float high);
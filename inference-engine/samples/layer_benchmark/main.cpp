@@ -0,0 +1,313 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <inference_engine.hpp>
+#include <ext_list.hpp>
+
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+#include <samples/csv_dumper.hpp>
+
+#include "layer_benchmark.hpp"
+#include "layer_cases.hpp"
+
+using namespace InferenceEngine;
+
+typedef std::chrono::high_resolution_clock Time;
+typedef std::chrono::duration<double, std::ratio<1, 1000000>> us;
+
+/**
+ * @brief Measurements of a single benchmark configuration
+ */
+struct BenchmarkResult {
+    std::string layer;
+    std::string shape;
+    std::string precision;
+    std::string layout;
+    size_t threads;
+    std::string execType;
+    double medianUs;
+    double minUs;
+    double latencyUs;
+    double gflops;
+    double gbps;
+
+    std::string key() const {
+        return layer + ";" + shape + ";" + precision + ";" + layout + ";" + std::to_string(threads);
+    }
+};
+
+std::vector<std::string> parseList(const std::string& str) {
+    std::vector<std::string> result;
+    std::stringstream stream(str);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        trim(item);
+        if (!item.empty())
+            result.push_back(item);
+    }
+    return result;
+}
+
+bool ParseAndCheckCommandLine(int argc, char *argv[]) {
+    // ---------------------------Parsing and validation of input args--------------------------------------
+    slog::info << "Parsing input parameters" << slog::endl;
+    gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+    if (FLAGS_h) {
+        showUsage();
+        return false;
+    }
+
+    auto kinds = getLayerKinds();
+    for (const auto& layer : parseList(FLAGS_layers)) {
+        if (std::find(kinds.begin(), kinds.end(), layer) == kinds.end())
+            throw std::logic_error("Unknown layer " + layer + " (invalid -layers option value)");
+    }
+    for (const auto& layout : parseList(FLAGS_layouts)) {
+        if (layout != "NCHW" && layout != "NHWC")
+            throw std::logic_error("Unsupported layout " + layout + " (invalid -layouts option value)");
+    }
+    for (const auto& precision : parseList(FLAGS_precisions)) {
+        if (precision != "FP32" && precision != "I8")
+            throw std::logic_error("Unsupported precision " + precision + " (invalid -precisions option value)");
+    }
+    if (FLAGS_report_format != "csv" && FLAGS_report_format != "json") {
+        throw std::logic_error("only csv/json formats are supported (invalid -report_format option value)");
+    }
+    if (FLAGS_niter == 0) {
+        throw std::logic_error("Number of iterations should be positive (invalid -niter option value)");
+    }
+
+    return true;
+}
+
+double median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    size_t middle = values.size() / 2;
+    return values.size() % 2 ? values[middle] : (values[middle - 1] + values[middle]) / 2;
+}
+
+BenchmarkResult runBenchmark(InferencePlugin& plugin, const LayerCase& layerCase,
+                             const std::string& precision, const std::string& layout, size_t threads) {
+    CNNNetwork network = layerCase.createNetwork();
+    Layout blobLayout = layout == "NHWC" ? Layout::NHWC : Layout::NCHW;
+    for (auto& input : network.getInputsInfo()) {
+        input.second->setPrecision(Precision::FP32);
+        input.second->setLayout(blobLayout);
+    }
+    for (auto& output : network.getOutputsInfo()) {
+        output.second->setPrecision(Precision::FP32);
+        output.second->setLayout(blobLayout);
+    }
+
+    if (precision == "I8") {
+        ICNNNetworkStats* pstats = nullptr;
+        StatusCode s = static_cast<ICNNNetwork&>(network).getStats(&pstats, nullptr);
+        if (s != StatusCode::OK || pstats == nullptr)
+            throw std::logic_error("Cannot set statistics of the " + layerCase.layer + " network");
+        pstats->setNodesStats(layerCase.int8Statistics);
+    }
+
+    std::map<std::string, std::string> config = {{PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES}};
+    if (threads != 0)
+        config[PluginConfigParams::KEY_CPU_THREADS_NUM] = std::to_string(threads);
+    ExecutableNetwork executableNetwork = plugin.LoadNetwork(network, config);
+    InferRequest request = executableNetwork.CreateInferRequest();
+    for (const auto& input : network.getInputsInfo())
+        fillRandom(request.GetBlob(input.first), 0.f, 1.f);
+
+    for (size_t i = 0; i < FLAGS_nwarmup; i++)
+        request.Infer();
+
+    BenchmarkResult result;
+    result.layer = layerCase.layer;
+    result.shape = layerCase.shape;
+    result.precision = precision;
+    result.layout = layout;
+    result.threads = threads;
+
+    std::vector<double> nodeTimes;
+    std::vector<double> latencies;
+    for (size_t i = 0; i < FLAGS_niter; i++) {
+        auto startTime = Time::now();
+        request.Infer();
+        latencies.push_back(std::chrono::duration_cast<us>(Time::now() - startTime).count());
+
+        auto performanceMap = request.GetPerformanceCounts();
+        auto node = performanceMap.find(layerCase.nodeName);
+        if (node == performanceMap.end()) {
+            // the layer is fused or replaced, the whole inference is the best estimation
+            nodeTimes.push_back(latencies.back());
+            result.execType = "unknown";
+        } else {
+            nodeTimes.push_back(static_cast<double>(node->second.realTime_uSec));
+            result.execType = node->second.exec_type;
+        }
+    }
+
+    result.medianUs = median(nodeTimes);
+    result.minUs = *std::min_element(nodeTimes.begin(), nodeTimes.end());
+    result.latencyUs = median(latencies);
+    double seconds = std::max(result.medianUs, 1.0) * 1e-6;
+    result.gflops = layerCase.operations / seconds * 1e-9;
+    result.gbps = layerCase.bytes / seconds * 1e-9;
+    return result;
+}
+
+void dumpCsv(const std::vector<BenchmarkResult>& results, const std::string& path) {
+    CsvDumper dumper(true, path);
+    dumper << "layer" << "shape" << "precision" << "layout" << "threads" << "exec_type"
+           << "median_us" << "min_us" << "latency_us" << "gflops" << "gbps";
+    dumper.endLine();
+    for (const auto& result : results) {
+        dumper << result.layer << result.shape << result.precision << result.layout << result.threads
+               << result.execType << result.medianUs << result.minUs << result.latencyUs
+               << result.gflops << result.gbps;
+        dumper.endLine();
+    }
+}
+
+void dumpJson(const std::vector<BenchmarkResult>& results, const std::string& path) {
+    std::ofstream file(path);
+    if (!file)
+        throw std::logic_error("Cannot create the results file " + path);
+    file << "[" << std::endl;
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto& result = results[i];
+        file << "  {\"layer\": \"" << result.layer << "\", \"shape\": \"" << result.shape
+             << "\", \"precision\": \"" << result.precision << "\", \"layout\": \"" << result.layout
+             << "\", \"threads\": " << result.threads << ", \"exec_type\": \"" << result.execType
+             << "\", \"median_us\": " << result.medianUs << ", \"min_us\": " << result.minUs
+             << ", \"latency_us\": " << result.latencyUs << ", \"gflops\": " << result.gflops
+             << ", \"gbps\": " << result.gbps << "}" << (i + 1 < results.size() ? "," : "") << std::endl;
+    }
+    file << "]" << std::endl;
+}
+
+/**
+ * @brief Reads median times from a csv results file
+ * @return median times by the keys of the benchmarks
+ */
+std::map<std::string, double> readBaseline(const std::string& path) {
+    std::ifstream file(path);
+    if (!file)
+        throw std::logic_error("Cannot open the baseline file " + path);
+    std::map<std::string, double> baseline;
+    std::string line;
+    std::getline(file, line);  // header
+    while (std::getline(file, line)) {
+        std::vector<std::string> fields;
+        std::stringstream stream(line);
+        std::string field;
+        while (std::getline(stream, field, ';'))
+            fields.push_back(field);
+        if (fields.size() < 7)
+            continue;
+        std::string key = fields[0] + ";" + fields[1] + ";" + fields[2] + ";" + fields[3] + ";" + fields[4];
+        baseline[key] = std::stod(fields[6]);
+    }
+    return baseline;
+}
+
+/**
+* @brief The entry point of the layer benchmark application
+*/
+int main(int argc, char *argv[]) {
+    try {
+        slog::info << "InferenceEngine: " << GetInferenceEngineVersion() << slog::endl;
+
+        if (!ParseAndCheckCommandLine(argc, argv)) {
+            return 0;
+        }
+
+        // --------------------------- 1. Load Plugin for inference engine -------------------------------------
+        InferencePlugin plugin = PluginDispatcher({ FLAGS_pp }).getPluginByDevice("CPU");
+        plugin.AddExtension(std::make_shared<Extensions::Cpu::CpuExtensions>());
+        if (!FLAGS_l.empty()) {
+            // CPU (MKLDNN) extensions is loaded as a shared library and passed as a pointer to base extension
+            const auto extension_ptr = make_so_pointer<IExtension>(FLAGS_l);
+            plugin.AddExtension(extension_ptr);
+            slog::info << "CPU (MKLDNN) extensions is loaded " << FLAGS_l << slog::endl;
+        }
+        slog::info << plugin.GetVersion() << slog::endl;
+
+        // --------------------------- 2. Run the benchmarks ---------------------------------------------------
+        auto layers = FLAGS_layers.empty() ? getLayerKinds() : parseList(FLAGS_layers);
+        std::vector<size_t> threadsList;
+        for (const auto& threads : parseList(FLAGS_nthreads))
+            threadsList.push_back(std::stoul(threads));
+
+        std::vector<BenchmarkResult> results;
+        std::cout << std::left << std::setw(10) << "layer" << std::setw(32) << "shape" << std::setw(6) << "prec"
+                  << std::setw(8) << "layout" << std::setw(8) << "threads" << std::setw(20) << "exec_type"
+                  << std::setw(12) << "median_us" << std::setw(10) << "GFLOP/s" << "GB/s" << std::endl;
+        for (const auto& layer : layers) {
+            for (const auto& layerCase : getLayerCases(layer)) {
+                for (const auto& precision : parseList(FLAGS_precisions)) {
+                    if (precision == "I8" && layerCase.int8Statistics.empty())
+                        continue;
+                    for (const auto& layout : parseList(FLAGS_layouts)) {
+                        for (auto threads : threadsList) {
+                            auto result = runBenchmark(plugin, layerCase, precision, layout, threads);
+                            std::cout << std::left << std::setw(10) << result.layer << std::setw(32) << result.shape
+                                      << std::setw(6) << result.precision << std::setw(8) << result.layout
+                                      << std::setw(8) << result.threads << std::setw(20) << result.execType
+                                      << std::setw(12) << result.medianUs << std::setw(10) << result.gflops
+                                      << result.gbps << std::endl;
+                            results.push_back(result);
+                        }
+                    }
+                }
+            }
+        }
+
+        // --------------------------- 3. Store the results ----------------------------------------------------
+        if (!FLAGS_report.empty()) {
+            if (FLAGS_report_format == "json")
+                dumpJson(results, FLAGS_report);
+            else
+                dumpCsv(results, FLAGS_report);
+            slog::info << "Results are stored to " << FLAGS_report << slog::endl;
+        }
+
+        // --------------------------- 4. Compare with the baseline --------------------------------------------
+        if (!FLAGS_baseline.empty()) {
+            auto baseline = readBaseline(FLAGS_baseline);
+            size_t regressions = 0;
+            for (const auto& result : results) {
+                auto reference = baseline.find(result.key());
+                if (reference == baseline.end())
+                    continue;
+                double slowdown = (result.medianUs / std::max(reference->second, 1e-3) - 1.0) * 100.0;
+                if (slowdown > FLAGS_threshold) {
+                    slog::warn << "Regression of " << result.key() << ": " << reference->second << " us -> "
+                               << result.medianUs << " us (+" << slowdown << "%)" << slog::endl;
+                    regressions++;
+                }
+            }
+            if (regressions != 0) {
+                slog::err << regressions << " benchmarks are slower than the baseline by more than "
+                          << FLAGS_threshold << "%" << slog::endl;
+                return 1;
+            }
+            slog::info << "No regressions against the baseline " << FLAGS_baseline << slog::endl;
+        }
+    }
+    catch (const std::exception& ex) {
+        slog::err << ex.what() << slog::endl;
+        return 3;
+    }
+
+    return 0;
+}
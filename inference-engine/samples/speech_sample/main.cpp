@@ -3,6 +3,7 @@
 //
 
 #include "speech_sample.hpp"
+#include "streaming.hpp"
 
 #include <gflags/gflags.h>
 #include <functional>
@@ -19,6 +20,7 @@
 #include <chrono>
 #include <limits>
 #include <iomanip>
+#include <algorithm>
 #include <inference_engine.hpp>
 #include <gna/gna_config.hpp>
 
@@ -466,9 +468,132 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("Not valid value for 'cw' argument. It should be > 0 ");
     }
 
+    if (FLAGS_stream && FLAGS_cw > 0) {
+        throw std::logic_error("Context windows are not supported in the streaming mode (-stream).");
+    }
+
+    if (FLAGS_stream && FLAGS_frame_shift <= 0.0) {
+        throw std::logic_error("Not valid value for 'frame_shift' argument. It should be > 0 ");
+    }
+
     return true;
 }
 
+double percentile(std::vector<double> &values, double p) {
+    if (values.empty())
+        return 0.0;
+    size_t index = static_cast<size_t>(p / 100.0 * (values.size() - 1) + 0.5);
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+}
+
+/**
+ * @brief Runs all the utterances of the input file interleaved across the requests and prints the streaming statistics
+ */
+void runStreamingMode(ExecutableNetwork &executableNet,
+                      std::vector<InferRequestStruct> &inferRequests,
+                      const std::string &inputArkName,
+                      const std::string &inputName,
+                      const std::string &outputName,
+                      uint32_t batchSize) {
+    MappedArkFile input(inputArkName);
+    std::unique_ptr<MappedArkFile> reference;
+    if (!FLAGS_r.empty()) {
+        reference.reset(new MappedArkFile(FLAGS_r));
+    }
+
+    std::vector<InferRequest> requests;
+    for (auto &inferRequest : inferRequests) {
+        requests.push_back(inferRequest.inferRequest);
+    }
+
+    // the memory states of the utterances are kept apart by binding them to the requests as sequences,
+    // if the plugin cannot do that, the utterances of a stateful network are processed one by one
+    size_t utterancesPerRequest = batchSize;
+    bool stateful = !executableNet.QueryState().empty();
+    bool useSequences = false;
+    if (stateful) {
+        try {
+            requests[0].SetSequences({});
+            useSequences = true;
+        } catch (const std::exception &) {
+            slog::warn << "The plugin does not keep memory states per sequence, the utterances are processed one by one"
+                       << slog::endl;
+            requests.resize(1);
+            utterancesPerRequest = 1;
+        }
+    }
+    slog::info << "Streaming " << input.matrices().size() << " utterances through " << requests.size()
+               << " requests, " << utterancesPerRequest << " utterances per request" << slog::endl;
+
+    const uint32_t numScoresPerFrame = requests[0].GetBlob(outputName)->size() / batchSize;
+    // scores of the finished utterances are written in the order of the input file
+    std::map<size_t, std::vector<float>> scores;
+    size_t nextToWrite = 0;
+    score_error_t frameError, totalError;
+    ClearScoreError(&totalError);
+    totalError.threshold = frameError.threshold = MAX_SCORE_DIFFERENCE;
+
+    StreamingCallbacks callbacks;
+    callbacks.frameDone = [&](size_t utterance, uint32_t frame, const float *frameScores) {
+        if (!FLAGS_o.empty()) {
+            auto &utteranceScores = scores[utterance];
+            utteranceScores.resize(static_cast<size_t>(input.matrices()[utterance].numRows) * numScoresPerFrame);
+            std::memcpy(&utteranceScores[static_cast<size_t>(frame) * numScoresPerFrame], frameScores,
+                        numScoresPerFrame * sizeof(float));
+        }
+        if (reference && utterance < reference->matrices().size()) {
+            const auto &referenceScores = reference->matrices()[utterance];
+            CompareScores(const_cast<float *>(frameScores),
+                          const_cast<float *>(referenceScores.data) + static_cast<size_t>(frame) * referenceScores.numColumns,
+                          &frameError,
+                          1,
+                          referenceScores.numColumns);
+            UpdateScoreError(&frameError, &totalError);
+        }
+    };
+    callbacks.utteranceDone = [&](size_t utterance) {
+        if (useSequences) {
+            executableNet.ReleaseSequence(utterance);
+        } else if (stateful) {
+            for (auto &&state : executableNet.QueryState()) {
+                state.Reset();
+            }
+        }
+        if (!FLAGS_o.empty()) {
+            // an utterance without frames has no scores yet
+            scores[utterance];
+            for (auto it = scores.find(nextToWrite); it != scores.end() && it->first == nextToWrite;
+                 it = scores.find(nextToWrite)) {
+                const auto &matrix = input.matrices()[nextToWrite];
+                SaveKaldiArkArray(FLAGS_o.c_str(), nextToWrite != 0, matrix.name, it->second.data(),
+                                  matrix.numRows, numScoresPerFrame);
+                scores.erase(it);
+                nextToWrite++;
+            }
+        }
+    };
+
+    auto statistics = runStreaming(requests, inputName, outputName, input, utterancesPerRequest, useSequences, callbacks);
+
+    /** Show performance results **/
+    double audioTimeMs = statistics.numFrames * FLAGS_frame_shift;
+    std::cout << "Utterances:\t\t\t\t" << input.matrices().size() << std::endl;
+    std::cout << "Frames:\t\t\t\t\t" << statistics.numFrames << " frames" << std::endl;
+    std::cout << "Total time in Infer (HW and SW):\t" << statistics.totalTimeMs << " ms" << std::endl;
+    std::cout << "Throughput:\t\t\t\t" << statistics.numFrames * 1000.0 / std::max(statistics.totalTimeMs, 1e-3)
+              << " frames/sec" << std::endl;
+    std::cout << "Real-time factor:\t\t\t" << (audioTimeMs > 0.0 ? statistics.totalTimeMs / audioTimeMs : 0.0)
+              << std::endl;
+    std::cout << "Frame latency (ms):\t\t\tp50 " << percentile(statistics.frameLatenciesMs, 50.0)
+              << ", p90 " << percentile(statistics.frameLatenciesMs, 90.0)
+              << ", p99 " << percentile(statistics.frameLatenciesMs, 99.0)
+              << ", max " << percentile(statistics.frameLatenciesMs, 100.0) << std::endl;
+    if (reference) {
+        printReferenceCompareResults(totalError, statistics.numFrames, std::cout);
+    }
+}
+
 /**
  * @brief The entry point for inference engine automatic speech recognition sample
  * @file speech_sample/main.cpp
@@ -555,6 +680,11 @@ int main(int argc, char *argv[]) {
             genericPluginConfig[PluginConfigParams::KEY_PERF_COUNT] = PluginConfigParams::YES;
         }
 
+        if (FLAGS_stream && !useGna && plugin.GetVersion()->description == std::string("MKLDNNPlugin")) {
+            // every request of the pool gets its own stream of the CPU cores
+            genericPluginConfig[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = std::to_string(FLAGS_nthreads);
+        }
+
         if (FLAGS_q.compare("user") == 0) {
             std::cout << "[ INFO ] Using scale factor of " << FLAGS_sf << std::endl;
             gnaPluginConfig[GNA_CONFIG_KEY(SCALE_FACTOR)] = std::to_string(FLAGS_sf);
@@ -681,6 +811,13 @@ int main(int argc, char *argv[]) {
         // -----------------------------------------------------------------------------------------------------
 
         // --------------------------- 9. Do inference ---------------------------------------------------------
+        if (FLAGS_stream) {
+            runStreamingMode(executableNet, inferRequests, inputArkName, cInputInfo.begin()->first,
+                             cOutputInfo.begin()->first, batchSize);
+            slog::info << "Execution successful" << slog::endl;
+            return 0;
+        }
+
         std::vector<uint8_t> ptrUtterance;
         std::vector<uint8_t> ptrScores;
         std::vector<uint8_t> ptrReferenceScores;
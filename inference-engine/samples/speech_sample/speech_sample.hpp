@@ -80,6 +80,15 @@ static const char context_window_message[] = "Optional. Number of frames for con
                                              "Works only with context window networks."
                                              " If you use the cw flag, then batch size and nthreads arguments are ignored.";
 
+/// @brief message for streaming mode argument
+static const char stream_message[] = "Optional. Streaming mode: the input file is mapped to memory and the utterances are "
+                                     "interleaved across -nthreads asynchronous requests, each request processes a frame "
+                                     "of -bs utterances at once. Context windows (-cw) are not supported in this mode.";
+
+/// @brief message for frame shift argument
+static const char frame_shift_message[] = "Optional. Frame shift in milliseconds used to compute the real-time factor "
+                                          "in the streaming mode (default is 10).";
+
 /// \brief Define flag for showing help message <br>
 DEFINE_bool(h, false, help_message);
 
@@ -142,6 +151,12 @@ DEFINE_int32(nthreads, 1, infer_num_threads_message);
 /// @brief Context window size (default 0)
 DEFINE_int32(cw, 0, context_window_message);
 
+/// @brief Streaming mode (default false)
+DEFINE_bool(stream, false, stream_message);
+
+/// @brief Frame shift in milliseconds (default 10)
+DEFINE_double(frame_shift, 10.0, frame_shift_message);
+
 /**
  * \brief This function show a help message
  */
@@ -169,5 +184,7 @@ static void showUsage() {
     std::cout << "    -we \"<path>\"            " << write_embedded_model_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"   " << infer_num_threads_message << std::endl;
     std::cout << "    -cw \"<integer>\"         " << context_window_message << std::endl;
+    std::cout << "    -stream                   " << stream_message << std::endl;
+    std::cout << "    -frame_shift \"<double>\" " << frame_shift_message << std::endl;
 }
 
@@ -0,0 +1,208 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "streaming.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace InferenceEngine;
+
+typedef std::chrono::high_resolution_clock Time;
+typedef std::chrono::duration<double, std::ratio<1, 1000>> ms;
+
+MappedArkFile::MappedArkFile(const std::string &fileName) {
+#ifndef _WIN32
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if (fd != -1) {
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            void *ptr = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (ptr != MAP_FAILED) {
+                mapped = static_cast<const char *>(ptr);
+                length = static_cast<size_t>(st.st_size);
+                // the utterances are read from the beginning to the end
+                madvise(ptr, length, MADV_SEQUENTIAL);
+            }
+        }
+        close(fd);
+    }
+#endif
+    const char *data = mapped;
+    if (!data) {
+        std::ifstream file(fileName, std::ios::binary);
+        if (!file.good())
+            throw std::runtime_error("Failed to open " + fileName + " for reading");
+        buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        data = buffer.data();
+        length = buffer.size();
+    }
+
+    // every matrix is "<name>\0BFM \4<rows>\4<columns><rows * columns floats>"
+    size_t pos = 0;
+    while (pos < length) {
+        const char *name = data + pos;
+        const char *nameEnd = static_cast<const char *>(std::memchr(name, '\0', length - pos));
+        if (!nameEnd)
+            break;
+        pos = nameEnd - data + 1;
+        const size_t headerSize = 5 + sizeof(uint32_t) + 1 + sizeof(uint32_t);
+        if (length - pos < headerSize || std::memcmp(data + pos, "BFM \4", 5) != 0)
+            break;
+        Matrix matrix;
+        matrix.name.assign(name, nameEnd);
+        std::memcpy(&matrix.numRows, data + pos + 5, sizeof(uint32_t));
+        std::memcpy(&matrix.numColumns, data + pos + 5 + sizeof(uint32_t) + 1, sizeof(uint32_t));
+        pos += headerSize;
+        size_t dataSize = static_cast<size_t>(matrix.numRows) * matrix.numColumns * sizeof(float);
+        if (length - pos < dataSize)
+            throw std::runtime_error("Unexpected end of " + fileName + " in the matrix " + matrix.name);
+        matrix.data = reinterpret_cast<const float *>(data + pos);
+        pos += dataSize;
+        items.push_back(matrix);
+    }
+}
+
+MappedArkFile::~MappedArkFile() {
+#ifndef _WIN32
+    if (mapped)
+        munmap(const_cast<char *>(mapped), length);
+#endif
+}
+
+namespace {
+
+struct Lane {
+    size_t utterance;
+    uint32_t frame;
+};
+
+struct StreamingRequest {
+    InferRequest *request;
+    std::vector<Lane> lanes;
+    std::vector<size_t> sequenceIds;
+    Time::time_point started;
+    Time::time_point finished;
+    bool busy = false;
+};
+
+}  // namespace
+
+StreamingStatistics runStreaming(std::vector<InferRequest> &requests,
+                                 const std::string &inputName,
+                                 const std::string &outputName,
+                                 const MappedArkFile &input,
+                                 size_t utterancesPerRequest,
+                                 bool useSequences,
+                                 const StreamingCallbacks &callbacks) {
+    StreamingStatistics statistics;
+    if (requests.empty() || utterancesPerRequest == 0)
+        return statistics;
+
+    const auto &utterances = input.matrices();
+    const size_t batch = requests[0].GetBlob(inputName)->getTensorDesc().getDims()[0];
+    if (utterancesPerRequest > batch)
+        throw std::logic_error("Number of utterances per request exceeds the batch size " + std::to_string(batch));
+
+    std::deque<size_t> pending;
+    for (size_t i = 0; i < utterances.size(); i++) {
+        if (utterances[i].numRows != 0)
+            pending.push_back(i);
+        else if (callbacks.utteranceDone)
+            callbacks.utteranceDone(i);
+    }
+
+    // the completion time is taken in the callback, so it does not depend on the order of waiting
+    std::vector<std::unique_ptr<StreamingRequest>> pool;
+    for (auto &request : requests) {
+        pool.emplace_back(new StreamingRequest());
+        StreamingRequest *streamingRequest = pool.back().get();
+        streamingRequest->request = &request;
+        request.SetCompletionCallback([streamingRequest] { streamingRequest->finished = Time::now(); });
+    }
+
+    auto submit = [&](StreamingRequest &r) {
+        while (r.lanes.size() < utterancesPerRequest && !pending.empty()) {
+            r.lanes.push_back({pending.front(), 0});
+            pending.pop_front();
+        }
+        if (r.lanes.empty()) {
+            r.busy = false;
+            return;
+        }
+
+        Blob::Ptr inputBlob = r.request->GetBlob(inputName);
+        const size_t frameSize = inputBlob->size() / batch;
+        float *inputData = inputBlob->buffer().as<float *>();
+        r.sequenceIds.clear();
+        for (size_t i = 0; i < r.lanes.size(); i++) {
+            const auto &utterance = utterances[r.lanes[i].utterance];
+            if (utterance.numColumns != frameSize)
+                throw std::logic_error("network input size(" + std::to_string(frameSize) +
+                                       ") mismatch to ark file size (" + std::to_string(utterance.numColumns) + ")");
+            std::memcpy(inputData + i * frameSize, utterance.data + static_cast<size_t>(r.lanes[i].frame) * frameSize,
+                        frameSize * sizeof(float));
+            r.sequenceIds.push_back(r.lanes[i].utterance);
+        }
+        if (useSequences)
+            r.request->SetSequences(r.sequenceIds);
+        r.started = Time::now();
+        r.request->StartAsync();
+        r.busy = true;
+    };
+
+    auto complete = [&](StreamingRequest &r) {
+        r.request->Wait(IInferRequest::WaitMode::RESULT_READY);
+        double latency = std::chrono::duration_cast<ms>(r.finished - r.started).count();
+        Blob::Ptr outputBlob = r.request->GetBlob(outputName);
+        const size_t scoresSize = outputBlob->size() / batch;
+        const float *outputData = outputBlob->buffer().as<const float *>();
+
+        std::vector<Lane> lanes;
+        for (size_t i = 0; i < r.lanes.size(); i++) {
+            Lane lane = r.lanes[i];
+            if (callbacks.frameDone)
+                callbacks.frameDone(lane.utterance, lane.frame, outputData + i * scoresSize);
+            statistics.frameLatenciesMs.push_back(latency);
+            statistics.numFrames++;
+            if (++lane.frame < utterances[lane.utterance].numRows) {
+                lanes.push_back(lane);
+            } else if (callbacks.utteranceDone) {
+                callbacks.utteranceDone(lane.utterance);
+            }
+        }
+        r.lanes = lanes;
+    };
+
+    auto t0 = Time::now();
+    for (auto &r : pool)
+        submit(*r);
+    bool busy = true;
+    while (busy) {
+        busy = false;
+        for (auto &r : pool) {
+            if (!r->busy)
+                continue;
+            complete(*r);
+            submit(*r);
+            busy |= r->busy;
+        }
+    }
+    statistics.totalTimeMs = std::chrono::duration_cast<ms>(Time::now() - t0).count();
+    return statistics;
+}
@@ -0,0 +1,77 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <inference_engine.hpp>
+
+/**
+ * @brief Kaldi ARK file mapped to the memory, the matrices refer to the mapped data without copying it
+ */
+class MappedArkFile {
+public:
+    struct Matrix {
+        std::string name;
+        uint32_t numRows;
+        uint32_t numColumns;
+        const float *data;
+    };
+
+    explicit MappedArkFile(const std::string &fileName);
+    ~MappedArkFile();
+
+    MappedArkFile(const MappedArkFile &) = delete;
+    MappedArkFile &operator=(const MappedArkFile &) = delete;
+
+    const std::vector<Matrix> &matrices() const {
+        return items;
+    }
+
+private:
+    const char *mapped = nullptr;
+    size_t length = 0;
+    // the file content if the file cannot be mapped
+    std::vector<char> buffer;
+    std::vector<Matrix> items;
+};
+
+/**
+ * @brief Notifications of the streaming pipeline, they are called from the thread running the pipeline
+ */
+struct StreamingCallbacks {
+    // scores of a frame of an utterance are ready, the frames of an utterance come in order
+    std::function<void(size_t utterance, uint32_t frame, const float *scores)> frameDone;
+    // all frames of an utterance are processed
+    std::function<void(size_t utterance)> utteranceDone;
+};
+
+struct StreamingStatistics {
+    size_t numFrames = 0;
+    double totalTimeMs = 0.0;
+    // time from submission of an inference to its completion, for every processed frame
+    std::vector<double> frameLatenciesMs;
+};
+
+/**
+ * @brief Runs all utterances of the file through the pool of requests.
+ * Every request processes a frame of up to batch size utterances at once, the i-th utterance takes the i-th batch item.
+ * An utterance sticks to a single request until all its frames are processed, so its frames go in order,
+ * the finished utterances are replaced by the next ones from the file.
+ * @param requests - pool of requests, all of them are used concurrently
+ * @param utterancesPerRequest - number of utterances processed by a request at once, must not exceed the batch size
+ * @param useSequences - bind the utterances to the requests with InferRequest::SetSequences, the sequence id
+ * of an utterance is its index in the file
+ */
+StreamingStatistics runStreaming(std::vector<InferenceEngine::InferRequest> &requests,
+                                 const std::string &inputName,
+                                 const std::string &outputName,
+                                 const MappedArkFile &input,
+                                 size_t utterancesPerRequest,
+                                 bool useSequences,
+                                 const StreamingCallbacks &callbacks);
@@ -13,8 +13,9 @@ using InferenceEngine::details::InferenceEngineException;
 
 ClassificationProcessor::ClassificationProcessor(const std::string& flags_m, const std::string& flags_d, const std::string& flags_i, int flags_b,
         InferencePlugin plugin, CsvDumper& dumper, const std::string& flags_l,
-        PreprocessingOptions preprocessingOptions, bool zeroBackground)
-    : Processor(flags_m, flags_d, flags_i, flags_b, plugin, dumper, "Classification network", preprocessingOptions), zeroBackground(zeroBackground) {
+        PreprocessingOptions preprocessingOptions, bool zeroBackground, PipelineOptions pipelineOptions)
+    : Processor(flags_m, flags_d, flags_i, flags_b, plugin, dumper, "Classification network", preprocessingOptions, pipelineOptions),
+      zeroBackground(zeroBackground) {
 
     // Change path to labels file if necessary
     if (flags_l.empty()) {
@@ -41,53 +42,40 @@ std::shared_ptr<Processor::InferenceMetrics> ClassificationProcessor::Process(bo
      }
 
      auto validationMap = generator.getValidationMap(imagesPath);
-     ImageDecoder decoder;
 
      // ----------------------------Do inference-------------------------------------------------------------
      slog::info << "Starting inference" << slog::endl;
 
-     std::vector<int> expected(batch);
-     std::vector<std::string> files(batch);
-
      ConsoleProgress progress(validationMap.size(), stream_output);
 
      ClassificationInferenceMetrics im;
 
-     std::string firstInputName = this->inputInfo.begin()->first;
      std::string firstOutputName = this->outInfo.begin()->first;
-     auto firstInputBlob = inferRequest.GetBlob(firstInputName);
-     auto firstOutputBlob = inferRequest.GetBlob(firstOutputName);
-
-     auto iter = validationMap.begin();
-     while (iter != validationMap.end()) {
-         size_t b = 0;
-         int filesWatched = 0;
-         for (; b < batch && iter != validationMap.end(); b++, iter++, filesWatched++) {
-             expected[b] = iter->first;
-             try {
-                 decoder.insertIntoBlob(iter->second, b, *firstInputBlob, preprocessingOptions);
-                 files[b] = iter->second;
-             } catch (const InferenceEngineException& iex) {
-                 slog::warn << "Can't read file " << iter->second << slog::endl;
-                 slog::warn << "Error: " << iex.what() << slog::endl;
-                 // Could be some non-image file in directory
-                 b--;
-                 continue;
-             }
-         }
 
-         Infer(progress, filesWatched, im);
+     auto decode = [&](size_t item, size_t slot, size_t batchPos) {
+         DecodeImage(validationMap[item].second, slot, batchPos);
+     };
 
+     auto consume = [&](const DatasetPipeline::Batch& result) {
+         auto firstOutputBlob = result.request->GetBlob(firstOutputName);
          std::vector<unsigned> results;
          auto firstOutputData = firstOutputBlob->buffer().as<PrecisionTrait<Precision::FP32>::value_type*>();
          InferenceEngine::TopResults(TOP_COUNT, *firstOutputBlob, results);
 
-         for (size_t i = 0; i < b; i++) {
-             int expc = expected[i];
+         for (size_t i = 0; i < result.items.size(); i++) {
+             const std::string& file = validationMap[result.items[i]].second;
+             if (!result.errors[i].empty()) {
+                 slog::warn << "Can't read file " << file << slog::endl;
+                 slog::warn << "Error: " << result.errors[i] << slog::endl;
+                 // Could be some non-image file in directory
+                 continue;
+             }
+
+             int expc = validationMap[result.items[i]].first;
              if (zeroBackground) expc++;
 
              bool top1Scored = (static_cast<int>(results[0 + TOP_COUNT * i]) == expc);
-             dumper << "\"" + files[i] + "\"" << top1Scored;
+             dumper << "\"" + file + "\"" << top1Scored;
              if (top1Scored) im.top1Result++;
              for (int j = 0; j < TOP_COUNT; j++) {
                  unsigned classId = results[j + TOP_COUNT * i];
@@ -99,7 +87,10 @@ std::shared_ptr<Processor::InferenceMetrics> ClassificationProcessor::Process(bo
              dumper.endLine();
              im.total++;
          }
-     }
+         progress.addProgress(static_cast<int>(result.items.size()));
+     };
+
+     Infer(validationMap.size(), decode, consume, im);
      progress.finish();
 
      return std::shared_ptr<Processor::InferenceMetrics>(new ClassificationInferenceMetrics(im));
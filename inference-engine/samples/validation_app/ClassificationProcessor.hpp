@@ -30,7 +30,7 @@ protected:
 public:
     ClassificationProcessor(const std::string& flags_m, const std::string& flags_d, const std::string& flags_i, int flags_b,
             InferenceEngine::InferencePlugin plugin, CsvDumper& dumper, const std::string& flags_l,
-            PreprocessingOptions preprocessingOptions, bool zeroBackground);
+            PreprocessingOptions preprocessingOptions, bool zeroBackground, PipelineOptions pipelineOptions = PipelineOptions());
     ClassificationProcessor(const std::string& flags_m, const std::string& flags_d, const std::string& flags_i, int flags_b,
             InferenceEngine::InferencePlugin plugin, CsvDumper& dumper, const std::string& flags_l, bool zeroBackground);
 
@@ -0,0 +1,185 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "DatasetPipeline.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+typedef std::chrono::high_resolution_clock Time;
+typedef std::chrono::duration<double, std::ratio<1, 1000>> ms;
+
+struct Slot {
+    // Batch which items are decoded into the request of the slot
+    size_t batchIndex = 0;
+    size_t decoded = 0;
+    bool started = false;
+    std::vector<std::string> errors;
+    Time::time_point startTime;
+    Time::time_point finishTime;
+};
+
+}  // namespace
+
+DatasetPipeline::DatasetPipeline(std::vector<InferRequest>& requests, size_t batch, size_t decoders)
+    : requests(requests), batch(std::max<size_t>(batch, 1)), decoders(std::max<size_t>(decoders, 1)) {
+}
+
+DatasetPipeline::Statistics DatasetPipeline::run(size_t itemsCount, const Decoder& decoder, const Consumer& consumer) {
+    Statistics statistics;
+    if (itemsCount == 0 || requests.empty()) {
+        return statistics;
+    }
+
+    const size_t batchesCount = (itemsCount + batch - 1) / batch;
+    auto batchSize = [&](size_t index) {
+        return std::min(batch, itemsCount - index * batch);
+    };
+
+    std::mutex mutex;
+    std::condition_variable slotFreed;
+    std::condition_variable batchStarted;
+    std::vector<Slot> slots(requests.size());
+    for (size_t s = 0; s < slots.size(); s++) {
+        slots[s].batchIndex = s;
+        slots[s].errors.resize(batch);
+        // The completion time is taken in the callback, so it does not depend on when the consumer gets the batch
+        Slot* slot = &slots[s];
+        requests[s].SetCompletionCallback([slot] { slot->finishTime = Time::now(); });
+    }
+
+    size_t nextItem = 0;
+    bool stop = false;
+    std::exception_ptr error;
+    double decodeTime = 0;
+
+    auto decode = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!stop && nextItem < itemsCount) {
+            // The items are taken in order, so the items of the earlier batches are always decoded first
+            const size_t item = nextItem++;
+            const size_t index = item / batch;
+            Slot& slot = slots[index % slots.size()];
+            slotFreed.wait(lock, [&] { return stop || slot.batchIndex == index; });
+            if (stop) {
+                break;
+            }
+            lock.unlock();
+
+            std::string message;
+            auto t0 = Time::now();
+            try {
+                decoder(item, index % slots.size(), item % batch);
+            } catch (const std::exception& ex) {
+                message = ex.what();
+                if (message.empty()) message = "Unknown error";
+            } catch (...) {
+                message = "Unknown error";
+            }
+            double time = std::chrono::duration_cast<ms>(Time::now() - t0).count();
+
+            lock.lock();
+            decodeTime += time;
+            slot.errors[item % batch] = message;
+            if (++slot.decoded == batchSize(index)) {
+                try {
+                    slot.startTime = Time::now();
+                    requests[index % slots.size()].StartAsync();
+                } catch (...) {
+                    error = std::current_exception();
+                }
+                slot.started = true;
+                batchStarted.notify_all();
+            }
+        }
+    };
+
+    statistics.minInferTime = std::numeric_limits<double>::max();
+    auto t0 = Time::now();
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < decoders; i++) {
+        threads.emplace_back(decode);
+    }
+
+    auto finish = [&]() {
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        // The callbacks refer to the slots, so the requests started before a failure have to finish first
+        for (auto& request : requests) {
+            try {
+                request.Wait(IInferRequest::WaitMode::RESULT_READY);
+            } catch (...) {
+            }
+            request.SetCompletionCallback([] { });
+        }
+    };
+
+    try {
+        for (size_t index = 0; index < batchesCount; index++) {
+            const size_t s = index % slots.size();
+            Batch result;
+            result.index = index;
+            result.request = &requests[s];
+
+            auto waitStart = Time::now();
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                batchStarted.wait(lock, [&] { return error || slots[s].started; });
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+                result.errors.assign(slots[s].errors.begin(), slots[s].errors.begin() + batchSize(index));
+            }
+            requests[s].Wait(IInferRequest::WaitMode::RESULT_READY);
+            statistics.waitTime += std::chrono::duration_cast<ms>(Time::now() - waitStart).count();
+
+            double inferTime = std::chrono::duration_cast<ms>(slots[s].finishTime - slots[s].startTime).count();
+            statistics.inferTime += inferTime;
+            statistics.minInferTime = std::min(statistics.minInferTime, inferTime);
+            statistics.maxInferTime = std::max(statistics.maxInferTime, inferTime);
+
+            for (size_t b = 0; b < batchSize(index); b++) {
+                result.items.push_back(index * batch + b);
+            }
+            auto consumeStart = Time::now();
+            consumer(result);
+            statistics.consumeTime += std::chrono::duration_cast<ms>(Time::now() - consumeStart).count();
+            statistics.images += result.items.size();
+            statistics.batches++;
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                slots[s].batchIndex = index + slots.size();
+                slots[s].decoded = 0;
+                slots[s].started = false;
+            }
+            slotFreed.notify_all();
+        }
+    } catch (...) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        slotFreed.notify_all();
+        finish();
+        throw;
+    }
+
+    finish();
+    statistics.totalTime = std::chrono::duration_cast<ms>(Time::now() - t0).count();
+    statistics.decodeTime = decodeTime;
+    return statistics;
+}
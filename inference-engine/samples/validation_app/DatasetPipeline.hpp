@@ -0,0 +1,84 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "inference_engine.hpp"
+
+struct PipelineOptions {
+    // Number of asynchronous infer requests kept in flight
+    size_t requests;
+
+    // Number of threads decoding the images
+    size_t decoders;
+
+    // The images are resized by the Inference Engine pre-processing of the requests instead of the decoder threads
+    bool resizeInRequests;
+
+    PipelineOptions() : requests(2), decoders(2), resizeInRequests(false) { }
+
+    PipelineOptions(size_t requests, size_t decoders, bool resizeInRequests = false)
+        : requests(requests), decoders(decoders), resizeInRequests(resizeInRequests) { }
+};
+
+/**
+ * @brief Bounded producer/consumer pipeline feeding a pool of infer requests with a dataset.
+ * The i-th batch takes the items [i * batch, (i + 1) * batch) and is inferred by the request i % requests.size().
+ * The decoder threads put the items directly into the inputs of the requests, a request is started as soon as
+ * all items of its batch are decoded, and the decoders never go further than one batch per request ahead of
+ * the consumer. The consumer gets the batches strictly in order, so the results do not depend on the timing.
+ */
+class DatasetPipeline {
+public:
+    struct Batch {
+        size_t index;
+        InferenceEngine::InferRequest* request;
+        // Indices of the dataset items in the batch positions
+        std::vector<size_t> items;
+        // Empty for the successfully decoded items, the error message otherwise
+        std::vector<std::string> errors;
+    };
+
+    struct Statistics {
+        size_t images = 0;
+        size_t batches = 0;
+        // Wall-clock time of the whole run
+        double totalTime = 0;
+        // Time of decoding summed over the decoder threads
+        double decodeTime = 0;
+        // Time from the start of a request to its completion summed over the batches
+        double inferTime = 0;
+        double minInferTime = 0;
+        double maxInferTime = 0;
+        // Time the consumer waited for the results
+        double waitTime = 0;
+        // Time spent in the consumer callback
+        double consumeTime = 0;
+    };
+
+    /**
+     * @brief Puts the dataset item to the batch position of the input of the request with the given slot index.
+     * Throws if the item cannot be decoded, the item is reported in Batch::errors then.
+     * Called concurrently from the decoder threads, different items of the same batch can be decoded at once.
+     */
+    typedef std::function<void(size_t item, size_t slot, size_t batchPos)> Decoder;
+    typedef std::function<void(const Batch& batch)> Consumer;
+
+    DatasetPipeline(std::vector<InferenceEngine::InferRequest>& requests, size_t batch, size_t decoders);
+
+    /**
+     * @brief Runs the items [0, itemsCount) through the requests, the last batch can be incomplete
+     */
+    Statistics run(size_t itemsCount, const Decoder& decoder, const Consumer& consumer);
+
+private:
+    std::vector<InferenceEngine::InferRequest>& requests;
+    size_t batch;
+    size_t decoders;
+};
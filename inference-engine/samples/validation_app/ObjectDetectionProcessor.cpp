@@ -22,8 +22,9 @@ using InferenceEngine::details::InferenceEngineException;
 ObjectDetectionProcessor::ObjectDetectionProcessor(const std::string& flags_m, const std::string& flags_d,
         const std::string& flags_i, const std::string& subdir, int flags_b,
         double threshold, InferenceEngine::InferencePlugin plugin, CsvDumper& dumper,
-        const std::string& flags_a, const std::string& classes_list_file, PreprocessingOptions preprocessingOptions, bool scaleProposalToInputSize)
-            : Processor(flags_m, flags_d, flags_i, flags_b, plugin, dumper, "Object detection network", preprocessingOptions),
+        const std::string& flags_a, const std::string& classes_list_file, PreprocessingOptions preprocessingOptions, bool scaleProposalToInputSize,
+        PipelineOptions pipelineOptions)
+            : Processor(flags_m, flags_d, flags_i, flags_b, plugin, dumper, "Object detection network", preprocessingOptions, pipelineOptions),
               annotationsPath(flags_a), subdir(subdir), threshold(threshold), scaleProposalToInputSize(scaleProposalToInputSize) {
     std::ifstream clf(classes_list_file);
     if (!clf) {
@@ -85,66 +86,60 @@ shared_ptr<Processor::InferenceMetrics> ObjectDetectionProcessor::Process(bool s
     // ----------------------------Do inference-------------------------------------------------------------
     slog::info << "Starting inference" << slog::endl;
 
-    std::vector<VOCAnnotation> expected(batch);
-
     ConsoleProgress progress(annCollector.annotations().size(), stream_output);
 
     ObjectDetectionInferenceMetrics im(threshold);
 
-    vector<VOCAnnotation>::const_iterator iter = annCollector.annotations().begin();
-
+    std::vector<std::string> files;
     std::map<std::string, ImageDescription> scaledDesiredForFiles;
 
-    std::string firstInputName = this->inputInfo.begin()->first;
-    auto firstInputBlob = inferRequest.GetBlob(firstInputName);
-
-    while (iter != annCollector.annotations().end()) {
-        std::vector<std::string> files;
-        size_t b = 0;
-
-        int filesWatched = 0;
-        for (; b < batch && iter != annCollector.annotations().end(); b++, iter++, filesWatched++) {
-            expected[b] = *iter;
-            string filename = iter->folder + "/" + (!subdir.empty() ? subdir + "/" : "") + iter->filename;
-            try {
-                float scale_x, scale_y;
-
-                scale_x = 1.0f / iter->size.width;  // orig_size.width;
-                scale_y = 1.0f / iter->size.height;  // orig_size.height;
-
-                if (scaleProposalToInputSize) {
-                    scale_x *= firstInputBlob->dims()[0];
-                    scale_y *= firstInputBlob->dims()[1];
-                }
-
-                // Scaling the desired result (taken from the annotation) to the network size
-                scaledDesiredForFiles.insert(std::pair<std::string, ImageDescription>(filename, desiredForFiles.at(filename).scale(scale_x, scale_y)));
-
-                files.push_back(filename);
-            } catch (const InferenceEngineException& iex) {
-                slog::warn << "Can't read file " << this->imagesPath + "/" + filename << slog::endl;
-                slog::warn << "Error: " << iex.what() << slog::endl;
-                // Could be some non-image file in directory
-                b--;
-                continue;
-            }
+    for (auto& ann : annCollector.annotations()) {
+        string filename = ann.folder + "/" + (!subdir.empty() ? subdir + "/" : "") + ann.filename;
+        float scale_x, scale_y;
+
+        scale_x = 1.0f / ann.size.width;  // orig_size.width;
+        scale_y = 1.0f / ann.size.height;  // orig_size.height;
+
+        if (scaleProposalToInputSize) {
+            scale_x *= inputDims[0];
+            scale_y *= inputDims[1];
         }
 
-        if (files.size() == batch) {
-            // Infer model
-            Infer(progress, filesWatched, im);
+        // Scaling the desired result (taken from the annotation) to the network size
+        scaledDesiredForFiles.insert(std::pair<std::string, ImageDescription>(filename, desiredForFiles.at(filename).scale(scale_x, scale_y)));
 
-            // Processing the inference result
-            std::map<std::string, std::list<DetectedObject>> detectedObjects = processResult(files);
+        files.push_back(filename);
+    }
 
-            // Calculating similarity
-            //
-            for (size_t b = 0; b < files.size(); b++) {
-                ImageDescription result(detectedObjects[files[b]]);
-                im.apc.consumeImage(result, scaledDesiredForFiles.at(files[b]));
+    auto decode = [&](size_t item, size_t slot, size_t batchPos) {
+        DecodeImage(this->imagesPath + "/" + files[item], slot, batchPos);
+    };
+
+    auto consume = [&](const DatasetPipeline::Batch& result) {
+        std::vector<std::string> batchFiles;
+        for (size_t item : result.items) {
+            batchFiles.push_back(files[item]);
+        }
+
+        // Processing the inference result
+        std::map<std::string, std::list<DetectedObject>> detectedObjects = processResult(*result.request, batchFiles);
+
+        // Calculating similarity
+        //
+        for (size_t b = 0; b < batchFiles.size(); b++) {
+            if (!result.errors[b].empty()) {
+                slog::warn << "Can't read file " << this->imagesPath + "/" + batchFiles[b] << slog::endl;
+                slog::warn << "Error: " << result.errors[b] << slog::endl;
+                continue;
             }
+            ImageDescription imageResult(detectedObjects[batchFiles[b]]);
+            im.apc.consumeImage(imageResult, scaledDesiredForFiles.at(batchFiles[b]));
         }
-    }
+        progress.addProgress(static_cast<int>(batchFiles.size()));
+    };
+
+    // Only complete batches are inferred
+    Infer(files.size() - files.size() % batch, decode, consume, im);
     progress.finish();
 
     // -----------------------------------------------------------------------------------------------------
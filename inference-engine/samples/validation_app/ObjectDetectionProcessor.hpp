@@ -35,13 +35,15 @@ protected:
 
     bool scaleProposalToInputSize;
 
-    virtual std::map<std::string, std::list<DetectedObject>> processResult(std::vector<std::string> files) = 0;
+    virtual std::map<std::string, std::list<DetectedObject>> processResult(InferenceEngine::InferRequest& request,
+            std::vector<std::string> files) = 0;
 
 public:
     ObjectDetectionProcessor(const std::string& flags_m, const std::string& flags_d, const std::string& flags_i, const std::string& subdir, int flags_b,
             double threshold,
             InferenceEngine::InferencePlugin plugin, CsvDumper& dumper,
-            const std::string& flags_a, const std::string& classes_list_file, PreprocessingOptions preprocessingOptions, bool scaleSizeToInputSize);
+            const std::string& flags_a, const std::string& classes_list_file, PreprocessingOptions preprocessingOptions, bool scaleSizeToInputSize,
+            PipelineOptions pipelineOptions = PipelineOptions());
 
     shared_ptr<InferenceMetrics> Process(bool stream_output);
     virtual void Report(const InferenceMetrics& im);
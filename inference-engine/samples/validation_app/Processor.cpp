@@ -12,10 +12,11 @@
 using namespace InferenceEngine;
 
 Processor::Processor(const std::string& flags_m, const std::string& flags_d, const std::string& flags_i, int flags_b,
-        InferencePlugin plugin, CsvDumper& dumper, const std::string& approach, PreprocessingOptions preprocessingOptions)
+        InferencePlugin plugin, CsvDumper& dumper, const std::string& approach, PreprocessingOptions preprocessingOptions,
+        PipelineOptions pipelineOptions)
 
     : modelFileName(flags_m), targetDevice(flags_d), imagesPath(flags_i), batch(flags_b),
-      preprocessingOptions(preprocessingOptions), dumper(dumper), plugin(plugin), approach(approach) {
+      preprocessingOptions(preprocessingOptions), pipelineOptions(pipelineOptions), dumper(dumper), plugin(plugin), approach(approach) {
 
     // --------------------Load network (Generated xml/bin files)-------------------------------------------
     slog::info << "Loading network files" << slog::endl;
@@ -85,28 +86,45 @@ Processor::Processor(const std::string& flags_m, const std::string& flags_d, con
 
     outputDims = outData->dims;
 
-    // Load model to plugin and create an inference request
+    if (this->pipelineOptions.resizeInRequests) {
+        // The pre-processing resizes a whole batch at once, so it needs the images of the same size
+        if (batch != 1 || preprocessingOptions.resizeCropPolicy != ResizeCropPolicy::Resize || preprocessingOptions.scaleValuesTo01) {
+            slog::warn << "Resize in the infer requests is supported for batch 1 and the \"Resize\" preprocessing "
+                       << "without scaling only, the images are resized by the decoder threads" << slog::endl;
+            this->pipelineOptions.resizeInRequests = false;
+        } else {
+            InputInfo::Ptr input = inputInfo.begin()->second;
+            input->setPrecision(Precision::U8);
+            input->getPreProcess().setResizeAlgorithm(RESIZE_BILINEAR);
+        }
+    }
+
+    // Load model to plugin and create the inference requests
 
     ExecutableNetwork executable_network = plugin.LoadNetwork(networkReader.getNetwork(), {});
-    inferRequest = executable_network.CreateInferRequest();
+    for (size_t i = 0; i < std::max<size_t>(this->pipelineOptions.requests, 1); i++) {
+        inferRequests.push_back(executable_network.CreateInferRequest());
+        inputBlobs.push_back(inferRequests.back().GetBlob(inputInfo.begin()->first));
+    }
 }
 
-double Processor::Infer(ConsoleProgress& progress, int filesWatched, InferenceMetrics& im) {
-    ResponseDesc dsc;
-
-    // InferencePlugin plugin(enginePtr);
-
-    // Infer model
-    double time = getDurationOf([&]() {
-        inferRequest.Infer();
-    });
-
-    im.maxDuration = std::min(im.maxDuration, time);
-    im.minDuration = std::max(im.minDuration, time);
-    im.totalTime += time;
-    im.nRuns++;
+void Processor::DecodeImage(const std::string& name, size_t slot, size_t batchPos) {
+    ImageDecoder decoder;
+    if (pipelineOptions.resizeInRequests) {
+        size_t channels = inputInfo.begin()->second->getTensorDesc().getDims()[1];
+        inferRequests[slot].SetBlob(inputInfo.begin()->first, decoder.loadToNativeBlob(name, channels));
+    } else {
+        decoder.insertIntoBlob(name, static_cast<int>(batchPos), *inputBlobs[slot], preprocessingOptions);
+    }
+}
 
-    progress.addProgress(filesWatched);
+void Processor::Infer(size_t itemsCount, const DatasetPipeline::Decoder& decoder, const DatasetPipeline::Consumer& consumer,
+        InferenceMetrics& im) {
+    DatasetPipeline pipeline(inferRequests, batch, pipelineOptions.decoders);
+    im.pipeline = pipeline.run(itemsCount, decoder, consumer);
 
-    return time;
+    im.nRuns = static_cast<int>(im.pipeline.batches);
+    im.totalTime = im.pipeline.inferTime;
+    im.minDuration = im.pipeline.minInferTime;
+    im.maxDuration = im.pipeline.maxInferTime;
 }
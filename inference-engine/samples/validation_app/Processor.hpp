@@ -8,6 +8,7 @@
 #include <limits>
 #include <string>
 #include <memory>
+#include <vector>
 
 #include <samples/common.hpp>
 
@@ -16,6 +17,7 @@
 #include "samples/csv_dumper.hpp"
 #include "image_decoder.hpp"
 #include "samples/console_progress.hpp"
+#include "DatasetPipeline.hpp"
 
 using namespace std;
 
@@ -28,6 +30,7 @@ public:
         double minDuration = std::numeric_limits<double>::max();
         double maxDuration = 0;
         double totalTime = 0;
+        DatasetPipeline::Statistics pipeline;
 
         virtual ~InferenceMetrics() { }  // Type has to be polymorphic
     };
@@ -37,7 +40,8 @@ protected:
     std::string targetDevice;
     std::string imagesPath;
     size_t batch;
-    InferenceEngine::InferRequest inferRequest;
+    std::vector<InferenceEngine::InferRequest> inferRequests;
+    std::vector<InferenceEngine::Blob::Ptr> inputBlobs;
     InferenceEngine::InputsDataMap inputInfo;
     InferenceEngine::OutputsDataMap outInfo;
     InferenceEngine::CNNNetReader networkReader;
@@ -45,17 +49,28 @@ protected:
     InferenceEngine::SizeVector outputDims;
     double loadDuration;
     PreprocessingOptions preprocessingOptions;
+    PipelineOptions pipelineOptions;
 
     CsvDumper& dumper;
     InferencePlugin plugin;
 
     std::string approach;
 
-    double Infer(ConsoleProgress& progress, int filesWatched, InferenceMetrics& im);
+    /**
+     * @brief Decodes the image into the input of the request of the slot at the batch position
+     */
+    void DecodeImage(const std::string& name, size_t slot, size_t batchPos);
+
+    /**
+     * @brief Runs the items through the pipeline of the decoder threads and the infer requests
+     */
+    void Infer(size_t itemsCount, const DatasetPipeline::Decoder& decoder, const DatasetPipeline::Consumer& consumer,
+            InferenceMetrics& im);
 
 public:
     Processor(const std::string& flags_m, const std::string& flags_d, const std::string& flags_i, int flags_b,
-            InferenceEngine::InferencePlugin plugin, CsvDumper& dumper, const std::string& approach, PreprocessingOptions preprocessingOptions);
+            InferenceEngine::InferencePlugin plugin, CsvDumper& dumper, const std::string& approach, PreprocessingOptions preprocessingOptions,
+            PipelineOptions pipelineOptions = PipelineOptions());
 
     virtual shared_ptr<InferenceMetrics> Process(bool stream_output = false) = 0;
     virtual void Report(const InferenceMetrics& im) {
@@ -71,8 +86,16 @@ public:
         slog::info << slog::endl;
 
         if (im.nRuns > 0) {
+            const DatasetPipeline::Statistics& ps = im.pipeline;
             slog::info << "Average infer time (ms): " << averageTime << " (" << OUTPUT_FLOATING(1000.0 / (averageTime / batch))
                     << " images per second with batch size = " << batch << ")" << slog::endl;
+            slog::info << "Throughput: " << OUTPUT_FLOATING(1000.0 * ps.images / ps.totalTime) << " images per second ("
+                    << ps.images << " images in " << OUTPUT_FLOATING(ps.totalTime) << " ms, "
+                    << inferRequests.size() << " infer requests, " << pipelineOptions.decoders << " decoder threads)" << slog::endl;
+            slog::info << "Time split (ms): decoding " << OUTPUT_FLOATING(ps.decodeTime)
+                    << " (summed over the decoder threads), inference " << OUTPUT_FLOATING(ps.inferTime)
+                    << " (summed over the batches), waiting for results " << OUTPUT_FLOATING(ps.waitTime)
+                    << ", processing of results " << OUTPUT_FLOATING(ps.consumeTime) << slog::endl;
         } else {
             slog::warn << "No images processed" << slog::endl;
         }
@@ -94,11 +94,12 @@ private:
     }
 
 protected:
-    std::map<std::string, std::list<DetectedObject>> processResult(std::vector<std::string> files) {
+    std::map<std::string, std::list<DetectedObject>> processResult(InferenceEngine::InferRequest& request,
+            std::vector<std::string> files) {
         std::map<std::string, std::list<DetectedObject>> detectedObjects;
 
         std::string firstOutputName = this->outInfo.begin()->first;
-        const auto detectionOutArray = inferRequest.GetBlob(firstOutputName);
+        const auto detectionOutArray = request.GetBlob(firstOutputName);
         const float *box = detectionOutArray->buffer().as<float*>();
 
         std::string file = *files.begin();
@@ -114,8 +115,8 @@ public:
     YOLOObjectDetectionProcessor(const std::string& flags_m, const std::string& flags_d, const std::string& flags_i, const std::string& subdir, int flags_b,
             double threshold,
             InferencePlugin plugin, CsvDumper& dumper,
-            const std::string& flags_a, const std::string& classes_list_file) :
+            const std::string& flags_a, const std::string& classes_list_file, PipelineOptions pipelineOptions = PipelineOptions()) :
 
                 ObjectDetectionProcessor(flags_m, flags_d, flags_i, subdir, flags_b, threshold,
-                        plugin, dumper, flags_a, classes_list_file, PreprocessingOptions(true, ResizeCropPolicy::Resize), false) { }
+                        plugin, dumper, flags_a, classes_list_file, PreprocessingOptions(true, ResizeCropPolicy::Resize), false, pipelineOptions) { }
 };
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <utility>
 
 #include "image_decoder.hpp"
@@ -26,6 +27,13 @@ int getLoadModeForChannels(int channels, int base) {
     return IMREAD_UNCHANGED;
 }
 
+std::string getImageFileName(const std::string& name) {
+    // TODO This is a dirty hack to support VOC2007 (where no file extension is put into annotation).
+    //      Rewrite.
+    if (name.find('.') == std::string::npos) return name + ".JPEG";
+    return name;
+}
+
 template <class T>
 cv::Size addToBlob(std::string name, int batch_pos, Blob& blob, PreprocessingOptions preprocessingOptions) {
     SizeVector blobSize = blob.dims();
@@ -36,11 +44,7 @@ cv::Size addToBlob(std::string name, int batch_pos, Blob& blob, PreprocessingOpt
     Mat orig_image, result_image;
     int loadMode = getLoadModeForChannels(channels, 0);
 
-    std::string tryName = name;
-
-    // TODO This is a dirty hack to support VOC2007 (where no file extension is put into annotation).
-    //      Rewrite.
-    if (name.find('.') == std::string::npos) tryName = name + ".JPEG";
+    std::string tryName = getImageFileName(name);
 
     orig_image = imread(tryName, loadMode);
 
@@ -127,3 +131,24 @@ std::map<std::string, cv::Size> ImageDecoder::loadToBlob(std::vector<std::string
 Size ImageDecoder::insertIntoBlob(std::string name, int batch_pos, Blob& blob, PreprocessingOptions preprocessingOptions) {
     return convertToBlob({ name }, batch_pos, blob, preprocessingOptions).at(name);
 }
+
+Blob::Ptr ImageDecoder::loadToNativeBlob(std::string name, size_t channels) {
+    std::string tryName = getImageFileName(name);
+    Mat image = imread(tryName, getLoadModeForChannels(static_cast<int>(channels), 0));
+    if (image.empty()) {
+        THROW_IE_EXCEPTION << "Cannot open image file: " << tryName;
+    }
+    if (image.channels() != static_cast<int>(channels) || image.depth() != CV_8U) {
+        THROW_IE_EXCEPTION << "Image " << tryName << " has " << image.channels() << " channels, " << channels << " are expected";
+    }
+
+    size_t rowSize = static_cast<size_t>(image.cols) * channels;
+    auto blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8,
+            {1, channels, static_cast<size_t>(image.rows), static_cast<size_t>(image.cols)}, Layout::NHWC));
+    blob->allocate();
+    uint8_t* data = blob->buffer().as<uint8_t*>();
+    for (int h = 0; h < image.rows; h++) {
+        std::copy(image.ptr<uint8_t>(h), image.ptr<uint8_t>(h) + rowSize, data + h * rowSize);
+    }
+    return blob;
+}
@@ -46,4 +46,12 @@ public:
      * @return original image size
      */
     Size insertIntoBlob(std::string name, int batch_pos, Blob& blob, PreprocessingOptions preprocessingOptions);
+
+    /**
+     * @brief Load image to a new U8 NHWC blob of the image size, so it can be resized by the Inference Engine pre-processing
+     * @param name - image file name
+     * @param channels - number of channels expected by the network
+     * @return blob with the image data
+     */
+    Blob::Ptr loadToNativeBlob(std::string name, size_t channels);
 };
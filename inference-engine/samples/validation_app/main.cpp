@@ -96,6 +96,13 @@ static const char zero_background_message[] = "\"Zero is a background\" flag. So
 
 static const char plain_output_message[] = "Flag for plain output";
 
+static const char infer_requests_message[] = "Number of infer requests processed in parallel (2 by default)";
+
+static const char decoders_message[] = "Number of threads decoding the images (2 by default)";
+
+static const char preprocessing_gapi_message[] = "Resize images with the Inference Engine pre-processing in the infer requests"
+                                                 " instead of the decoder threads (used with ppType=\"Resize\" and batch 1)";
+
 
 /// @brief Network type options and their descriptions
 static const char* types_descriptions[][2] = {
@@ -164,6 +171,12 @@ DEFINE_bool(plain, false, plain_output_message);
 
 DEFINE_string(lbl, "", labels_file_message);
 
+DEFINE_int32(nireq, 2, infer_requests_message);
+
+DEFINE_int32(ndecoders, 2, decoders_message);
+
+DEFINE_bool(ppGapi, false, preprocessing_gapi_message);
+
 /**
  * @brief This function shows a help message
  */
@@ -188,6 +201,9 @@ static void showUsage() {
     std::cout << "    -ppSize N                 " << preprocessing_size << std::endl;
     std::cout << "    -ppWidth W                " << preprocessing_width << std::endl;
     std::cout << "    -ppHeight H               " << preprocessing_height << std::endl;
+    std::cout << "    -ppGapi                   " << preprocessing_gapi_message << std::endl;
+    std::cout << "    -nireq N                  " << infer_requests_message << std::endl;
+    std::cout << "    -ndecoders N              " << decoders_message << std::endl;
     std::cout << "    --dump                    " << dump_message << std::endl;
 
     std::cout << std::endl;
@@ -252,6 +268,8 @@ int main(int argc, char *argv[]) {
         if (FLAGS_i.empty()) ee << UserException(4, "Images list is not specified (missing -i option)");
         if (FLAGS_d.empty()) ee << UserException(5, "Target device is not specified (missing -d option)");
         if (FLAGS_b < 0) ee << UserException(6, "Batch must be positive (invalid -b option value)");
+        if (FLAGS_nireq < 1) ee << UserException(7, "Number of infer requests must be positive (invalid -nireq option value)");
+        if (FLAGS_ndecoders < 1) ee << UserException(8, "Number of decoder threads must be positive (invalid -ndecoders option value)");
 
         if (netType == ObjDetection) {
             // Checking required OD-specific options
@@ -316,19 +334,21 @@ int main(int argc, char *argv[]) {
             THROW_USER_EXCEPTION(2) << "Unknown preprocessing type: " << FLAGS_ppType;
         }
 
+        PipelineOptions pipelineOptions(FLAGS_nireq, FLAGS_ndecoders, FLAGS_ppGapi);
+
         if (netType == Classification) {
             processor = std::shared_ptr<Processor>(
                     new ClassificationProcessor(FLAGS_m, FLAGS_d, FLAGS_i, FLAGS_b,
-                                                plugin, dumper, FLAGS_lbl, preprocessingOptions, FLAGS_Czb));
+                                                plugin, dumper, FLAGS_lbl, preprocessingOptions, FLAGS_Czb, pipelineOptions));
         } else if (netType == ObjDetection) {
             if (FLAGS_ODkind == "SSD") {
                 processor = std::shared_ptr<Processor>(
                         new SSDObjectDetectionProcessor(FLAGS_m, FLAGS_d, FLAGS_i, FLAGS_ODsubdir, FLAGS_b,
-                                                        0.5, plugin, dumper, FLAGS_ODa, FLAGS_ODc));
+                                                        0.5, plugin, dumper, FLAGS_ODa, FLAGS_ODc, pipelineOptions));
             } else if (FLAGS_ODkind == "YOLO") {
                 processor = std::shared_ptr<Processor>(
                         new YOLOObjectDetectionProcessor(FLAGS_m, FLAGS_d, FLAGS_i, FLAGS_ODsubdir, FLAGS_b,
-                                                         0.5, plugin, dumper, FLAGS_ODa, FLAGS_ODc));
+                                                         0.5, plugin, dumper, FLAGS_ODa, FLAGS_ODc, pipelineOptions));
             }
         } else {
             THROW_USER_EXCEPTION(2) <<  "Unknown network type specified" << FLAGS_ppType;
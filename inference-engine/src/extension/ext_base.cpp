@@ -66,7 +66,7 @@ void ExtLayerBase::addConfig(const CNNLayer* layer, std::vector<DataConfigurator
                            << " but layout specification provided for " << out_l.size();
 
     // Fill tensor parameters into config
-    auto fill_port = [] (std::vector<DataConfig>& port, DataConfigurator conf, const DataPtr& data) {
+    auto fill_port = [this] (std::vector<DataConfig>& port, DataConfigurator conf, const DataPtr& data) {
         if (!data) THROW_IE_EXCEPTION << "Cannot get input data!";
 
         DataConfig dataConfig;
@@ -80,10 +80,13 @@ void ExtLayerBase::addConfig(const CNNLayer* layer, std::vector<DataConfigurator
         std::vector<size_t> order(blocks.size());
         for (size_t i = 0; i < order.size(); i++) order[i] = i;
 
-        const bool isInt8 = (data->getPrecision() == Precision::I8 || data->getPrecision() == Precision::U8);
+        //  Int8 topologies keep 4D tensors in NHWC, the order below does not describe other ranks
+        const bool isInt8 = int8ChannelsLast &&
+                            (data->getPrecision() == Precision::I8 || data->getPrecision() == Precision::U8) &&
+                            data_dims.size() == 4;
 
         if (conf.layout == ConfLayout::BLK8 || conf.layout == ConfLayout::BLK16) {
-            if (data_dims.size() < 4 && data_dims.size() > 5)
+            if (data_dims.size() < 4 || data_dims.size() > 5)
                 THROW_IE_EXCEPTION << "Inapplicable blocking layout."
                                    << "Tensor should be 4D or 5D.";
 
@@ -93,6 +96,15 @@ void ExtLayerBase::addConfig(const CNNLayer* layer, std::vector<DataConfigurator
             order.push_back(1);
             blocks[1] = div_up(blocks[1], blk_size);
             blocks.push_back(blk_size);
+        } else if (conf.layout == ConfLayout::NSPC) {
+            if (data_dims.size() < 4 || data_dims.size() > 5)
+                THROW_IE_EXCEPTION << "Inapplicable channels last layout."
+                                   << "Tensor should be 4D or 5D.";
+
+            // Channel dimension is moved to the innermost position. Like [nhwc] or [ndhwc]
+            order.erase(order.begin() + 1);
+            order.push_back(1);
+            for (size_t i = 0; i < order.size(); i++) blocks[i] = data_dims[order[i]];
         } else if (isInt8) {
             order = {0, 2, 3, 1};
             size_t tmp = blocks[1];
@@ -102,8 +114,9 @@ void ExtLayerBase::addConfig(const CNNLayer* layer, std::vector<DataConfigurator
             conf.layout = ConfLayout::PLN;
         }
 
-        // All extension layers support only FP32 precision!
-        InferenceEngine::Precision precision = data_desc.getPrecision();
+        // Precision of the data is used unless the layer asked for another one explicitly
+        InferenceEngine::Precision precision = conf.prc != Precision::UNSPECIFIED ?
+                                               Precision(conf.prc) : data_desc.getPrecision();
         if (conf.layout == ConfLayout::ANY) {
             dataConfig.desc = TensorDesc(precision, data_dims, InferenceEngine::Layout::ANY);
         } else {
@@ -6,6 +6,7 @@
 
 #include <ie_iextension.h>
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
@@ -16,13 +17,25 @@ namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
+/**
+ * @brief Storage type for an element of the given byte size. Kernels which only move data
+ * (gather, reverse, slice, pad) are instantiated per element size instead of per precision,
+ * so FP32 and I32 share one instance, FP16, I16 and U16 share another one, and so on.
+ */
+template <size_t size> struct ElementStorage {};
+template <> struct ElementStorage<1> { using type = uint8_t; };
+template <> struct ElementStorage<2> { using type = uint16_t; };
+template <> struct ElementStorage<4> { using type = uint32_t; };
+template <> struct ElementStorage<8> { using type = uint64_t; };
+
 class ExtLayerBase: public ILayerExecImpl {
 public:
     StatusCode getSupportedConfigurations(std::vector<LayerConfig>& conf, ResponseDesc *resp) noexcept override;
     StatusCode init(LayerConfig& config, ResponseDesc *resp) noexcept override;
 
 protected:
-    enum class ConfLayout { ANY, PLN, BLK8, BLK16 };
+    // NSPC is a "channels last" layout (NHWC for 4D, NDHWC for 5D)
+    enum class ConfLayout { ANY, PLN, BLK8, BLK16, NSPC };
 
     class DataConfigurator {
     public:
@@ -32,15 +45,67 @@ protected:
         DataConfigurator(ConfLayout l, bool constant, int inplace = -1):
                 layout(l), constant(constant), inplace(inplace) {}
 
+        DataConfigurator(ConfLayout l, Precision::ePrecision prc):
+                layout(l), prc(prc) {}
+
         ConfLayout layout;
         bool constant = false;
         int inplace = -1;
+        // UNSPECIFIED means the precision of the corresponding layer data is used
+        Precision prc = Precision::UNSPECIFIED;
     };
 
+    /**
+     * @brief Selects an instance of the kernel template by element size. Intended to be called
+     * once from init() so that execute() calls the chosen instance directly.
+     * @tparam Kernel Kernel template with a static 'execute' function of the same signature for any storage type
+     * @return Pointer to Kernel<T>::execute or nullptr if the element size is not supported
+     */
+    template <template <typename> class Kernel>
+    static decltype(&Kernel<uint8_t>::execute) selectByElementSize(size_t size) {
+        switch (size) {
+            case 1: return &Kernel<typename ElementStorage<1>::type>::execute;
+            case 2: return &Kernel<typename ElementStorage<2>::type>::execute;
+            case 4: return &Kernel<typename ElementStorage<4>::type>::execute;
+            case 8: return &Kernel<typename ElementStorage<8>::type>::execute;
+            default: return nullptr;
+        }
+    }
+
+    /**
+     * @brief Selects an instance of the kernel template by precision, for kernels which compute values
+     * instead of moving them (e.g. Range). FP16 has no arithmetic type here, so it is not supported.
+     * @return Pointer to Kernel<T>::execute or nullptr if the precision is not supported
+     */
+    template <template <typename> class Kernel>
+    static decltype(&Kernel<float>::execute) selectByPrecision(Precision prc) {
+        switch (prc) {
+            case Precision::FP32: return &Kernel<float>::execute;
+            case Precision::I32: return &Kernel<int32_t>::execute;
+            case Precision::I16: return &Kernel<int16_t>::execute;
+            case Precision::U16: return &Kernel<uint16_t>::execute;
+            case Precision::I8: return &Kernel<int8_t>::execute;
+            case Precision::U8: return &Kernel<uint8_t>::execute;
+            default: return nullptr;
+        }
+    }
+
+    /**
+     * @brief Checks that the tensor can be described with the given layout
+     */
+    static bool isLayoutApplicable(ConfLayout layout, const SizeVector& dims) {
+        if (layout == ConfLayout::BLK8 || layout == ConfLayout::BLK16 || layout == ConfLayout::NSPC)
+            return dims.size() == 4 || dims.size() == 5;
+        return true;
+    }
+
     void addConfig(const CNNLayer* layer, std::vector<DataConfigurator> in_l,
                    std::vector<DataConfigurator> out_l, bool dynBatchSupport = false);
     std::string errorMsg;
     std::vector<LayerConfig> confs;
+    // 4D I8/U8 data of the PLN and ANY ports is described as NHWC, as int8 topologies keep it.
+    // Layers whose kernels index the data with planar strides reset it before addConfig().
+    bool int8ChannelsLast = true;
 
 #if defined(HAVE_AVX512F)
     static inline __m512 _mm_uni_loadu_ps(const float* psrc) {
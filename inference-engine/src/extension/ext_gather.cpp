@@ -63,20 +63,56 @@ public:
             if (dataLength == 0)
                 THROW_IE_EXCEPTION << layer->name << " Incorrect input parameters dimension!";
 
+            int8ChannelsLast = false;
             addConfig(layer, { DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN) },
                       { DataConfigurator(ConfLayout::PLN) });
+
+            //  Gathering along the outermost (batch) dimension copies whole batch slices, which are
+            //  contiguous in any layout with the batch outermost. So the layer may work in place of
+            //  the channels last or blocked layouts without reorders around it.
+            const SizeVector& dst_dims = layer->outData[0]->getTensorDesc().getDims();
+            if (axis == 0 && dictionary_dims[0] > 1 && dst_dims.size() == dictionary_dims.size()) {
+                for (auto layout : { ConfLayout::NSPC, ConfLayout::BLK8, ConfLayout::BLK16 }) {
+                    if (!isLayoutApplicable(layout, dictionary_dims))
+                        continue;
+                    addConfig(layer, { DataConfigurator(layout), DataConfigurator(ConfLayout::PLN) },
+                              { DataConfigurator(layout) });
+                }
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
     }
 
+    StatusCode init(LayerConfig& config, ResponseDesc *resp) noexcept override {
+        StatusCode rc = ExtLayerBase::init(config, resp);
+        if (rc != OK)
+            return rc;
+
+        const TensorDesc& dictionaryDesc = config.inConfs[GATHER_DICTIONARY].desc;
+        kernel = selectByElementSize<GatherKernel>(dictionaryDesc.getPrecision().size());
+        if (kernel == nullptr) {
+            if (resp) {
+                std::string errorMsg = "Unsupported 'dictionary' input precision: " +
+                                       std::string(dictionaryDesc.getPrecision().name());
+                errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+            }
+            return GENERAL_ERROR;
+        }
+
+        //  For non planar layouts the batch slice includes the channel padding of the block
+        Layout dictionaryLayout = dictionaryDesc.getLayout();
+        if (dictionaryLayout == Layout::BLOCKED || dictionaryLayout == Layout::NHWC || dictionaryLayout == Layout::NDHWC)
+            dataLength = dictionaryDesc.getBlockingDesc().getStrides()[0];
+
+        return OK;
+    }
+
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
         switch (inputs[GATHER_INDEXES]->precision()) {
             case Precision::FP32:
-                gather(inputs[GATHER_INDEXES]->cbuffer().as<const float *>(), inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
-                break;
             case Precision::I32:
-                gather(inputs[GATHER_INDEXES]->cbuffer().as<const int32_t *>(), inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
+                kernel(*this, inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
                 break;
             default:
                 return GENERAL_ERROR;
@@ -87,7 +123,20 @@ public:
 
 private:
     template <typename data_t>
-    void gather(data_t *src_dataIdx, Blob::Ptr indexes, Blob::Ptr dictionary, Blob::Ptr output);
+    struct GatherKernel {
+        static void execute(const GatherImpl& impl, const Blob::Ptr& indexes, const Blob::Ptr& dictionary, const Blob::Ptr& output) {
+            if (indexes->precision() == Precision::FP32)
+                impl.gather(indexes->cbuffer().as<const float *>(), indexes, dictionary->cbuffer().as<const data_t *>(), dictionary,
+                            output->buffer().as<data_t *>(), output);
+            else
+                impl.gather(indexes->cbuffer().as<const int32_t *>(), indexes, dictionary->cbuffer().as<const data_t *>(), dictionary,
+                            output->buffer().as<data_t *>(), output);
+        }
+    };
+
+    template <typename index_t, typename data_t>
+    void gather(const index_t *src_dataIdx, const Blob::Ptr& indexes, const data_t *src_dataDict, const Blob::Ptr& dictionary,
+                data_t *dst_data, const Blob::Ptr& output) const;
 
     int axis = 0;
     size_t numDictionaries = 1;
@@ -95,13 +144,16 @@ private:
     size_t dataLength = 1;
     const size_t GATHER_DICTIONARY = 0;
     const size_t GATHER_INDEXES = 1;
+
+    decltype(&GatherKernel<uint8_t>::execute) kernel = &GatherKernel<ElementStorage<4>::type>::execute;
 };
 
-template <typename data_t>
-void GatherImpl::gather(data_t *src_dataIdx, Blob::Ptr indexes, Blob::Ptr dictionary, Blob::Ptr output) {
+template <typename index_t, typename data_t>
+void GatherImpl::gather(const index_t *src_dataIdx, const Blob::Ptr& indexes, const data_t *src_dataDict, const Blob::Ptr& dictionary,
+                        data_t *dst_data, const Blob::Ptr& output) const {
     size_t src_dataIdxSize = indexes->size();
-    const float *src_dataDict = dictionary->cbuffer().as<const float *>() + dictionary->getTensorDesc().getBlockingDesc().getOffsetPadding();
-    float* dst_data = output->cbuffer().as<float *>() + output->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    src_dataDict += dictionary->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    dst_data += output->getTensorDesc().getBlockingDesc().getOffsetPadding();
     src_dataIdx += indexes->getTensorDesc().getBlockingDesc().getOffsetPadding();
 
     if (axis == 0) {
@@ -110,13 +162,14 @@ void GatherImpl::gather(data_t *src_dataIdx, Blob::Ptr indexes, Blob::Ptr dictio
 
             //  Index clipping
             if (idx < indexRange) {
-                //  Copying data to destination from Dictionary
+                //  Copying data to destination from Dictionary. The slices of blocked layouts include
+                //  the channel padding, so the size left is counted in slices instead of the blob size.
                 simple_copy(&dst_data[i * dataLength],
-                            output->byteSize() - (dataLength * i),
+                            sizeof(data_t) * dataLength * (src_dataIdxSize - i),
                             &src_dataDict[dataLength * idx],
-                            sizeof(float) * dataLength);
+                            sizeof(data_t) * dataLength);
             } else {
-                std::fill_n(&dst_data[i * dataLength], dataLength, 0.f);
+                std::fill_n(&dst_data[i * dataLength], dataLength, static_cast<data_t>(0));
             }
         });
     } else {
@@ -128,13 +181,13 @@ void GatherImpl::gather(data_t *src_dataIdx, Blob::Ptr indexes, Blob::Ptr dictio
                 //  Copying data to destination from Dictionary
                 for (size_t j = 0; j < numDictionaries; j++) {
                     simple_copy(&dst_data[dataLength * (i + j * src_dataIdxSize)],
-                                output->byteSize() - (dataLength * (i + j * src_dataIdxSize)),
+                                output->byteSize() - sizeof(data_t) * (dataLength * (i + j * src_dataIdxSize)),
                                 &src_dataDict[dataLength * (idx + j * indexRange)],
-                                sizeof(float) * dataLength);
+                                sizeof(data_t) * dataLength);
                 }
             } else {
                 for (size_t j = 0; j < numDictionaries; j++) {
-                    std::fill_n(&dst_data[dataLength * (i + j * src_dataIdxSize)], dataLength, 0.f);
+                    std::fill_n(&dst_data[dataLength * (i + j * src_dataIdxSize)], dataLength, static_cast<data_t>(0));
                 }
             }
         });
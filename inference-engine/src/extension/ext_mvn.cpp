@@ -42,6 +42,8 @@ public:
 #endif
             addConfig(layer, {{blk_layout, false, -1}}, {{blk_layout, false, 0}});
             addConfig(layer, {{ConfLayout::PLN, false, 0}}, {{ConfLayout::PLN, false, 0}});
+            if (isLayoutApplicable(ConfLayout::NSPC, layer->insData[0].lock()->getTensorDesc().getDims()))
+                addConfig(layer, {{ConfLayout::NSPC, false, 0}}, {{ConfLayout::NSPC, false, 0}});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -54,6 +56,8 @@ public:
 
         if (inputs[0]->layout() == NCHW || inputs[0]->layout() == NCDHW) {
             mvn_pln(src_data, dst_data, inputs[0]->getTensorDesc().getDims());
+        } else if (inputs[0]->layout() == NHWC || inputs[0]->layout() == NDHWC) {
+            mvn_nspc(src_data, dst_data, inputs[0]->getTensorDesc().getDims());
         } else {
             mvn_blk(src_data, dst_data, inputs[0]->getTensorDesc().getDims());
         }
@@ -64,6 +68,7 @@ public:
 private:
     void mvn_pln(const float* src_data, float* dst_data, const SizeVector& dims);
     void mvn_blk(const float* src_data, float* dst_data, const SizeVector& dims);
+    void mvn_nspc(const float* src_data, float* dst_data, const SizeVector& dims);
 
     bool across_channels = false;
     bool normalize_variance = true;
@@ -485,6 +490,96 @@ void MVNImpl::mvn_blk(const float* src_data, float* dst_data, const SizeVector&
     }
 }
 
+void MVNImpl::mvn_nspc(const float* src_data, float* dst_data, const SizeVector& dims) {
+    size_t dims_size = dims.size();
+    size_t N = (dims_size > 0) ? dims[0] : 1lu;
+    size_t C = (dims_size > 1) ? dims[1] : 1lu;
+    size_t D = (dims_size > 4) ? dims[dims_size - 3] : 1lu;
+    size_t H = (dims_size > 3) ? dims[dims_size - 2] : 1lu;
+    size_t W = (dims_size > 2) ? dims[dims_size - 1] : 1lu;
+
+    size_t SP = D * H * W;
+    size_t C5 = C * SP;
+
+    std::vector<float> mean(C), scale(C);
+    int nthr = parallel_get_max_threads();
+    std::vector<double> partial_sums;
+
+    // Per channel sums over the spatial positions. Each thread accumulates its own part of the
+    // spatial range, so the channels stay the innermost (contiguous) loop.
+    auto channel_sums = [&](const float* src, const float* shift, std::vector<double>& sums, bool squared) {
+        partial_sums.assign(nthr * C, 0.0);
+        parallel_nt(nthr, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(SP, nthr, ithr, start, end);
+            double* acc = &partial_sums[ithr * C];
+            for (size_t sp = start; sp < end; sp++) {
+                const float* src_sp = src + sp * C;
+                for (size_t c = 0lu; c < C; c++) {
+                    double value = static_cast<double>(src_sp[c]) - (shift ? shift[c] : 0.f);
+                    acc[c] += squared ? value * value : value;
+                }
+            }
+        });
+        sums.assign(C, 0.0);
+        for (int ithr = 0; ithr < nthr; ithr++)
+            for (size_t c = 0lu; c < C; c++)
+                sums[c] += partial_sums[ithr * C + c];
+    };
+
+    for (size_t b = 0lu; b < N; b++) {
+        const float* src_b = src_data + b * C5;
+        float* dst_b = dst_data + b * C5;
+
+        if (across_channels) {
+            // The whole batch item is one contiguous block here
+            double mean_b = parallel_sum(SP, 0.0, [&](size_t sp)->double {
+                double mean_internal = 0.0;
+                for (size_t c = 0lu; c < C; c++)
+                    mean_internal += src_b[sp * C + c];
+                return mean_internal;
+            });
+            mean_b /= static_cast<double>(C5);
+
+            double variance_b = 1.0;
+            if (normalize_variance) {
+                variance_b = parallel_sum(SP, 0.0, [&](size_t sp)->double {
+                    double variance_internal = 0.0;
+                    for (size_t c = 0lu; c < C; c++)
+                        variance_internal += std::pow(static_cast<double>(src_b[sp * C + c]) - mean_b, 2);
+                    return variance_internal;
+                });
+                variance_b /= static_cast<double>(C5);
+                variance_b += eps;
+                variance_b = std::pow(variance_b, 0.5f);
+            }
+
+            std::fill(mean.begin(), mean.end(), static_cast<float>(mean_b));
+            std::fill(scale.begin(), scale.end(), static_cast<float>(1.0 / variance_b));
+        } else {
+            std::vector<double> sums;
+            channel_sums(src_b, nullptr, sums, false);
+            for (size_t c = 0lu; c < C; c++)
+                mean[c] = static_cast<float>(sums[c] / static_cast<double>(SP));
+
+            if (normalize_variance) {
+                channel_sums(src_b, &mean[0], sums, true);
+                for (size_t c = 0lu; c < C; c++)
+                    scale[c] = static_cast<float>(1.0 / std::pow(sums[c] / static_cast<double>(SP) + eps, 0.5f));
+            } else {
+                std::fill(scale.begin(), scale.end(), 1.f);
+            }
+        }
+
+        parallel_for(SP, [&](size_t sp) {
+            const float* src_sp = src_b + sp * C;
+            float* dst_sp = dst_b + sp * C;
+            for (size_t c = 0lu; c < C; c++)
+                dst_sp[c] = (src_sp[c] - mean[c]) * scale[c];
+        });
+    }
+}
+
 REG_FACTORY_FOR(ImplFactory<MVNImpl>, MVN);
 
 }  // namespace Cpu
@@ -10,6 +10,7 @@
 #include <vector>
 #include <map>
 #include <cmath>
+#include "ie_parallel.hpp"
 #if defined(HAVE_SSE) || defined(HAVE_AVX2)
 #include <immintrin.h>
 #endif
@@ -36,6 +37,10 @@ public:
             eps = layer->GetParamAsFloat("eps");
 
             addConfig(layer, {{ConfLayout::PLN, false, 0}}, {{ConfLayout::PLN, false, 0}}, true);
+            for (auto layout : { ConfLayout::NSPC, ConfLayout::BLK8, ConfLayout::BLK16 }) {
+                if (isLayoutApplicable(layout, layer->insData[0].lock()->getTensorDesc().getDims()))
+                    addConfig(layer, {{layout, false, 0}}, {{layout, false, 0}}, true);
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -83,6 +88,16 @@ public:
         const int H = static_cast<int>(dims.size() > 2 ? dims[2] : 1);
         const int W = static_cast<int>(dims.size() > 3 ? dims[3] : 1);
 
+        if (inputs[0]->layout() == NHWC) {
+            normalize_nspc(src, scl, dst, N, C, H * W);
+            return OK;
+        }
+        if (inputs[0]->layout() == BLOCKED) {
+            const int blk_size = static_cast<int>(inputs[0]->getTensorDesc().getBlockingDesc().getBlockDims().back());
+            normalize_blk(src, scl, dst, N, C, H * W, blk_size);
+            return OK;
+        }
+
         for (int n = 0; n < N; n++) {
             const float* psrc = src + n*C*H*W;
             float* pdst = dst + n*C*H*W;
@@ -213,6 +228,91 @@ public:
     }
 
 private:
+    // Channels are contiguous in NHWC, so the per pixel norm is computed over one contiguous row of C values
+    void normalize_nspc(const float* src, const float* scl, float* dst, int N, int C, int HW) {
+        for (int n = 0; n < N; n++) {
+            const float* psrc = src + n*HW*C;
+            float* pdst = dst + n*HW*C;
+
+            if (across_spatial) {
+                float norm = parallel_sum(HW, 0.f, [&](int hw)->float {
+                    float norm_internal = 0.f;
+                    for (int c = 0; c < C; c++)
+                        norm_internal += psrc[hw*C + c]*psrc[hw*C + c];
+                    return norm_internal;
+                });
+                norm = 1.0f / std::sqrt(norm + eps);
+
+                parallel_for(HW, [&](int hw) {
+                    for (int c = 0; c < C; c++) {
+                        float s = channel_shared ? scl[0] : scl[c];
+                        pdst[hw*C + c] = psrc[hw*C + c] * norm * s;
+                    }
+                });
+            } else {
+                parallel_for(HW, [&](int hw) {
+                    const float* psrc_hw = psrc + hw*C;
+                    float* pdst_hw = pdst + hw*C;
+
+                    float norm = eps;
+                    for (int c = 0; c < C; c++)
+                        norm += psrc_hw[c]*psrc_hw[c];
+                    norm = 1.0f / std::sqrt(norm);
+
+                    for (int c = 0; c < C; c++)
+                        pdst_hw[c] = psrc_hw[c] * norm * (channel_shared ? scl[0] : scl[c]);
+                });
+            }
+        }
+    }
+
+    // In nChw8c/nChw16c a pixel keeps the channels of a block contiguous, the padded channels are skipped
+    void normalize_blk(const float* src, const float* scl, float* dst, int N, int C, int HW, int blk_size) {
+        const int CB = (C + blk_size - 1) / blk_size;
+        for (int n = 0; n < N; n++) {
+            const float* psrc = src + n*CB*HW*blk_size;
+            float* pdst = dst + n*CB*HW*blk_size;
+
+            if (across_spatial) {
+                float norm = parallel_sum(CB, 0.f, [&](int cb)->float {
+                    const float* psrc_cb = psrc + cb*HW*blk_size;
+                    const int min_cb = std::min(blk_size, C - cb*blk_size);
+                    float norm_internal = 0.f;
+                    for (int hw = 0; hw < HW; hw++)
+                        for (int c = 0; c < min_cb; c++)
+                            norm_internal += psrc_cb[hw*blk_size + c]*psrc_cb[hw*blk_size + c];
+                    return norm_internal;
+                });
+                norm = 1.0f / std::sqrt(norm + eps);
+
+                parallel_for2d(CB, HW, [&](int cb, int hw) {
+                    const int offset = (cb*HW + hw)*blk_size;
+                    const int min_cb = std::min(blk_size, C - cb*blk_size);
+                    for (int c = 0; c < min_cb; c++)
+                        pdst[offset + c] = psrc[offset + c] * norm * (channel_shared ? scl[0] : scl[cb*blk_size + c]);
+                });
+            } else {
+                parallel_for(HW, [&](int hw) {
+                    float norm = eps;
+                    for (int cb = 0; cb < CB; cb++) {
+                        const float* psrc_hw = psrc + (cb*HW + hw)*blk_size;
+                        const int min_cb = std::min(blk_size, C - cb*blk_size);
+                        for (int c = 0; c < min_cb; c++)
+                            norm += psrc_hw[c]*psrc_hw[c];
+                    }
+                    norm = 1.0f / std::sqrt(norm);
+
+                    for (int cb = 0; cb < CB; cb++) {
+                        const int offset = (cb*HW + hw)*blk_size;
+                        const int min_cb = std::min(blk_size, C - cb*blk_size);
+                        for (int c = 0; c < min_cb; c++)
+                            pdst[offset + c] = psrc[offset + c] * norm * (channel_shared ? scl[0] : scl[cb*blk_size + c]);
+                    }
+                });
+            }
+        }
+    }
+
     TBlob<float>::Ptr weights;
 
     bool across_spatial = true;
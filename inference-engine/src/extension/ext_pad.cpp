@@ -9,7 +9,9 @@
 #include <string>
 #include <vector>
 #include <cassert>
+#include <cstring>
 #include "ie_parallel.hpp"
+#include "precision_utils.h"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -61,37 +63,46 @@ public:
             for (size_t i = 0; i < src_dims.size(); i++)
                 src_o_dms.push_back(src_dims[i] + pads_begin[i]);
 
+            int8ChannelsLast = false;
             addConfig(layer, { DataConfigurator(ConfLayout::PLN) }, { DataConfigurator(ConfLayout::PLN) });
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
     }
 
-    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
-        const float *src_data = inputs[0]->cbuffer().as<const float *>() +
-            inputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-        float* dst_data = outputs[0]->cbuffer().as<float *>() +
-            outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-
-        switch (padMode) {
-            case CONSTANT:
-                pad_constant(src_data, dst_data);
-                break;
-            case EDGE:
-                pad_edge(src_data, dst_data);
-                break;
-            case REFLECT:
-                pad_reflect(src_data, dst_data);
-                break;
-            case SYMMETRIC:
-                pad_symmetric(src_data, dst_data);
-                break;
-            default:
-                return GENERAL_ERROR;
+    StatusCode init(LayerConfig& config, ResponseDesc *resp) noexcept override {
+        StatusCode rc = ExtLayerBase::init(config, resp);
+        if (rc != OK)
+            return rc;
+
+        const Precision dataPrecision = config.inConfs[0].desc.getPrecision();
+        kernel = selectByElementSize<PadKernel>(dataPrecision.size());
+        //  The constant is stored in the precision of the data, so the kernel only copies its bits
+        switch (dataPrecision) {
+            case Precision::FP32: setPadValue(pad_value); break;
+            case Precision::FP16: setPadValue(PrecisionUtils::f32tof16(pad_value)); break;
+            case Precision::I32: setPadValue(static_cast<int32_t>(pad_value)); break;
+            case Precision::I16: setPadValue(static_cast<int16_t>(pad_value)); break;
+            case Precision::U16: setPadValue(static_cast<uint16_t>(pad_value)); break;
+            case Precision::I8: setPadValue(static_cast<int8_t>(pad_value)); break;
+            case Precision::U8: setPadValue(static_cast<uint8_t>(pad_value)); break;
+            default: kernel = nullptr;
+        }
+        if (kernel == nullptr) {
+            if (resp) {
+                std::string errorMsg = "Unsupported 'data' input precision: " + std::string(dataPrecision.name());
+                errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+            }
+            return GENERAL_ERROR;
         }
         return OK;
     }
 
+    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
+        kernel(*this, inputs[0], outputs[0]);
+        return OK;
+    }
+
 private:
     enum PadMode {
         CONSTANT = 0,
@@ -100,13 +111,52 @@ private:
         SYMMETRIC = 3
     };
 
-    void pad_constant(const float *src_data, float* dst_data);
-    void pad_edge(const float *src_data, float* dst_data);
-    void pad_reflect(const float *src_data, float* dst_data);
-    void pad_symmetric(const float *src_data, float* dst_data);
+    template <typename data_t>
+    struct PadKernel {
+        static void execute(const PadImpl& impl, const Blob::Ptr& input, const Blob::Ptr& output) {
+            const data_t *src_data = input->cbuffer().as<const data_t *>() +
+                input->getTensorDesc().getBlockingDesc().getOffsetPadding();
+            data_t* dst_data = output->buffer().as<data_t *>() +
+                output->getTensorDesc().getBlockingDesc().getOffsetPadding();
+
+            switch (impl.padMode) {
+                case CONSTANT: {
+                    data_t value;
+                    memcpy(&value, &impl.padValueBits, sizeof(data_t));
+                    impl.pad_constant(src_data, dst_data, value);
+                    break;
+                }
+                case EDGE:
+                    impl.pad_edge(src_data, dst_data);
+                    break;
+                case REFLECT:
+                    impl.pad_reflect(src_data, dst_data);
+                    break;
+                case SYMMETRIC:
+                    impl.pad_symmetric(src_data, dst_data);
+                    break;
+            }
+        }
+    };
+
+    template <typename data_t>
+    void pad_constant(const data_t *src_data, data_t* dst_data, data_t value) const;
+    template <typename data_t>
+    void pad_edge(const data_t *src_data, data_t* dst_data) const;
+    template <typename data_t>
+    void pad_reflect(const data_t *src_data, data_t* dst_data) const;
+    template <typename data_t>
+    void pad_symmetric(const data_t *src_data, data_t* dst_data) const;
+
+    template <typename value_t>
+    void setPadValue(value_t value) {
+        padValueBits = 0;
+        memcpy(&padValueBits, &value, sizeof(value_t));
+    }
 
     PadMode padMode = CONSTANT;
     float pad_value = 0.f;
+    uint64_t padValueBits = 0;
     SizeVector src_dims;
     SizeVector dst_dims;
     std::vector<unsigned int> pads_begin;
@@ -114,10 +164,12 @@ private:
     SizeVector srcStrides;
     SizeVector dstStrides;
     size_t work_amount;
+
+    decltype(&PadKernel<uint8_t>::execute) kernel = &PadKernel<ElementStorage<4>::type>::execute;
 };
 
 
-inline size_t parallel_init(size_t start, size_t size, std::vector<size_t> &counters, std::vector<size_t> &dims) {
+inline size_t parallel_init(size_t start, size_t size, std::vector<size_t> &counters, const std::vector<size_t> &dims) {
     for (int j = size - 1; j >= 0; j--) {
         counters[j] = start % dims[j];
         start = start / dims[j];
@@ -125,7 +177,7 @@ inline size_t parallel_init(size_t start, size_t size, std::vector<size_t> &coun
     return start;
 }
 
-inline void parallel_step(size_t size, std::vector<size_t> &counters, std::vector<size_t> &dims) {
+inline void parallel_step(size_t size, std::vector<size_t> &counters, const std::vector<size_t> &dims) {
     for (int j = size - 1; j >= 0; j--) {
         counters[j] = (counters[j] + 1) % dims[j];
         if (counters[j] != 0)
@@ -133,7 +185,8 @@ inline void parallel_step(size_t size, std::vector<size_t> &counters, std::vecto
     }
 }
 
-void PadImpl::pad_constant(const float *src_data, float* dst_data) {
+template <typename data_t>
+void PadImpl::pad_constant(const data_t *src_data, data_t* dst_data, data_t value) const {
     int offset = 0;
     for (size_t i = 0; i < srcStrides.size(); ++i)
         offset += pads_begin[i] * srcStrides[i];
@@ -152,7 +205,7 @@ void PadImpl::pad_constant(const float *src_data, float* dst_data) {
 
             for (size_t i = 0; i < counters.size(); ++i) {
                 if (counters[i] < pads_begin[i] || counters[i] >= src_o_dms[i]) {
-                    dst_data[dstIdx] = pad_value;
+                    dst_data[dstIdx] = value;
                     srcIdx = 0;
                     break;
                 }
@@ -168,7 +221,8 @@ void PadImpl::pad_constant(const float *src_data, float* dst_data) {
     });
 }
 
-void PadImpl::pad_edge(const float *src_data, float* dst_data) {
+template <typename data_t>
+void PadImpl::pad_edge(const data_t *src_data, data_t* dst_data) const {
     parallel_nt(0, [&](const int ithr, const int nthr) {
         size_t start = 0, end = 0;
         SizeVector counters(dst_dims.size(), 0);
@@ -193,7 +247,8 @@ void PadImpl::pad_edge(const float *src_data, float* dst_data) {
     });
 }
 
-void PadImpl::pad_reflect(const float *src_data, float* dst_data) {
+template <typename data_t>
+void PadImpl::pad_reflect(const data_t *src_data, data_t* dst_data) const {
     SizeVector src_2;
     for (size_t i = 0; i < src_dims.size(); i++)
         src_2.push_back(src_dims[i] + src_o_dms[i] - 2);
@@ -222,7 +277,8 @@ void PadImpl::pad_reflect(const float *src_data, float* dst_data) {
     });
 }
 
-void PadImpl::pad_symmetric(const float *src_data, float* dst_data) {
+template <typename data_t>
+void PadImpl::pad_symmetric(const data_t *src_data, data_t* dst_data) const {
     SizeVector src_2;
     for (size_t i = 0; i < src_dims.size(); i++)
         src_2.push_back(src_dims[i] + src_o_dms[i] - 1);
@@ -41,17 +41,12 @@ public:
             if (dst_dims.size() > 1)
                 THROW_IE_EXCEPTION << layer->name << " Output vector should have 1 dimension";
 
-            if (!(layer->insData[RANGE_START].lock()->getTensorDesc().getPrecision() == Precision::I32 &&
-                  layer->insData[RANGE_LIMIT].lock()->getTensorDesc().getPrecision() == Precision::I32 &&
-                  layer->insData[RANGE_DELTA].lock()->getTensorDesc().getPrecision() == Precision::I32 &&
-                  layer->outData[0]->getTensorDesc().getPrecision() == Precision::I32) &&
-                !(layer->insData[RANGE_START].lock()->getTensorDesc().getPrecision() == Precision::FP32 &&
-                  layer->insData[RANGE_LIMIT].lock()->getTensorDesc().getPrecision() == Precision::FP32 &&
-                  layer->insData[RANGE_DELTA].lock()->getTensorDesc().getPrecision() == Precision::FP32 &&
-                  layer->outData[0]->getTensorDesc().getPrecision() == Precision::FP32)) {
+            const Precision dst_precision = layer->outData[0]->getTensorDesc().getPrecision();
+            if (layer->insData[RANGE_START].lock()->getTensorDesc().getPrecision() != dst_precision ||
+                layer->insData[RANGE_LIMIT].lock()->getTensorDesc().getPrecision() != dst_precision ||
+                layer->insData[RANGE_DELTA].lock()->getTensorDesc().getPrecision() != dst_precision) {
                 THROW_IE_EXCEPTION << layer->name <<
-                    " 'Start', 'Limit', 'Delta' input scalars and output tensor should have same precision" <<
-                    "and only FP32 and I32 are supported!";
+                    " 'Start', 'Limit', 'Delta' input scalars and output tensor should have same precision!";
             }
 
             addConfig(layer, { DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN) },
@@ -61,34 +56,25 @@ public:
         }
     }
 
-    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
-        StatusCode retcode = OK;
-        switch (outputs[0]->precision()) {
-        case Precision::FP32: {
-            retcode = range((inputs[RANGE_START]->cbuffer().as<float *>() +
-                             inputs[RANGE_START]->getTensorDesc().getBlockingDesc().getOffsetPadding())[0],
-                            (inputs[RANGE_LIMIT]->cbuffer().as<float *>() +
-                             inputs[RANGE_LIMIT]->getTensorDesc().getBlockingDesc().getOffsetPadding())[0],
-                            (inputs[RANGE_DELTA]->cbuffer().as<float *>() +
-                             inputs[RANGE_DELTA]->getTensorDesc().getBlockingDesc().getOffsetPadding())[0], outputs[0]);
-        }
-        break;
-        case Precision::I32: {
-            retcode = range((inputs[RANGE_START]->cbuffer().as<int32_t *>() +
-                             inputs[RANGE_START]->getTensorDesc().getBlockingDesc().getOffsetPadding())[0],
-                            (inputs[RANGE_LIMIT]->cbuffer().as<int32_t *>() +
-                             inputs[RANGE_LIMIT]->getTensorDesc().getBlockingDesc().getOffsetPadding())[0],
-                            (inputs[RANGE_DELTA]->cbuffer().as<int32_t *>() +
-                             inputs[RANGE_DELTA]->getTensorDesc().getBlockingDesc().getOffsetPadding())[0], outputs[0]);
-        }
-        break;
-        default:
+    StatusCode init(LayerConfig& config, ResponseDesc *resp) noexcept override {
+        StatusCode rc = ExtLayerBase::init(config, resp);
+        if (rc != OK)
+            return rc;
+
+        const Precision dstPrecision = config.outConfs[0].desc.getPrecision();
+        kernel = selectByPrecision<RangeKernel>(dstPrecision);
+        if (kernel == nullptr) {
             if (resp) {
-                std::string errorMsg = "Incorrect output precision. Only FP32 and I32 are supported!";
+                std::string errorMsg = "Unsupported output precision: " + std::string(dstPrecision.name());
                 errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
             }
-            retcode = GENERAL_ERROR;
+            return GENERAL_ERROR;
         }
+        return OK;
+    }
+
+    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
+        StatusCode retcode = kernel(inputs, outputs[0]);
         if (resp && retcode == PARAMETER_MISMATCH) {
             std::string errorMsg = "Range indexes exceeds data tensor dimension";
             errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
@@ -97,12 +83,27 @@ public:
     }
 
 private:
-    const size_t RANGE_START = 0;
-    const size_t RANGE_LIMIT = 1;
-    const size_t RANGE_DELTA = 2;
+    static const size_t RANGE_START = 0;
+    static const size_t RANGE_LIMIT = 1;
+    static const size_t RANGE_DELTA = 2;
 
     template <typename data_t>
-    StatusCode range(data_t start, data_t limit, data_t delta, Blob::Ptr output);
+    static data_t scalar(const Blob::Ptr& input) {
+        return (input->cbuffer().as<const data_t *>() + input->getTensorDesc().getBlockingDesc().getOffsetPadding())[0];
+    }
+
+    template <typename data_t>
+    static StatusCode range(data_t start, data_t limit, data_t delta, Blob::Ptr output);
+
+    template <typename data_t>
+    struct RangeKernel {
+        static StatusCode execute(const std::vector<Blob::Ptr>& inputs, Blob::Ptr output) {
+            return range(scalar<data_t>(inputs[RANGE_START]), scalar<data_t>(inputs[RANGE_LIMIT]),
+                         scalar<data_t>(inputs[RANGE_DELTA]), output);
+        }
+    };
+
+    decltype(&RangeKernel<float>::execute) kernel = &RangeKernel<float>::execute;
 };
 
 template <typename data_t>
@@ -43,8 +43,10 @@ public:
             auto blk_layout = ConfLayout::BLK8;
 #endif
             addConfig(layer, {DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
-            if (type == "caffe.ResampleParameter.NEAREST")
+            if (type == "caffe.ResampleParameter.NEAREST") {
                 addConfig(layer, {DataConfigurator(blk_layout)}, {DataConfigurator(blk_layout)});
+                addConfig(layer, {DataConfigurator(ConfLayout::NSPC)}, {DataConfigurator(ConfLayout::NSPC)});
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -109,7 +111,10 @@ public:
                 if (layout == NCHW) {
                     NearestNeighborKernel_PLN(src_data, dst_data, IN, IC, IH, IW, fx, fy, OH, OW);
                 } else {
-                    NearestNeighborKernel_BLK(src_data, dst_data, IN, IC, IH, IW, fx, fy, OH, OW);
+                    // NHWC is handled as a single block holding all the channels
+                    int blk_size = layout == NHWC ? static_cast<int>(IC) :
+                                   static_cast<int>(inputs[0]->getTensorDesc().getBlockingDesc().getBlockDims().back());
+                    NearestNeighborKernel_BLK(src_data, dst_data, IN, IC, IH, IW, fx, fy, OH, OW, blk_size);
                 }
             }
         } else if (type == "caffe.ResampleParameter.LINEAR") {
@@ -204,32 +209,30 @@ private:
         }
     }
 
-    static void NearestNeighborKernel_BLK(const float *in_ptr_, float *out_ptr_, int B, int C, int IH, int IW, float fx, float fy, int OH, int OW) {
-        int blk_size = 8;
+    static void NearestNeighborKernel_BLK(const float *in_ptr_, float *out_ptr_, int B, int C, int IH, int IW, float fx, float fy, int OH, int OW,
+                                          int blk_size) {
         int CB = div_up(C, blk_size);
 
-        for (int b = 0; b < B; b++) {
-            for (int cb = 0; cb < CB; cb++) {
-                const float *in_ptr = in_ptr_ + IW * IH * CB * blk_size * b + IW * IH * cb * blk_size;
-                float *out_ptr = out_ptr_ + OW * OH * CB * blk_size * b + OW * OH * cb * blk_size;
+        parallel_for2d(B, CB, [&](int b, int cb) {
+            const float *in_ptr = in_ptr_ + IW * IH * CB * blk_size * b + IW * IH * cb * blk_size;
+            float *out_ptr = out_ptr_ + OW * OH * CB * blk_size * b + OW * OH * cb * blk_size;
 
-                for (int oy = 0; oy < OH; oy++) {
-                    for (int ox = 0; ox < OW; ox++) {
-                        float ix = ox * fx + fy / 2.0f - 0.5f;
-                        float iy = oy * fy + fx / 2.0f - 0.5f;
+            for (int oy = 0; oy < OH; oy++) {
+                for (int ox = 0; ox < OW; ox++) {
+                    float ix = ox * fx + fy / 2.0f - 0.5f;
+                    float iy = oy * fy + fx / 2.0f - 0.5f;
 
-                        size_t ix_r = static_cast<size_t>(round(ix));
-                        size_t iy_r = static_cast<size_t>(round(iy));
+                    size_t ix_r = static_cast<size_t>(round(ix));
+                    size_t iy_r = static_cast<size_t>(round(iy));
 
-                        for (int c = 0; c < blk_size; c++) {
-                            float value = in_ptr[iy_r * IW * blk_size + ix_r * blk_size + c];
+                    for (int c = 0; c < blk_size; c++) {
+                        float value = in_ptr[iy_r * IW * blk_size + ix_r * blk_size + c];
 
-                            out_ptr[oy * OW * blk_size + ox * blk_size + c] = value;
-                        }
+                        out_ptr[oy * OW * blk_size + ox * blk_size + c] = value;
                     }
                 }
             }
-        }
+        });
     }
 
     template <typename T, int factor>
@@ -60,104 +60,54 @@ public:
             srcStrides = layer->insData[REVERSESEQUENCE_DATA].lock()->getTensorDesc().getBlockingDesc().getStrides();
             work_amount_dst = srcStrides[0] * src_dims[0];
 
+            int8ChannelsLast = false;
             addConfig(layer, { DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN) }, { DataConfigurator(ConfLayout::PLN) });
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
     }
 
-    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
-        size_t i;
-        const float *src_data = inputs[REVERSESEQUENCE_DATA]->cbuffer().as<const float *>() +
-                                inputs[REVERSESEQUENCE_DATA]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-        float* dst_data = outputs[0]->cbuffer().as<float *>() +
-                          outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-
-        switch (inputs[REVERSESEQUENCE_LENGTHS]->precision()) {
-            case Precision::FP32: {
-                float *seq_lengths_data = inputs[REVERSESEQUENCE_LENGTHS]->cbuffer().as<float *>() +
-                                          inputs[REVERSESEQUENCE_LENGTHS]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-                for (i = 0; i < src_dims[batch_axis]; i++) {
-                    if (static_cast<int32_t>(seq_lengths_data[i]) > static_cast<int>(src_dims[seq_axis])) {
-                        if (resp) {
-                            std::string errorMsg = "Incorrect input 'seq_lengths' values!";
-                            errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
-                        }
-                        return PARAMETER_MISMATCH;
-                    }
-                }
-
-                parallel_nt(0, [&](const int ithr, const int nthr) {
-                    size_t i, start = 0, end = 0, src_idx = 0;
-                    SizeVector counters(src_dims.size(), 0);
-                    splitter(work_amount_dst, nthr, ithr, start, end);
-                    for (int j = src_dims.size() - 1, i = start; j >= 0; j--) {
-                        counters[j] = i % src_dims[j];
-                        i /= src_dims[j];
-                    }
-
-                    for (size_t iwork = start; iwork < end; ++iwork) {
-                        for (i = 0, src_idx = 0; i < src_dims.size(); ++i) {
-                            size_t idx = counters[i];
-                            if (static_cast<int>(i) == seq_axis &&
-                                    static_cast<int>(idx) < static_cast<int32_t>(seq_lengths_data[counters[batch_axis]])) {
-                                idx = static_cast<int32_t>(seq_lengths_data[counters[batch_axis]]) - idx - 1;
-                            }
-                            src_idx += idx * srcStrides[i];
-                        }
-                        dst_data[iwork] = src_data[src_idx];
-                        for (int j = src_dims.size() - 1; j >= 0; j--) {
-                            counters[j] = (counters[j] + 1) % src_dims[j];
-                            if (counters[j] != 0) break;
-                        }
-                    }
-                });
+    StatusCode init(LayerConfig& config, ResponseDesc *resp) noexcept override {
+        StatusCode rc = ExtLayerBase::init(config, resp);
+        if (rc != OK)
+            return rc;
+
+        const Precision dataPrecision = config.inConfs[REVERSESEQUENCE_DATA].desc.getPrecision();
+        kernel = selectByElementSize<ReverseSequenceKernel>(dataPrecision.size());
+        if (kernel == nullptr) {
+            if (resp) {
+                std::string errorMsg = "Unsupported 'data' input precision: " + std::string(dataPrecision.name());
+                errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
             }
-            break;
-            case Precision::I32: {
-                int32_t *seq_lengths_data = inputs[REVERSESEQUENCE_LENGTHS]->cbuffer().as<int32_t *>() +
-                                            inputs[REVERSESEQUENCE_LENGTHS]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-                for (i = 0; i < src_dims[batch_axis]; i++) {
-                    if (seq_lengths_data[i] > static_cast<int>(src_dims[seq_axis])) {
-                        if (resp) {
-                            std::string errorMsg = "Incorrect input 'seq_lengths' values!";
-                            errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
-                        }
-                        return PARAMETER_MISMATCH;
-                    }
-                }
-
-                parallel_nt(0, [&](const int ithr, const int nthr) {
-                    size_t i, start = 0, end = 0, src_idx = 0;
-                    SizeVector counters(src_dims.size(), 0);
-                    splitter(work_amount_dst, nthr, ithr, start, end);
-                    for (int j = src_dims.size() - 1, i = start; j >= 0; j--) {
-                        counters[j] = i % src_dims[j];
-                        i /= src_dims[j];
-                    }
+            return GENERAL_ERROR;
+        }
+        return OK;
+    }
 
-                    for (size_t iwork = start; iwork < end; ++iwork) {
-                        for (i = 0, src_idx = 0; i < src_dims.size(); ++i) {
-                            size_t idx = counters[i];
-                            if (static_cast<int>(i) == seq_axis &&
-                                    static_cast<int>(idx) < seq_lengths_data[counters[batch_axis]]) {
-                                idx = seq_lengths_data[counters[batch_axis]] - idx - 1;
-                            }
-                            src_idx += idx * srcStrides[i];
-                        }
-                        dst_data[iwork] = src_data[src_idx];
-                        for (int j = src_dims.size() - 1; j >= 0; j--) {
-                            counters[j] = (counters[j] + 1) % src_dims[j];
-                            if (counters[j] != 0) break;
-                        }
-                    }
-                });
-            }
-            break;
+    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
+        StatusCode rc = OK;
+        switch (inputs[REVERSESEQUENCE_LENGTHS]->precision()) {
+            case Precision::FP32:
+                rc = checkSeqLengths(inputs[REVERSESEQUENCE_LENGTHS]->cbuffer().as<const float *>() +
+                                     inputs[REVERSESEQUENCE_LENGTHS]->getTensorDesc().getBlockingDesc().getOffsetPadding());
+                break;
+            case Precision::I32:
+                rc = checkSeqLengths(inputs[REVERSESEQUENCE_LENGTHS]->cbuffer().as<const int32_t *>() +
+                                     inputs[REVERSESEQUENCE_LENGTHS]->getTensorDesc().getBlockingDesc().getOffsetPadding());
+                break;
             default:
                 return GENERAL_ERROR;
         }
 
+        if (rc != OK) {
+            if (resp) {
+                std::string errorMsg = "Incorrect input 'seq_lengths' values!";
+                errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+            }
+            return rc;
+        }
+
+        kernel(*this, inputs[REVERSESEQUENCE_DATA], inputs[REVERSESEQUENCE_LENGTHS], outputs[0]);
         return OK;
     }
 
@@ -170,6 +120,59 @@ private:
     SizeVector src_dims;
     SizeVector srcStrides;
     size_t work_amount_dst;
+
+    template <typename data_t>
+    struct ReverseSequenceKernel {
+        static void execute(const ReverseSequenceImpl& impl, const Blob::Ptr& data, const Blob::Ptr& lengths, const Blob::Ptr& output) {
+            const data_t *src_data = data->cbuffer().as<const data_t *>() + data->getTensorDesc().getBlockingDesc().getOffsetPadding();
+            data_t *dst_data = output->buffer().as<data_t *>() + output->getTensorDesc().getBlockingDesc().getOffsetPadding();
+            size_t lengths_offset = lengths->getTensorDesc().getBlockingDesc().getOffsetPadding();
+            if (lengths->precision() == Precision::FP32)
+                impl.reverse(src_data, lengths->cbuffer().as<const float *>() + lengths_offset, dst_data);
+            else
+                impl.reverse(src_data, lengths->cbuffer().as<const int32_t *>() + lengths_offset, dst_data);
+        }
+    };
+
+    decltype(&ReverseSequenceKernel<uint8_t>::execute) kernel = &ReverseSequenceKernel<ElementStorage<4>::type>::execute;
+
+    template <typename length_t>
+    StatusCode checkSeqLengths(const length_t *seq_lengths_data) const {
+        for (size_t i = 0; i < src_dims[batch_axis]; i++) {
+            if (static_cast<int32_t>(seq_lengths_data[i]) > static_cast<int>(src_dims[seq_axis]))
+                return PARAMETER_MISMATCH;
+        }
+        return OK;
+    }
+
+    template <typename data_t, typename length_t>
+    void reverse(const data_t *src_data, const length_t *seq_lengths_data, data_t *dst_data) const {
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t i, start = 0, end = 0, src_idx = 0;
+            SizeVector counters(src_dims.size(), 0);
+            splitter(work_amount_dst, nthr, ithr, start, end);
+            for (int j = src_dims.size() - 1, i = start; j >= 0; j--) {
+                counters[j] = i % src_dims[j];
+                i /= src_dims[j];
+            }
+
+            for (size_t iwork = start; iwork < end; ++iwork) {
+                for (i = 0, src_idx = 0; i < src_dims.size(); ++i) {
+                    size_t idx = counters[i];
+                    if (static_cast<int>(i) == seq_axis &&
+                            static_cast<int>(idx) < static_cast<int32_t>(seq_lengths_data[counters[batch_axis]])) {
+                        idx = static_cast<int32_t>(seq_lengths_data[counters[batch_axis]]) - idx - 1;
+                    }
+                    src_idx += idx * srcStrides[i];
+                }
+                dst_data[iwork] = src_data[src_idx];
+                for (int j = src_dims.size() - 1; j >= 0; j--) {
+                    counters[j] = (counters[j] + 1) % src_dims[j];
+                    if (counters[j] != 0) break;
+                }
+            }
+        });
+    }
 };
 
 REG_FACTORY_FOR(ImplFactory<ReverseSequenceImpl>, ReverseSequence);
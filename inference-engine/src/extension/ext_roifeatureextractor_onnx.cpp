@@ -129,104 +129,99 @@ void pre_calc_for_bilinear_interpolate(
   }
 }
 
+// Computes the pooled features of a single ROI. The feature map may be planar (blk_size == 1)
+// or blocked by channels (nChw8c/nChw16c), in the latter case the channels of a block are
+// accumulated together, since they are contiguous in memory.
 template <typename T>
 void ROIAlignForward_cpu_kernel(
-    const int nthreads,
     const T* bottom_data,
     const T& spatial_scale,
     const int channels,
     const int height,
     const int width,
+    const int blk_size,
     const int pooled_height,
     const int pooled_width,
     const int sampling_ratio,
     const T* bottom_rois,
-    T* top_data) {
-  int roi_cols = 4;
-
-  int n_rois = nthreads / channels / pooled_width / pooled_height;
-  // (n, c, ph, pw) is an element in the pooled output
-  parallel_for(n_rois, [&](size_t n) {
-    int index_n = n * channels * pooled_width * pooled_height;
-
-    // roi could have 4 or 5 columns
-    const T* offset_bottom_rois = bottom_rois + n * roi_cols;
-    int roi_batch_ind = 0;
-    if (roi_cols == 5) {
-      roi_batch_ind = static_cast<int>(offset_bottom_rois[0]);
-      offset_bottom_rois++;
-    }
-
-    // Do not using rounding; this implementation detail is critical
-    T roi_start_w = offset_bottom_rois[0] * spatial_scale;
-    T roi_start_h = offset_bottom_rois[1] * spatial_scale;
-    T roi_end_w = offset_bottom_rois[2] * spatial_scale;
-    T roi_end_h = offset_bottom_rois[3] * spatial_scale;
-
-    // Force malformed ROIs to be 1x1
-    T roi_width = std::max(roi_end_w - roi_start_w, (T)1.);
-    T roi_height = std::max(roi_end_h - roi_start_h, (T)1.);
-    T bin_size_h = static_cast<T>(roi_height) / static_cast<T>(pooled_height);
-    T bin_size_w = static_cast<T>(roi_width) / static_cast<T>(pooled_width);
-
-    // We use roi_bin_grid to sample the grid and mimic integral
-    int roi_bin_grid_h = (sampling_ratio > 0)
-        ? sampling_ratio
-        : static_cast<int>(ceil(roi_height / pooled_height));  // e.g., = 2
-    int roi_bin_grid_w =
-        (sampling_ratio > 0) ? sampling_ratio : static_cast<int>(ceil(roi_width / pooled_width));
-
-    // We do average (integral) pooling inside a bin
-    const T count = static_cast<T>(roi_bin_grid_h * roi_bin_grid_w);  // e.g. = 4
-
-    // we want to precalculate indeces and weights shared by all chanels,
-    // this is the key point of optimiation
-    std::vector<PreCalc<T>> pre_calc(
-        roi_bin_grid_h * roi_bin_grid_w * pooled_width * pooled_height);
-    pre_calc_for_bilinear_interpolate(
-        height,
-        width,
-        pooled_height,
-        pooled_width,
-        roi_bin_grid_h,
-        roi_bin_grid_w,
-        roi_start_h,
-        roi_start_w,
-        bin_size_h,
-        bin_size_w,
-        roi_bin_grid_h,
-        roi_bin_grid_w,
-        pre_calc);
-
-    for (int c = 0; c < channels; c++) {
-      int index_n_c = index_n + c * pooled_width * pooled_height;
-      const T* offset_bottom_data =
-          bottom_data + (roi_batch_ind * channels + c) * height * width;
-      int pre_calc_index = 0;
-
-      for (int ph = 0; ph < pooled_height; ph++) {
-        for (int pw = 0; pw < pooled_width; pw++) {
-          int index = index_n_c + ph * pooled_width + pw;
-
-          T output_val = 0.;
-          for (int iy = 0; iy < roi_bin_grid_h; iy++) {
-            for (int ix = 0; ix < roi_bin_grid_w; ix++) {
-              PreCalc<T> pc = pre_calc[pre_calc_index];
-              output_val += pc.w1 * offset_bottom_data[pc.pos1] +
-                  pc.w2 * offset_bottom_data[pc.pos2] +
-                  pc.w3 * offset_bottom_data[pc.pos3] +
-                  pc.w4 * offset_bottom_data[pc.pos4];
-
-              pre_calc_index += 1;
+    T* top_data,
+    std::vector<PreCalc<T>>& pre_calc) {
+  const int max_blk_size = 16;
+  assert(blk_size <= max_blk_size);
+
+  // Do not using rounding; this implementation detail is critical
+  T roi_start_w = bottom_rois[0] * spatial_scale;
+  T roi_start_h = bottom_rois[1] * spatial_scale;
+  T roi_end_w = bottom_rois[2] * spatial_scale;
+  T roi_end_h = bottom_rois[3] * spatial_scale;
+
+  // Force malformed ROIs to be 1x1
+  T roi_width = std::max(roi_end_w - roi_start_w, (T)1.);
+  T roi_height = std::max(roi_end_h - roi_start_h, (T)1.);
+  T bin_size_h = static_cast<T>(roi_height) / static_cast<T>(pooled_height);
+  T bin_size_w = static_cast<T>(roi_width) / static_cast<T>(pooled_width);
+
+  // We use roi_bin_grid to sample the grid and mimic integral
+  int roi_bin_grid_h = (sampling_ratio > 0)
+      ? sampling_ratio
+      : static_cast<int>(ceil(roi_height / pooled_height));  // e.g., = 2
+  int roi_bin_grid_w =
+      (sampling_ratio > 0) ? sampling_ratio : static_cast<int>(ceil(roi_width / pooled_width));
+
+  // We do average (integral) pooling inside a bin
+  const T count = static_cast<T>(roi_bin_grid_h * roi_bin_grid_w);  // e.g. = 4
+
+  // we want to precalculate indeces and weights shared by all chanels,
+  // this is the key point of optimiation
+  pre_calc.resize(roi_bin_grid_h * roi_bin_grid_w * pooled_width * pooled_height);
+  pre_calc_for_bilinear_interpolate(
+      height,
+      width,
+      pooled_height,
+      pooled_width,
+      roi_bin_grid_h,
+      roi_bin_grid_w,
+      roi_start_h,
+      roi_start_w,
+      bin_size_h,
+      bin_size_w,
+      roi_bin_grid_h,
+      roi_bin_grid_w,
+      pre_calc);
+
+  const int channel_blocks = (channels + blk_size - 1) / blk_size;
+  const int pooled_size = pooled_width * pooled_height;
+  for (int cb = 0; cb < channel_blocks; cb++) {
+    const T* offset_bottom_data = bottom_data + cb * height * width * blk_size;
+    const int block_channels = std::min(blk_size, channels - cb * blk_size);
+    T* offset_top_data = top_data + cb * blk_size * pooled_size;
+    int pre_calc_index = 0;
+
+    for (int ph = 0; ph < pooled_height; ph++) {
+      for (int pw = 0; pw < pooled_width; pw++) {
+        T output_val[max_blk_size] = {};
+        for (int iy = 0; iy < roi_bin_grid_h; iy++) {
+          for (int ix = 0; ix < roi_bin_grid_w; ix++) {
+            const PreCalc<T>& pc = pre_calc[pre_calc_index];
+            const T* data1 = offset_bottom_data + pc.pos1 * blk_size;
+            const T* data2 = offset_bottom_data + pc.pos2 * blk_size;
+            const T* data3 = offset_bottom_data + pc.pos3 * blk_size;
+            const T* data4 = offset_bottom_data + pc.pos4 * blk_size;
+            for (int c = 0; c < block_channels; c++) {
+              output_val[c] += pc.w1 * data1[c] + pc.w2 * data2[c] +
+                  pc.w3 * data3[c] + pc.w4 * data4[c];
             }
+
+            pre_calc_index += 1;
           }
-          output_val /= count;
+        }
 
-          top_data[index] = output_val;
-        }  // for pw
-      }  // for ph
-    }  // for c
-  });
+        for (int c = 0; c < block_channels; c++) {
+          offset_top_data[c * pooled_size + ph * pooled_width + pw] = output_val[c] / count;
+        }
+      }  // for pw
+    }  // for ph
+  }  // for cb
 }
 
 
@@ -255,59 +250,6 @@ void redistribute_rois(const float* rois, int* level_ids,
 }
 
 
-void reorder(const float* src_data, const int* ranks, const int n, const int step, float* dst_data,
-             int* dst_mapping) {
-    std::iota(dst_mapping, dst_mapping + n, 0);
-    std::sort(dst_mapping, dst_mapping + n, [&ranks](size_t i1, size_t i2) {return ranks[i1] < ranks[i2];});
-    for (int i = 0; i < n; ++i) {
-        const int j = dst_mapping[i];
-        assert(0 <= j && j < n);
-        std::memcpy(dst_data + i * step, src_data + j * step, sizeof(float) * step);
-    }
-}
-
-void split_points(const std::vector<int>& ids, std::vector<int>& rois_per_level, const int levels_num) {
-    rois_per_level.clear();
-    rois_per_level.resize(levels_num, 0);
-    for (size_t i = 0; i < ids.size(); ++i) {
-        assert(0 <= ids[i] && ids[i] < levels_num);
-        rois_per_level[ids[i]]++;
-    }
-    for (int i = 1; i < levels_num; ++i) {
-        rois_per_level[i] += rois_per_level[i - 1];
-    }
-    rois_per_level.insert(rois_per_level.begin(), 0);
-}
-
-
-void reorder_rois(const float *rois, const int* ids, int* mapping, const int rois_num,
-                  float * reordered_rois, std::vector<int>& rois_per_level, const int levels_num) {
-    rois_per_level.clear();
-    rois_per_level.resize(levels_num, 0);
-    for (int i = 0; i < rois_num; ++i) {
-        assert(0 <= ids[i] && ids[i] < levels_num);
-        rois_per_level[ids[i]]++;
-    }
-    for (int i = 1; i < levels_num; ++i) {
-        rois_per_level[i] += rois_per_level[i - 1];
-    }
-    rois_per_level.insert(rois_per_level.begin(), 0);
-
-    std::vector<int> level_counter = rois_per_level;
-
-    for (int i = 0; i < rois_num; ++i) {
-        const int level = ids[i];
-        assert(level < levels_num);
-        const int j = level_counter[level];
-        assert(0 <= j && j < rois_num);
-        reordered_rois[j * 4 + 0] = rois[i * 4 + 0];
-        reordered_rois[j * 4 + 1] = rois[i * 4 + 1];
-        reordered_rois[j * 4 + 2] = rois[i * 4 + 2];
-        reordered_rois[j * 4 + 3] = rois[i * 4 + 3];
-        level_counter[level]++;
-    }
-}
-
 class ExperimentalDetectronROIFeatureExtractorImpl: public ExtLayerBase {
 private:
     const int INPUT_ROIS {0};
@@ -328,6 +270,21 @@ public:
             std::vector<DataConfigurator> inputs_layouts(layer->insData.size(), DataConfigurator(ConfLayout::PLN));
             std::vector<DataConfigurator> outputs_layouts(layer->outData.size(), DataConfigurator(ConfLayout::PLN));
             addConfig(layer, inputs_layouts, outputs_layouts);
+
+            // Feature maps usually come from convolutions, so they are accepted in the blocked layout as is
+#if defined(HAVE_AVX512F)
+            auto blk_layout = ConfLayout::BLK16;
+#else
+            auto blk_layout = ConfLayout::BLK8;
+#endif
+            bool blockedFeatures = true;
+            for (size_t i = INPUT_FEATURES_START; i < layer->insData.size(); i++)
+                blockedFeatures = blockedFeatures && isLayoutApplicable(blk_layout, layer->insData[i].lock()->getTensorDesc().getDims());
+            if (blockedFeatures) {
+                for (size_t i = INPUT_FEATURES_START; i < layer->insData.size(); i++)
+                    inputs_layouts[i] = DataConfigurator(blk_layout);
+                addConfig(layer, inputs_layouts, outputs_layouts);
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -350,38 +307,45 @@ public:
         std::vector<int> level_ids(num_rois, 0);
         redistribute_rois(input_rois, reinterpret_cast<int *>(&level_ids[0]), num_rois, levels_num);
 
-        std::vector<float> reordered_rois(4 * num_rois, 0);
-        std::vector<int> original_rois_mapping(num_rois, 0);
-        reorder(input_rois, &level_ids[0], num_rois, 4, &reordered_rois[0], &original_rois_mapping[0]);
-
-        std::vector<int> rois_per_level;
-        split_points(level_ids, rois_per_level, levels_num + 1);
-
-        std::vector<float> output_rois_features_temp(feaxels_per_roi * num_rois, 0);
+        std::vector<const float *> featuremaps(levels_num);
+        std::vector<int> featuremap_heights(levels_num), featuremap_widths(levels_num), featuremap_blocks(levels_num, 1);
         for (int i = 0; i < levels_num; ++i) {
-            const int level_rois_offset = rois_per_level[i];
-            const int level_rois_num = rois_per_level[i + 1] - level_rois_offset;
-            if (level_rois_num > 0) {
-                auto *featuremap = inputs[INPUT_FEATURES_START + i]->buffer().as<const float *>();
-                const int featuremap_height = inputs[INPUT_FEATURES_START + i]->getTensorDesc().getDims()[2];
-                const int featuremap_width = inputs[INPUT_FEATURES_START + i]->getTensorDesc().getDims()[3];
-                ROIAlignForward_cpu_kernel<float>(feaxels_per_roi * level_rois_num,
-                    featuremap,
-                    1.0f / pyramid_scales_[i],
+            const TensorDesc& desc = inputs[INPUT_FEATURES_START + i]->getTensorDesc();
+            featuremaps[i] = inputs[INPUT_FEATURES_START + i]->buffer().as<const float *>() + desc.getBlockingDesc().getOffsetPadding();
+            featuremap_heights[i] = desc.getDims()[2];
+            featuremap_widths[i] = desc.getDims()[3];
+            if (desc.getLayout() == Layout::BLOCKED)
+                featuremap_blocks[i] = static_cast<int>(desc.getBlockingDesc().getBlockDims().back());
+        }
+
+        // ROIs of all the levels are processed in one parallel loop and their features
+        // are stored directly to the place of the ROI in the output, no reordering needed
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            int start = 0, end = 0;
+            splitter(num_rois, nthr, ithr, start, end);
+            std::vector<PreCalc<float>> pre_calc;
+            for (int n = start; n < end; ++n) {
+                const int level = level_ids[n];
+                float *roi_features = output_rois_features + static_cast<size_t>(feaxels_per_roi) * n;
+                if (level >= levels_num) {
+                    std::fill_n(roi_features, feaxels_per_roi, 0.f);
+                    continue;
+                }
+                ROIAlignForward_cpu_kernel<float>(featuremaps[level],
+                    1.0f / pyramid_scales_[level],
                     channels_num,
-                    featuremap_height,
-                    featuremap_width,
+                    featuremap_heights[level],
+                    featuremap_widths[level],
+                    featuremap_blocks[level],
                     pooled_height_,
                     pooled_width_,
                     sampling_ratio_,
-                    &reordered_rois[4 * level_rois_offset],
-                    &output_rois_features_temp[feaxels_per_roi * level_rois_offset]);
+                    &input_rois[4 * n],
+                    roi_features,
+                    pre_calc);
             }
-        }
+        });
 
-        std::vector<int> dummy_mapping(num_rois, 0);
-        reorder(&output_rois_features_temp[0], &original_rois_mapping[0], num_rois, feaxels_per_roi,
-                output_rois_features, &dummy_mapping[0]);
         if (output_rois != nullptr) {
             std::memcpy(output_rois, input_rois, 4 * num_rois * sizeof(float));
         }
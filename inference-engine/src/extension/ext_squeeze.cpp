@@ -29,10 +29,6 @@ public:
             if (idx_dims.size() > 1)
                 THROW_IE_EXCEPTION << layer->name << " Index vector should be 1 dimension";
 
-            if (layer->insData[SQUEEZE_INDEXES].lock()->getTensorDesc().getPrecision() != Precision::I32 &&
-                layer->insData[SQUEEZE_INDEXES].lock()->getTensorDesc().getPrecision() != Precision::FP32)
-                THROW_IE_EXCEPTION << layer->name << " Incorrect 'indices_to_squeeze' input precision. Only FP32 and I32 are supported!";
-
             data_dims = layer->insData[SQUEEZE_DATA].lock()->getTensorDesc().getDims();
             SizeVector dst_dims = layer->outData[0]->getTensorDesc().getDims();
             if (data_dims.size() < dst_dims.size())
@@ -41,53 +37,57 @@ public:
             if (data_dims.size() <= idx_dims[0] && !(data_dims.size() == 1 && idx_dims[0] == 1))
                 THROW_IE_EXCEPTION << layer->name << " Incompatible number of data dimensions and indexes vector length!";
 
+            int8ChannelsLast = false;
             addConfig(layer, { { ConfLayout::PLN, false, 0 }, { ConfLayout::ANY, true } }, { { ConfLayout::PLN, false, 0 } });
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
     }
 
-    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
-        switch (inputs[SQUEEZE_INDEXES]->precision()) {
-        case Precision::FP32: {
-            float *idx_data = inputs[SQUEEZE_INDEXES]->cbuffer().as<float *>() +
-                              inputs[SQUEEZE_INDEXES]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-            for (size_t i = 0; i < idx_dims[0]; i++) {
-                float axis = idx_data[i];
-                if (axis < 0)
-                    axis += data_dims.size();
+    StatusCode init(LayerConfig& config, ResponseDesc *resp) noexcept override {
+        StatusCode rc = ExtLayerBase::init(config, resp);
+        if (rc != OK)
+            return rc;
 
-                if (axis > static_cast<int>(data_dims.size())) {
-                    if (resp) {
-                        std::string errorMsg = "Index to squeeze exceeds data tensor dimension";
-                        errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
-                    }
-                    return PARAMETER_MISMATCH;
-                } else if (data_dims[static_cast<int>(axis)] != 1) {
-                    if (resp) {
-                        std::string errorMsg = "Index to squeeze of data tensor dimension is not 1";
-                        errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
-                    }
-                    return PARAMETER_MISMATCH;
-                }
+        //  The data is squeezed in place, so only the validation of the indices depends on a precision
+        const Precision idxPrecision = config.inConfs[SQUEEZE_INDEXES].desc.getPrecision();
+        kernel = selectByPrecision<SqueezeKernel>(idxPrecision);
+        if (kernel == nullptr) {
+            if (resp) {
+                std::string errorMsg = "Unsupported 'indices_to_squeeze' input precision: " + std::string(idxPrecision.name());
+                errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
             }
+            return GENERAL_ERROR;
         }
-        break;
-        case Precision::I32: {
-            int32_t *idx_data = inputs[SQUEEZE_INDEXES]->cbuffer().as<int32_t *>() +
-                                inputs[SQUEEZE_INDEXES]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-            for (size_t i = 0; i < idx_dims[0]; i++) {
-                int32_t axis = idx_data[i];
+        return OK;
+    }
+
+    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
+        return kernel(*this, inputs[SQUEEZE_INDEXES], resp);
+    }
+
+private:
+    const size_t SQUEEZE_DATA = 0;
+    const size_t SQUEEZE_INDEXES = 1;
+
+    template <typename idx_t>
+    struct SqueezeKernel {
+        static StatusCode execute(const SqueezeImpl& impl, const Blob::Ptr& indexes, ResponseDesc *resp) {
+            const idx_t *idx_data = indexes->cbuffer().as<const idx_t *>() +
+                                    indexes->getTensorDesc().getBlockingDesc().getOffsetPadding();
+            const int rank = static_cast<int>(impl.data_dims.size());
+            for (size_t i = 0; i < impl.idx_dims[0]; i++) {
+                int axis = static_cast<int>(idx_data[i]);
                 if (axis < 0)
-                    axis += data_dims.size();
+                    axis += rank;
 
-                if (axis > static_cast<int>(data_dims.size())) {
+                if (axis < 0 || axis >= rank) {
                     if (resp) {
                         std::string errorMsg = "Index to squeeze exceeds data tensor dimension";
                         errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
                     }
                     return PARAMETER_MISMATCH;
-                } else if (data_dims[axis] != 1) {
+                } else if (impl.data_dims[axis] != 1) {
                     if (resp) {
                         std::string errorMsg = "Index to squeeze of data tensor dimension is not 1";
                         errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
@@ -95,25 +95,14 @@ public:
                     return PARAMETER_MISMATCH;
                 }
             }
+            return OK;
         }
-        break;
-        default:
-            if (resp) {
-                std::string errorMsg = "Incorrect 'indices_to_squeeze' input precision. Only FP32 and I32 are supported!";
-                errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
-            }
-            return GENERAL_ERROR;
-        }
-
-        return OK;
-    }
-
-private:
-    const size_t SQUEEZE_DATA = 0;
-    const size_t SQUEEZE_INDEXES = 1;
+    };
 
     SizeVector data_dims;
     SizeVector idx_dims;
+
+    decltype(&SqueezeKernel<float>::execute) kernel = &SqueezeKernel<int32_t>::execute;
 };
 
 REG_FACTORY_FOR(ImplFactory<SqueezeImpl>, Squeeze);
@@ -134,6 +134,7 @@ public:
 
             srcStrides = layer->insData[STRIDEDSLICE_DATA].lock()->getTensorDesc().getBlockingDesc().getStrides();
             dstStrides = layer->outData[0]->getTensorDesc().getBlockingDesc().getStrides();
+            int8ChannelsLast = false;
             if (layer->insData.size() == 1) {
                 addConfig(layer, { DataConfigurator(ConfLayout::PLN) }, { DataConfigurator(ConfLayout::PLN) });
             } else if (layer->insData.size() == 2) {
@@ -150,9 +151,24 @@ public:
         }
     }
 
+    StatusCode init(LayerConfig& config, ResponseDesc *resp) noexcept override {
+        StatusCode rc = ExtLayerBase::init(config, resp);
+        if (rc != OK)
+            return rc;
+
+        const Precision dataPrecision = config.inConfs[STRIDEDSLICE_DATA].desc.getPrecision();
+        kernel = selectByElementSize<StridedSliceKernel>(dataPrecision.size());
+        if (kernel == nullptr) {
+            if (resp) {
+                std::string errorMsg = "Unsupported 'data' input precision: " + std::string(dataPrecision.name());
+                errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+            }
+            return GENERAL_ERROR;
+        }
+        return OK;
+    }
+
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
-        const float *src_data = inputs[STRIDEDSLICE_DATA]->cbuffer().as<const float *>() +
-            inputs[STRIDEDSLICE_DATA]->getTensorDesc().getBlockingDesc().getOffsetPadding();
         int *begin = nullptr, *end = nullptr, *stride = nullptr;
         if (begin_dims.size())
             begin = inputs[STRIDEDSLICE_BEGIN]->cbuffer().as<int *>() + inputs[STRIDEDSLICE_BEGIN]->getTensorDesc().getBlockingDesc().getOffsetPadding();
@@ -160,8 +176,6 @@ public:
             end = inputs[STRIDEDSLICE_END]->cbuffer().as<int *>() + inputs[STRIDEDSLICE_END]->getTensorDesc().getBlockingDesc().getOffsetPadding();
         if (stride_dims.size())
             stride = inputs[STRIDEDSLICE_STRIDE]->cbuffer().as<int *>() + inputs[STRIDEDSLICE_STRIDE]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-        float* dst_data = outputs[0]->cbuffer().as<float *>() +
-            outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
 
         InferenceEngine::SizeVector src_dims = inputs[STRIDEDSLICE_DATA]->getTensorDesc().getDims();
         InferenceEngine::SizeVector srcStrides = inputs[STRIDEDSLICE_DATA]->getTensorDesc().getBlockingDesc().getStrides();
@@ -228,14 +242,7 @@ public:
                 return PARAMETER_MISMATCH;
         }
 
-        if (static_cast<int>(src_dims.size()) == max_dims && shrink_axis == 0 &&
-                stride_dms[stride_dms.size()-1] == 1 && stride_dms.size() > 1)
-            strided_slice_vp(src_data, dst_data);
-        else if (static_cast<int>(src_dims.size()) == max_dims && shrink_axis == 0)
-            strided_slice_p(src_data, dst_data);
-        else
-            strided_slice(src_data, dst_data, our_dims);
-
+        kernel(*this, inputs[STRIDEDSLICE_DATA], outputs[0], our_dims);
         return OK;
     }
 
@@ -245,9 +252,31 @@ private:
     const size_t STRIDEDSLICE_END = 2;
     const size_t STRIDEDSLICE_STRIDE = 3;
 
-    void strided_slice(const float *src_data, float* dst_data, std::vector<size_t> &dims);
-    void strided_slice_vp(const float *src_data, float* dst_data);
-    void strided_slice_p(const float *src_data, float* dst_data);
+    template <typename data_t>
+    struct StridedSliceKernel {
+        static void execute(const StridedSliceImpl& impl, const Blob::Ptr& input, const Blob::Ptr& output,
+                            const std::vector<size_t>& dims) {
+            const data_t *src_data = input->cbuffer().as<const data_t *>() +
+                input->getTensorDesc().getBlockingDesc().getOffsetPadding();
+            data_t* dst_data = output->buffer().as<data_t *>() +
+                output->getTensorDesc().getBlockingDesc().getOffsetPadding();
+
+            if (static_cast<int>(impl.src_dims.size()) == impl.max_dims && impl.shrink_axis == 0 &&
+                    impl.stride_dms[impl.stride_dms.size()-1] == 1 && impl.stride_dms.size() > 1)
+                impl.strided_slice_vp(src_data, dst_data);
+            else if (static_cast<int>(impl.src_dims.size()) == impl.max_dims && impl.shrink_axis == 0)
+                impl.strided_slice_p(src_data, dst_data);
+            else
+                impl.strided_slice(src_data, dst_data, dims);
+        }
+    };
+
+    template <typename data_t>
+    void strided_slice(const data_t *src_data, data_t* dst_data, const std::vector<size_t> &dims) const;
+    template <typename data_t>
+    void strided_slice_vp(const data_t *src_data, data_t* dst_data) const;
+    template <typename data_t>
+    void strided_slice_p(const data_t *src_data, data_t* dst_data) const;
 
     SizeVector begin_dims;
     SizeVector end_dims;
@@ -270,9 +299,12 @@ private:
     int bounds_size;
     int max_dims;
     int ellipsis_pos1, ellipsis_pos2;
+
+    decltype(&StridedSliceKernel<uint8_t>::execute) kernel = &StridedSliceKernel<ElementStorage<4>::type>::execute;
 };
 
-void StridedSliceImpl::strided_slice(const float *src_data, float* dst_data, std::vector<size_t> &dims) {
+template <typename data_t>
+void StridedSliceImpl::strided_slice(const data_t *src_data, data_t* dst_data, const std::vector<size_t> &dims) const {
     size_t work_amount_dst = dstStrides[0] * dst_dims[0];
     parallel_nt(0, [&](const int ithr, const int nthr) {
         int j;
@@ -303,7 +335,8 @@ void StridedSliceImpl::strided_slice(const float *src_data, float* dst_data, std
     });
 }
 
-void StridedSliceImpl::strided_slice_vp(const float *src_data, float* dst_data) {
+template <typename data_t>
+void StridedSliceImpl::strided_slice_vp(const data_t *src_data, data_t* dst_data) const {
     //  Vectorized copy
     size_t dims_size_1 = dst_dims.size() - 1;
     size_t dataLength = dst_dims[dims_size_1];
@@ -321,7 +354,7 @@ void StridedSliceImpl::strided_slice_vp(const float *src_data, float* dst_data)
         }
 
         for (size_t iwork = start, dst_idx = start * dataLength, i = 1; iwork < end; ++iwork, dst_idx += dataLength) {
-            memcpy(&dst_data[dst_idx], &src_data[src_idx], sizeof(float) * dataLength);
+            memcpy(&dst_data[dst_idx], &src_data[src_idx], sizeof(data_t) * dataLength);
             for (int j = dims_size_1 - 1; j >= 0; j--) {
                 counters[j]++;
                 if (counters[j] < dst_dims[j]) {
@@ -339,7 +372,8 @@ void StridedSliceImpl::strided_slice_vp(const float *src_data, float* dst_data)
     });
 }
 
-void StridedSliceImpl::strided_slice_p(const float *src_data, float* dst_data) {
+template <typename data_t>
+void StridedSliceImpl::strided_slice_p(const data_t *src_data, data_t* dst_data) const {
     size_t dims_size = dst_dims.size();
     size_t work_amount_dst = dstStrides[0] * dst_dims[0];
 
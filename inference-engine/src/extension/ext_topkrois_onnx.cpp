@@ -6,6 +6,8 @@
 #include "ext_base.hpp"
 #include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <numeric>
 #include <vector>
 
 
@@ -57,8 +59,10 @@ public:
 
         std::vector<size_t> idx(input_rois_num);
         iota(idx.begin(), idx.end(), 0);
-        // FIXME. partial_sort is enough here.
-        sort(idx.begin(), idx.end(), [&input_probs](size_t i1, size_t i2) {return input_probs[i1] > input_probs[i2];});
+        // Only the top rois have to be ordered, ties are resolved by the index to keep the result deterministic
+        std::partial_sort(idx.begin(), idx.begin() + top_rois_num, idx.end(), [&input_probs](size_t i1, size_t i2) {
+            return input_probs[i1] > input_probs[i2] || (input_probs[i1] == input_probs[i2] && i1 < i2);
+        });
 
         for (int i = 0; i < top_rois_num; ++i) {
             std::memcpy(output_rois + 4 * i, input_rois + 4 * idx[i], 4 * sizeof(float));
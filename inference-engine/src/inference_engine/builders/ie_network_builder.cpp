@@ -523,6 +523,7 @@ const std::shared_ptr<ICNNNetwork> Builder::convertToICNNNetwork(const INetwork:
                 std::make_shared<LayerConverter<InferenceEngine::ReshapeLayer>>("Flatten"),
                 std::make_shared<LayerConverter<InferenceEngine::TileLayer>>("Tile"),
                 std::make_shared<LayerConverter<InferenceEngine::PadLayer>>("Pad"),
+                std::make_shared<LayerConverter<InferenceEngine::GemmLayer>>("Gemm"),
                 std::make_shared<ActivationConverter>(),
                 std::make_shared<RNNSequenceConverter>(),
                 std::make_shared<LayerConverter<InferenceEngine::BatchNormalizationLayer>>("BatchNormalization"),
@@ -24,6 +24,7 @@
 #include "debug.h"
 #include <fstream>
 #include "ie_util_internal.hpp"
+#include "ie_layers_internal.hpp"
 #include <utility>
 
 
@@ -96,6 +97,37 @@ InferenceEngine::Blob::Ptr CNNStatisticHelper::getInputScale(CNNLayer::Ptr layer
                                 hasNegativeOutput(previousLayer->name) ? maxSign_ : maxUnsign_);
 }
 
+InferenceEngine::Blob::Ptr CNNStatisticHelper::getAsymmetricInputScale(CNNLayer::Ptr layer, Blob::Ptr& zeroPoint) const {
+    auto previousLayer = layer->insData[0].lock()->creatorLayer.lock();
+    size_t inputChannels = layer->insData[0].lock()->getTensorDesc().getDims()[1];
+    NetworkNodeStatsPtr stats = getStatistic(previousLayer);
+    if (stats->_minOutputs.size() != inputChannels || stats->_maxOutputs.size() != inputChannels) {
+        THROW_IE_EXCEPTION << "min and max sizes should be equal to input channels count for " << previousLayer->name;
+    }
+
+    std::shared_ptr<Data> iScaleData = std::shared_ptr<Data>(new Data("scale", { inputChannels }, Precision::FP32, Layout::C));
+    auto iScale = CreateBlobFromData(iScaleData);
+    iScale->allocate();
+    std::shared_ptr<Data> zeroPointData = std::shared_ptr<Data>(new Data("zero-point", { inputChannels }, Precision::FP32, Layout::C));
+    zeroPoint = CreateBlobFromData(zeroPointData);
+    zeroPoint->allocate();
+
+    float* iScaleMemory = static_cast<float*>(iScale->buffer());
+    float* zeroPointMemory = static_cast<float*>(zeroPoint->buffer());
+    for (size_t c = 0; c < inputChannels; c++) {
+        // the range always contains zero, so zero of the data is represented exactly
+        float minc = std::min(stats->_minOutputs[c], 0.f);
+        float maxc = std::max(stats->_maxOutputs[c], 0.f);
+
+        iScaleMemory[c] = (maxc - minc) / static_cast<float>(maxUnsign_);
+        if (fabs(iScaleMemory[c]) < 1e-7) {
+            iScaleMemory[c] = 1.0f;
+        }
+        zeroPointMemory[c] = std::min(std::round(-minc / iScaleMemory[c]), static_cast<float>(maxUnsign_));
+    }
+    return iScale;
+}
+
 InferenceEngine::Blob::Ptr CNNStatisticHelper::getOutputScale(CNNLayer::Ptr layer) const {
     // TODO(amalyshe) for now we are looking to precision on the data node
     size_t outputChannels = layer->outData[0]->getTensorDesc().getDims()[1];
@@ -111,6 +143,31 @@ InferenceEngine::Blob::Ptr CNNStatisticHelper::getOutputScale(CNNLayer::Ptr laye
                                 layer->outData[0]->getPrecision() == Precision::I8 ? maxSign_ : maxUnsign_);
 }
 
+InferenceEngine::Blob::Ptr CNNStatisticHelper::getRNNDataQParams(CNNLayer::Ptr layer) const {
+    auto previousLayer = layer->insData[0].lock()->creatorLayer.lock();
+    auto it = internalNodesStats_.find(getLatestInFuse(previousLayer)->name);
+    if (it == internalNodesStats_.end()) {
+        return nullptr;
+    }
+
+    // the hidden state is in [-1, 1] range and it is quantized by the same parameters as data
+    float minValue = -1.f, maxValue = 1.f;
+    for (auto v : it->second->_minOutputs) {
+        minValue = std::min(minValue, v);
+    }
+    for (auto v : it->second->_maxOutputs) {
+        maxValue = std::max(maxValue, v);
+    }
+
+    std::shared_ptr<Data> qparamsData = std::shared_ptr<Data>(new Data("qparams", { 2 }, Precision::FP32, Layout::C));
+    auto qparams = CreateBlobFromData(qparamsData);
+    qparams->allocate();
+    float* qparamsMemory = static_cast<float*>(qparams->buffer());
+    qparamsMemory[0] = static_cast<float>(maxUnsign_) / (maxValue - minValue);
+    qparamsMemory[1] = -minValue * qparamsMemory[0];
+    return qparams;
+}
+
 int CNNStatisticHelper::getMaxSignValue() const {
     return maxSign_;
 }
@@ -446,7 +503,8 @@ void CNNNetworkInt8Normalizer::AddLayerToCNNNetworkAfterData(DataPtr pData, CNNL
     }
 }
 
-void CNNNetworkInt8Normalizer::fillInScaleShift(ScaleShiftLayer* scshLayer, size_t c, float* weightsN, float* weightsD) {
+void CNNNetworkInt8Normalizer::fillInScaleShift(ScaleShiftLayer* scshLayer, size_t c, float* weightsN, float* weightsD,
+                                                float* shifts) {
     // Setting "scales"
     SizeVector weightsSize = { c };
     TensorDesc weightsDesc(Precision::FP32, weightsSize, InferenceEngine::C);
@@ -472,7 +530,7 @@ void CNNNetworkInt8Normalizer::fillInScaleShift(ScaleShiftLayer* scshLayer, size
     scshLayer->_biases->allocate();
     float * biasesData = scshLayer->_biases->buffer();
     for (size_t i = 0; i < c; i++) {
-        biasesData[i] = 0.f;  // Setting to constant "0"
+        biasesData[i] = shifts != nullptr ? shifts[i] : 0.f;
     }
 }
 
@@ -513,8 +571,12 @@ void CNNNetworkInt8Normalizer::AddScaleShiftBetween(CNNNetwork& net, const CNNLa
     }
 
     Blob::Ptr iScaleBlob = nullptr;
+    Blob::Ptr zeroPointBlob = nullptr;
     if (layer2->blobs.find("i-scale") != layer2->blobs.end()) {
         iScaleBlob = layer2->blobs["i-scale"];
+        if (layer2->blobs.find("i-zero-point") != layer2->blobs.end()) {
+            zeroPointBlob = layer2->blobs["i-zero-point"];
+        }
     }
 
     if (iScaleBlob == nullptr && oScaleBlob == nullptr) {
@@ -545,12 +607,17 @@ void CNNNetworkInt8Normalizer::AddScaleShiftBetween(CNNNetwork& net, const CNNLa
             if (scshLayer == nullptr) {
                 THROW_IE_EXCEPTION << "Layer " << ssCnnLayer->name << " is not instance of ScaleShiftLayer class";
             }
-            fillInScaleShift(scshLayer, c, oScaleBuffer, iScaleBuffer);
+            float *zeroPointBuffer = zeroPointBlob != nullptr ? static_cast<float*>(zeroPointBlob->buffer()) : nullptr;
+            fillInScaleShift(scshLayer, c, oScaleBuffer, iScaleBuffer, zeroPointBuffer);
         }
 
         Precision odPrecision = Precision::FP32;
         if (layer2->precision == Precision::I8) {
-            odPrecision = statHelper.hasNegativeOutput(layer1->name) ? Precision::I8 : Precision::U8;
+            if (zeroPointBlob != nullptr) {
+                odPrecision = Precision::U8;
+            } else {
+                odPrecision = statHelper.hasNegativeOutput(layer1->name) ? Precision::I8 : Precision::U8;
+            }
         }
         ssCnnLayer->outData[0]->setPrecision(odPrecision);
     }
@@ -795,9 +862,15 @@ void CNNNetworkInt8Normalizer::QuantizeConvolutionOrFullyConnected(CNNLayer::Ptr
     size_t inputChannels = convolution->insData[0].lock()->getTensorDesc().getDims()[1];
     size_t outputChannels = convolution->outData[0]->getTensorDesc().getDims()[1];
 
-    auto iScale = statHelper.getInputScale(convolution);
+    Blob::Ptr zeroPoint = nullptr;
+    Blob::Ptr iScale = isAsymmetricInputAllowed(convolution, statHelper)
+                       ? statHelper.getAsymmetricInputScale(convolution, zeroPoint)
+                       : statHelper.getInputScale(convolution);
 
     convolution->blobs["i-scale"] = iScale;
+    if (zeroPoint) {
+        convolution->blobs["i-zero-point"] = zeroPoint;
+    }
 
     Blob::Ptr weights = nullptr;
     Blob::Ptr biases = nullptr;
@@ -902,6 +975,56 @@ void CNNNetworkInt8Normalizer::QuantizeConvolutionOrFullyConnected(CNNLayer::Ptr
         const float *bias = static_cast<const float *>(biases->buffer());
         ScaleDataToInt(bias, biases->size(), int32biases, weightScalers);
     }
+
+    // The u8 input is shifted by zero-points, the convolution of the shift with the int8 weights
+    // is a constant per output channel, so it is subtracted from the int32 biases
+    if (zeroPoint && weights && biases) {
+        const int8_t *int8weight = static_cast<const int8_t *>(int8weights->buffer());
+        int32_t *int32bias = static_cast<int32_t *>(int32biases->buffer());
+        const float *zeroPointMemory = static_cast<const float *>(zeroPoint->buffer());
+
+        ConvolutionLayer *pConv = dynamic_cast<ConvolutionLayer *>(convolution.get());
+        size_t group = pConv != nullptr ? pConv->_group : 1;
+        size_t W_CO = outputChannels / group,
+        W_CI = inputChannels / group,
+        W_HW = weights->size() / W_CI / W_CO / group;
+        for (size_t g = 0; g < group; g++) {
+            for (size_t co = 0; co < W_CO; co++) {
+                int32_t compensation = 0;
+                for (size_t ci = 0; ci < W_CI; ci++) {
+                    size_t kernelBase = g * W_CO * W_CI * W_HW + co * W_CI * W_HW + ci * W_HW;
+                    int32_t zp = static_cast<int32_t>(zeroPointMemory[g * W_CI + ci]);
+                    for (size_t hw = 0; hw < W_HW; hw++) {
+                        compensation += int8weight[kernelBase + hw] * zp;
+                    }
+                }
+                int32bias[g * W_CO + co] -= compensation;
+            }
+        }
+    }
+}
+
+bool CNNNetworkInt8Normalizer::isAsymmetricInputAllowed(const CNNLayer::Ptr& layer, const CNNStatisticHelper& statHelper) {
+    if (layer->blobs.find("weights") == layer->blobs.end() || layer->blobs.find("biases") == layer->blobs.end()) {
+        return false;
+    }
+
+    // only the data converted from FP32 by ScaleShift can have zero-points
+    auto previousLayer = layer->insData[0].lock()->creatorLayer.lock();
+    if (!previousLayer || previousLayer->precision != Precision::FP32 || !statHelper.hasNegativeOutput(previousLayer->name)) {
+        return false;
+    }
+
+    ConvolutionLayer *pConv = dynamic_cast<ConvolutionLayer *>(layer.get());
+    if (pConv != nullptr) {
+        auto paddings = getPaddings(*pConv);
+        for (size_t i = 0; i < paddings.begin.size(); i++) {
+            if (paddings.begin[i] != 0 || paddings.end[i] != 0) {
+                return false;
+            }
+        }
+    }
+    return true;
 }
 
 bool CNNNetworkInt8Normalizer::layerProducesFloat(const CNNLayer::Ptr layer) {
@@ -919,6 +1042,18 @@ bool CNNNetworkInt8Normalizer::layerProducesFloat(const CNNLayer::Ptr layer) {
     return consumersFP32;
 }
 
+void CNNNetworkInt8Normalizer::QuantizeRNN(CNNLayer::Ptr rnn, CNNStatisticHelper& statHelper) {
+    auto qparams = statHelper.getRNNDataQParams(rnn);
+    if (qparams) {
+        rnn->blobs["rnn-data-qparams"] = qparams;
+    }
+}
+
+bool CNNNetworkInt8Normalizer::isQuantizableRNN(const CNNLayer::Ptr& layer) {
+    auto rnn = std::dynamic_pointer_cast<RNNCellBase>(layer);
+    return rnn && rnn->cellType == RNNCellBase::LSTM;
+}
+
 void CNNNetworkInt8Normalizer::returnTailToFP32(const CNNLayer::Ptr layer) {
     std::set<CNNLayer::Ptr> layersToReturn;
     if (layerProducesFloat(layer)) {
@@ -1019,6 +1154,15 @@ void CNNNetworkInt8Normalizer::DefinesExecutionPrecision(CNNNetwork &net, CNNSta
             continue;
         }
 
+        // Recurrent layers are converted to Int8 only if explicitly marked to,
+        // the precision of their inputs and outputs is not changed.
+        if (isQuantizableRNN(iter)) {
+            if (iter->params.find("quantization_level") != iter->params.end() && iter->params["quantization_level"] == "I8") {
+                QuantizeRNN(iter, statHelper);
+            }
+            continue;
+        }
+
         // Legacy: FullyConnected should not be converted to Int8,
         // if it isn't explicitly marked to.
         if (iter->params.find("quantization_level") == iter->params.end() && CaselessEq<std::string>()(iter->type, "fullyconnected")) {
@@ -1321,7 +1465,10 @@ void CNNNetworkInt8Normalizer::PropagateScaleFactors(CNNNetwork& net, const CNNS
                             // debug scales. Need to compare with actual values in FP32 scoring
                             l.second->blobs["ext-scale"] = l.second->blobs["o-scale"];
                             int8Consumers++;
-                        } else if (l.second->type == "Convolution") {
+                        } else if (CaselessEq<std::string>()(l.second->type, "Convolution") ||
+                                   CaselessEq<std::string>()(l.second->type, "FullyConnected")) {
+                            // int8 data is passed directly, the chains of convolutions and fully connected
+                            // layers do not return to FP32 between the layers
                             l.second->blobs.erase("i-scale");
                             int8Consumers++;
                         } else if (CaselessEq<std::string>()(l.second->type, "Eltwise")) {
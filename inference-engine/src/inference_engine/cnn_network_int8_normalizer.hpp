@@ -73,12 +73,27 @@ public:
      */
     InferenceEngine::Blob::Ptr getInputScale(CNNLayer::Ptr layer) const;
 
+    /**
+     * Returns input scale for asymmetric u8 quantization of the input of layer: the range [min, max]
+     * of every channel is mapped to [0, maxUnsign], u8 = data / scale + zero-point
+     * @param zeroPoint - blob with zero-points per channel, integer values stored as floats
+     * @return blob with scales per channel
+     */
+    InferenceEngine::Blob::Ptr getAsymmetricInputScale(CNNLayer::Ptr layer, InferenceEngine::Blob::Ptr& zeroPoint) const;
+
     /**
      * Returns output scale for layer based on statistic
      * @return blob with scales per channel
      */
     InferenceEngine::Blob::Ptr getOutputScale(CNNLayer::Ptr layer) const;
 
+    /**
+     * Returns parameters of u8 quantization of data and hidden state of recurrent layer based on
+     * statistic of its data input: u8 = data * scale + shift
+     * @return blob with scale and shift
+     */
+    InferenceEngine::Blob::Ptr getRNNDataQParams(CNNLayer::Ptr layer) const;
+
     /**
      * provides max signed value as the only place for synchronization with other algorithms in
      * normalizer which require this
@@ -159,7 +174,8 @@ public:
     }
 private:
     /** Helper function for filling of scaleshift weights for normalization of activation */
-    static void fillInScaleShift(ScaleShiftLayer* scshLayer, size_t c, float* weightsN, float* weightsD);
+    static void fillInScaleShift(ScaleShiftLayer* scshLayer, size_t c, float* weightsN, float* weightsD,
+                                 float* shifts = nullptr);
 
 public:
     /** main function for calling of quantization */
@@ -180,9 +196,26 @@ protected:
      * w-scale - multiplication on this scale of i8 convolution result will produce denormalized fp32
      * data
      * o-scale - multiplication on this scale will convert above denormalized fp32 to i8 for next layer
+     * i-zero-point - shift of u8 input quantized asymmetrically, it is subtracted from the biases
      */
     static void QuantizeConvolutionOrFullyConnected(CNNLayer::Ptr convolution, CNNStatisticHelper& statHelper);
 
+    /**
+     * Returns true if the input of the layer can be quantized to u8 with zero-points: the input is produced
+     * by FP32 layer and has negative values, the shift of zero-points can be compensated in biases.
+     * Convolutions with paddings are not allowed as the padded values would be zero-points after shift
+     */
+    static bool isAsymmetricInputAllowed(const CNNLayer::Ptr& layer, const CNNStatisticHelper& statHelper);
+
+    /**
+     * Recurrent layers keep FP32 inputs and outputs, data and weights are quantized inside of the layer.
+     * Adds rnn-data-qparams - scale and shift of u8 quantization of data and hidden state
+     */
+    static void QuantizeRNN(CNNLayer::Ptr rnn, CNNStatisticHelper& statHelper);
+
+    /** Returns true for recurrent layers which can be executed in int8 */
+    static bool isQuantizableRNN(const CNNLayer::Ptr& layer);
+
     /**  Adds ScaleShifts everywhere */
     static void AddScaleShifts(CNNNetwork& net, CNNStatisticHelper& statHelper);
 
@@ -13,6 +13,8 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <ie_isequences.hpp>
+#include <ie_executable_network_metrics.hpp>
 #include <cpp_interfaces/interface/ie_imemory_state_internal.hpp>
 #include <cpp_interfaces/base/ie_memory_state_base.hpp>
 #include "cpp_interfaces/exception2status.hpp"
@@ -24,7 +26,8 @@ namespace InferenceEngine {
  * @tparam T Minimal CPP implementation of IExecutableNetwork (e.g. ExecutableNetworkInternal)
  */
 template<class T>
-class ExecutableNetworkBase : public IExecutableNetwork {
+class ExecutableNetworkBase : public IExecutableNetwork, public ISequenceExecutableNetwork,
+                              public IMetricsExecutableNetwork {
     std::shared_ptr<T> _impl;
 
 public:
@@ -78,6 +81,14 @@ public:
         }
     }
 
+    StatusCode  ReleaseSequence(size_t sequenceId, ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->ReleaseSequence(sequenceId));
+    }
+
+    StatusCode  GetMetrics(ExecutableNetworkMetrics &metrics, bool reset, ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->GetMetrics(metrics, reset));
+    }
+
     void Release() noexcept override {
         delete this;
     }
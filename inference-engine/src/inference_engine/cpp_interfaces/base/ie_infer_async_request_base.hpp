@@ -8,6 +8,7 @@
 #include <map>
 #include <string>
 #include "ie_iinfer_request.hpp"
+#include "ie_isequences.hpp"
 #include "cpp_interfaces/exception2status.hpp"
 #include "ie_profiling.hpp"
 
@@ -18,7 +19,7 @@ namespace InferenceEngine {
  * @tparam T Minimal CPP implementation of IInferRequest (e.g. AsyncInferRequestThreadSafeDefault)
  */
 template<class T>
-class InferRequestBase : public IInferRequest {
+class InferRequestBase : public IInferRequest, public ISequenceInferRequest {
 protected:
     std::shared_ptr<T> _impl;
 
@@ -75,6 +76,10 @@ public:
         TO_STATUS(_impl->SetBatch(batch_size));
     }
 
+    StatusCode SetSequences(const std::vector<size_t> &sequenceIds, ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->SetSequences(sequenceIds));
+    }
+
 protected:
     ~InferRequestBase() = default;
 };
@@ -9,16 +9,26 @@
 
 namespace InferenceEngine {
 
+ExecutorManagerImpl::ExecutorManagerImpl() : spinTime(TaskExecutor::defaultSpinTimeUs) {}
+
 ITaskExecutor::Ptr ExecutorManagerImpl::getExecutor(std::string id) {
     auto foundEntry = executors.find(id);
     if (foundEntry == executors.end()) {
-        auto newExec = std::make_shared<TaskExecutor>(id);
+        auto newExec = std::make_shared<TaskExecutor>(id, spinTime);
         executors[id] = newExec;
         return newExec;
     }
     return foundEntry->second;
 }
 
+void ExecutorManagerImpl::setSpinTime(std::chrono::microseconds spinTime) {
+    this->spinTime = spinTime;
+}
+
+std::chrono::microseconds ExecutorManagerImpl::getSpinTime() const {
+    return spinTime;
+}
+
 // for tests purposes
 size_t ExecutorManagerImpl::getExecutorsNumber() {
     return executors.size();
@@ -34,6 +44,14 @@ ITaskExecutor::Ptr ExecutorManager::getExecutor(std::string id) {
     return _impl.getExecutor(id);
 }
 
+void ExecutorManager::setSpinTime(std::chrono::microseconds spinTime) {
+    _impl.setSpinTime(spinTime);
+}
+
+std::chrono::microseconds ExecutorManager::getSpinTime() const {
+    return _impl.getSpinTime();
+}
+
 size_t ExecutorManager::getExecutorsNumber() {
     return _impl.getExecutorsNumber();
 }
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <string>
 #include <unordered_map>
 #include "ie_api.h"
@@ -19,8 +20,14 @@ namespace InferenceEngine {
  */
 class ExecutorManagerImpl {
 public:
+    ExecutorManagerImpl();
+
     ITaskExecutor::Ptr getExecutor(std::string id);
 
+    void setSpinTime(std::chrono::microseconds spinTime);
+
+    std::chrono::microseconds getSpinTime() const;
+
     // for tests purposes
     size_t getExecutorsNumber();
 
@@ -28,6 +35,7 @@ public:
 
 private:
     std::unordered_map<std::string, ITaskExecutor::Ptr> executors;
+    std::chrono::microseconds spinTime;
 };
 
 /**
@@ -57,6 +65,16 @@ public:
      */
     ITaskExecutor::Ptr getExecutor(std::string id);
 
+    /**
+     * @brief Sets the time the threads of the task executors spin waiting for a new task before they park.
+     * Spinning cuts the latency of back-to-back requests at the cost of a busy core, 0 parks the threads immediately.
+     * It affects the executors created afterwards: by getExecutor and by the executable networks loaded later.
+     * @param spinTime time to spin, TaskExecutor::defaultSpinTimeUs by default
+     */
+    void setSpinTime(std::chrono::microseconds spinTime);
+
+    std::chrono::microseconds getSpinTime() const;
+
     // for tests purposes
     size_t getExecutorsNumber();
 
@@ -0,0 +1,138 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <ie_executable_network_metrics.hpp>
+#include <details/ie_log_linear_buckets.hpp>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Lock-free histogram of durations in microseconds, see details::LogLinearBuckets.
+ * The percentiles have the relative error 2^-subBucketBits at most.
+ */
+class DurationCollector {
+public:
+    DurationCollector() {
+        for (auto &bucket : _buckets)
+            bucket = 0;
+    }
+
+    void add(uint64_t us) {
+        _count.fetch_add(1, std::memory_order_relaxed);
+        _total.fetch_add(us, std::memory_order_relaxed);
+        _buckets[details::LogLinearBuckets::index(us, subBucketBits)].fetch_add(1, std::memory_order_relaxed);
+        uint64_t max = _max.load(std::memory_order_relaxed);
+        while (us > max && !_max.compare_exchange_weak(max, us, std::memory_order_relaxed)) {}
+    }
+
+    /**
+     * @brief Fills the metric in, the updates running concurrently with a reset are kept by either interval
+     */
+    void get(DurationMetric &metric, bool reset) {
+        uint64_t counts[bucketsCount];
+        metric.count = take(_count, reset);
+        metric.totalUs = take(_total, reset);
+        metric.maxUs = take(_max, reset);
+        uint64_t total = 0;
+        for (size_t i = 0; i < bucketsCount; i++) {
+            counts[i] = take(_buckets[i], reset);
+            total += counts[i];
+        }
+        metric.p50Us = percentile(counts, total, 50, metric.maxUs);
+        metric.p90Us = percentile(counts, total, 90, metric.maxUs);
+        metric.p99Us = percentile(counts, total, 99, metric.maxUs);
+    }
+
+private:
+    static constexpr unsigned subBucketBits = 3;
+    static constexpr size_t bucketsCount = details::LogLinearBuckets::count(subBucketBits);
+
+    static uint64_t take(std::atomic<uint64_t> &value, bool reset) {
+        return reset ? value.exchange(0, std::memory_order_relaxed) : value.load(std::memory_order_relaxed);
+    }
+
+    static uint64_t percentile(const uint64_t *counts, uint64_t total, unsigned p, uint64_t max) {
+        if (total == 0)
+            return 0;
+        uint64_t rank = (total * p + 99) / 100;
+        return details::LogLinearBuckets::valueAtRank(counts, subBucketBits, rank, max);
+    }
+
+    std::atomic<uint64_t> _count = {0};
+    std::atomic<uint64_t> _total = {0};
+    std::atomic<uint64_t> _max = {0};
+    std::atomic<uint64_t> _buckets[bucketsCount];
+};
+
+/**
+ * @brief Counters of an executable network shared by its requests and streams. All the updates are relaxed
+ * atomic operations, so the collector is cheap enough to be always enabled.
+ */
+class MetricsCollector {
+public:
+    using Ptr = std::shared_ptr<MetricsCollector>;
+    using Clock = std::chrono::steady_clock;
+
+    explicit MetricsCollector(size_t streams = 1) : _streamBusy(streams), _intervalStart(now()) {
+        for (auto &busy : _streamBusy)
+            busy = 0;
+    }
+
+    static uint64_t sinceUs(Clock::time_point start) {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count());
+    }
+
+    void addStreamBusy(size_t stream, uint64_t us) {
+        if (stream < _streamBusy.size())
+            _streamBusy[stream].fetch_add(us, std::memory_order_relaxed);
+    }
+
+    void get(ExecutableNetworkMetrics &metrics, bool reset) {
+        int64_t current = now();
+        int64_t start = reset ? _intervalStart.exchange(current) : _intervalStart.load();
+        metrics.intervalUs = static_cast<uint64_t>(std::max<int64_t>(current - start, 0));
+
+        metrics.requests = take(requests, reset);
+        metrics.failedRequests = take(failedRequests, reset);
+        queueWait.get(metrics.queueWait, reset);
+        execution.get(metrics.execution, reset);
+        preprocessing.get(metrics.preprocessing, reset);
+        metrics.inputCopyBytes = take(inputCopyBytes, reset);
+        metrics.outputCopyBytes = take(outputCopyBytes, reset);
+
+        metrics.streamBusyUs.resize(_streamBusy.size());
+        for (size_t i = 0; i < _streamBusy.size(); i++)
+            metrics.streamBusyUs[i] = take(_streamBusy[i], reset);
+    }
+
+    std::atomic<uint64_t> requests = {0};
+    std::atomic<uint64_t> failedRequests = {0};
+    DurationCollector queueWait;
+    DurationCollector execution;
+    DurationCollector preprocessing;
+    std::atomic<uint64_t> inputCopyBytes = {0};
+    std::atomic<uint64_t> outputCopyBytes = {0};
+
+private:
+    static int64_t now() {
+        return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now().time_since_epoch()).count();
+    }
+
+    static uint64_t take(std::atomic<uint64_t> &value, bool reset) {
+        return reset ? value.exchange(0, std::memory_order_relaxed) : value.load(std::memory_order_relaxed);
+    }
+
+    std::vector<std::atomic<uint64_t>> _streamBusy;
+    std::atomic<int64_t> _intervalStart;
+};
+
+}  // namespace InferenceEngine
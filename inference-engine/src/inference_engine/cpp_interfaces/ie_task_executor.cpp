@@ -8,7 +8,8 @@
 #include <mutex>
 #include <condition_variable>
 #include <thread>
-#include <queue>
+#include <atomic>
+#include <chrono>
 #include <ie_profiling.hpp>
 #include "details/ie_exception.hpp"
 #include "ie_task.hpp"
@@ -16,42 +17,31 @@
 
 namespace InferenceEngine {
 
-TaskExecutor::TaskExecutor(std::string name) : _isStopped(false), _name(name) {
+constexpr size_t TaskExecutor::queueCapacity;
+constexpr std::chrono::microseconds::rep TaskExecutor::defaultSpinTimeUs;
+
+TaskExecutor::TaskExecutor(std::string name, std::chrono::microseconds spinTime)
+        : _queue(queueCapacity), _enqueuePos(0), _dequeuePos(0), _spinTime(spinTime), _isParked(false),
+          _isStopped(false), _name(name) {
+    for (size_t i = 0; i < _queue.size(); i++)
+        _queue[i].sequence.store(i, std::memory_order_relaxed);
+
     _thread = std::make_shared<std::thread>([&] {
         anotateSetThreadName(("TaskExecutor thread for " + _name).c_str());
-        while (!_isStopped) {
-            bool isQueueEmpty;
-            Task::Ptr currentTask;
-            {  // waiting for the new task or for stop signal
-                std::unique_lock<std::mutex> lock(_queueMutex);
-                _queueCondVar.wait(lock, [&]() { return !_taskQueue.empty() || _isStopped; });
-                isQueueEmpty = _taskQueue.empty();
-                if (!isQueueEmpty) currentTask = _taskQueue.front();
-            }
-            if (_isStopped && isQueueEmpty)
-                break;
-            if (!isQueueEmpty) {
-                currentTask->runNoThrowNoBusyCheck();
-                std::unique_lock<std::mutex> lock(_queueMutex);
-                _taskQueue.pop();
-                isQueueEmpty = _taskQueue.empty();
-                if (isQueueEmpty) {
-                    // notify dtor, that all tasks were completed
-                    _queueCondVar.notify_all();
-                }
-            }
+        Task::Ptr currentTask;
+        // the tasks started before the stop are completed
+        while (waitTask(currentTask)) {
+            currentTask->runNoThrowNoBusyCheck();
+            currentTask = nullptr;
         }
     });
 }
 
 TaskExecutor::~TaskExecutor() {
     {
-        std::unique_lock<std::mutex> lock(_queueMutex);
-        if (!_taskQueue.empty()) {
-            _queueCondVar.wait(lock, [this]() { return _taskQueue.empty(); });
-        }
+        std::unique_lock<std::mutex> lock(_parkMutex);
         _isStopped = true;
-        _queueCondVar.notify_all();
+        _parkCondVar.notify_all();
     }
     if (_thread && _thread->joinable()) {
         _thread->join();
@@ -61,10 +51,73 @@ TaskExecutor::~TaskExecutor() {
 
 bool TaskExecutor::startTask(Task::Ptr task) {
     if (!task->occupy()) return false;
-    std::unique_lock<std::mutex> lock(_queueMutex);
-    _taskQueue.push(task);
-    _queueCondVar.notify_all();
+
+    // bounded MPSC queue: every cell has a sequence number telling whether it is free for the position
+    size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+    Cell *cell;
+    while (true) {
+        cell = &_queue[pos % queueCapacity];
+        size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+        if (diff == 0) {
+            if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        } else if (diff < 0) {
+            // the queue is full, the thread is busy with the tasks, so it is not parked
+            std::this_thread::yield();
+            pos = _enqueuePos.load(std::memory_order_relaxed);
+        } else {
+            pos = _enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+    cell->task = std::move(task);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+
+    // pairs with the fence of the thread going to park: either it sees the task or the task producer sees it parked
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_isParked.load(std::memory_order_relaxed)) {
+        std::unique_lock<std::mutex> lock(_parkMutex);
+        _parkCondVar.notify_one();
+    }
     return true;
 }
 
+bool TaskExecutor::pop(Task::Ptr &task) {
+    Cell &cell = _queue[_dequeuePos % queueCapacity];
+    if (cell.sequence.load(std::memory_order_acquire) != _dequeuePos + 1)
+        return false;
+    task = std::move(cell.task);
+    cell.task = nullptr;
+    cell.sequence.store(_dequeuePos + queueCapacity, std::memory_order_release);
+    _dequeuePos++;
+    return true;
+}
+
+bool TaskExecutor::waitTask(Task::Ptr &task) {
+    if (pop(task))
+        return true;
+
+    // spin: a task started right after the previous one is taken without the wakeup cost
+    if (_spinTime.count() > 0) {
+        auto deadline = std::chrono::steady_clock::now() + _spinTime;
+        do {
+            std::this_thread::yield();
+            if (pop(task))
+                return true;
+        } while (!_isStopped.load(std::memory_order_relaxed) && std::chrono::steady_clock::now() < deadline);
+    }
+
+    // park
+    std::unique_lock<std::mutex> lock(_parkMutex);
+    _isParked.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    bool hasTask = false;
+    _parkCondVar.wait(lock, [&] {
+        hasTask = pop(task);
+        return hasTask || _isStopped;
+    });
+    _isParked.store(false, std::memory_order_relaxed);
+    return hasTask;
+}
+
 }  // namespace InferenceEngine
@@ -10,7 +10,8 @@
 #include <mutex>
 #include <condition_variable>
 #include <thread>
-#include <queue>
+#include <atomic>
+#include <chrono>
 #include "ie_api.h"
 #include "details/ie_exception.hpp"
 #include "cpp_interfaces/ie_task_synchronizer.hpp"
@@ -20,28 +21,64 @@
 
 namespace InferenceEngine {
 
+/**
+ * @class TaskExecutor
+ * @brief Runs the tasks one-by-one in FIFO order by a single thread. The tasks are passed through a bounded lock-free
+ * ring buffer, so starting a task takes no lock. When the queue is empty, the thread spins for a while before
+ * it parks on a condition variable, so a task started soon after the previous one is taken without a wakeup.
+ */
 class INFERENCE_ENGINE_API_CLASS(TaskExecutor) : public ITaskExecutor {
 public:
     typedef std::shared_ptr<TaskExecutor> Ptr;
 
-    TaskExecutor(std::string name = "Default");
+    /**
+     * @brief Spin time of the executors in microseconds unless ExecutorManager::setSpinTime changes it
+     */
+    static constexpr std::chrono::microseconds::rep defaultSpinTimeUs = 50;
+
+    /**
+     * @param name - name of the executor, it names the thread
+     * @param spinTime - time the thread spins waiting for a new task before it parks, 0 parks it immediately
+     */
+    explicit TaskExecutor(std::string name = "Default",
+                          std::chrono::microseconds spinTime = std::chrono::microseconds(defaultSpinTimeUs));
 
     ~TaskExecutor();
 
+    std::chrono::microseconds getSpinTime() const {
+        return _spinTime;
+    }
+
     /**
      * @brief Add task for execution and notify working thread about new task to start.
      * @note can be called from multiple threads - tasks will be added to the queue and executed one-by-one in FIFO mode.
+     * If the queue is full, the call waits until the thread takes a task from it.
      * @param task - shared pointer to the task to start
      *  @return true if succeed to add task, otherwise - false
      */
     bool startTask(Task::Ptr task) override;
 
 private:
+    static constexpr size_t queueCapacity = 1024;
+
+    struct Cell {
+        std::atomic<size_t> sequence;
+        Task::Ptr task;
+    };
+
+    bool pop(Task::Ptr &task);
+    bool waitTask(Task::Ptr &task);
+
     std::shared_ptr<std::thread> _thread;
-    std::mutex _queueMutex;
-    std::condition_variable _queueCondVar;
-    std::queue<Task::Ptr> _taskQueue;
-    bool _isStopped;
+    std::vector<Cell> _queue;
+    std::atomic<size_t> _enqueuePos;
+    size_t _dequeuePos;
+    std::chrono::microseconds _spinTime;
+    // the thread is parked or is going to park, the producers must wake it up
+    std::atomic<bool> _isParked;
+    std::mutex _parkMutex;
+    std::condition_variable _parkCondVar;
+    std::atomic<bool> _isStopped;
     std::string _name;
 };
 
@@ -72,6 +72,14 @@ public:
         return {};
     }
 
+    void ReleaseSequence(size_t sequenceId) override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+
+    void GetMetrics(ExecutableNetworkMetrics &metrics, bool reset) override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+
 
 protected:
     InferenceEngine::InputsDataMap _networkInputs;
@@ -13,6 +13,7 @@
 #include "cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp"
 #include "cpp_interfaces/impl/ie_infer_request_internal.hpp"
 #include "cpp_interfaces/ie_task_executor.hpp"
+#include "cpp_interfaces/ie_executor_manager.hpp"
 
 namespace InferenceEngine {
 
@@ -23,8 +24,9 @@ public:
 
     ExecutableNetworkThreadSafeDefault() {
         _taskSynchronizer = std::make_shared<TaskSynchronizer>();
-        _taskExecutor = std::make_shared<TaskExecutor>();
-        _callbackExecutor = std::make_shared<TaskExecutor>();
+        auto spinTime = ExecutorManager::getInstance()->getSpinTime();
+        _taskExecutor = std::make_shared<TaskExecutor>("Default", spinTime);
+        _callbackExecutor = std::make_shared<TaskExecutor>("Default", spinTime);
     }
 
     /**
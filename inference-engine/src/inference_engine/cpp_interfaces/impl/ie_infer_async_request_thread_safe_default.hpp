@@ -14,6 +14,7 @@
 #include <cpp_interfaces/ie_task_with_stages.hpp>
 #include <cpp_interfaces/ie_task_executor.hpp>
 #include <cpp_interfaces/exception2status.hpp>
+#include <cpp_interfaces/ie_metrics_collector.hpp>
 #include "ie_infer_async_request_thread_safe_internal.hpp"
 
 namespace InferenceEngine {
@@ -93,7 +94,7 @@ public:
               _requestSynchronizer(taskSynchronizer),
               _userData(nullptr),
               _callbackManager(callbackExecutor) {
-        _syncTask = std::make_shared<Task>([this]() { _syncRequest->Infer(); });
+        _syncTask = std::make_shared<Task>([this]() { runSyncRequest(); });
         _currentTask = _syncTask;
     }
 
@@ -149,9 +150,30 @@ public:
         _syncRequest->checkBlobs();
         _callbackManager.reset();
         initNextAsyncTask();
+        if (_metrics)
+            _startTime = MetricsCollector::Clock::now();
         startAsyncTask();
     }
 
+    /**
+     * @brief Runs the sync request and counts it by the metrics collector if the collector is set
+     */
+    void runSyncRequest() {
+        if (!_metrics) {
+            _syncRequest->Infer();
+            return;
+        }
+        auto start = MetricsCollector::Clock::now();
+        try {
+            _syncRequest->Infer();
+        } catch (...) {
+            _metrics->failedRequests++;
+            throw;
+        }
+        _metrics->execution.add(MetricsCollector::sinceUs(start));
+        _metrics->requests++;
+    }
+
     virtual void processAsyncTaskFailure(StagedTask::Ptr asyncTask) {
         setIsRequestBusy(false);
         auto requestException = std::current_exception();
@@ -173,7 +195,9 @@ public:
             try {
                 switch (asyncTaskCopy->getStage()) {
                     case 2: {
-                        _syncRequest->Infer();
+                        if (_metrics)
+                            _metrics->queueWait.add(MetricsCollector::sinceUs(_startTime));
+                        runSyncRequest();
                         asyncTaskCopy->stageDone();
                         if (_callbackManager.isCallbackEnabled()) {
                             _callbackManager.startTask(asyncTaskCopy);
@@ -257,6 +281,17 @@ public:
         _syncRequest->SetBatch(batch);
     }
 
+    void SetSequences_ThreadUnsafe(const std::vector<size_t> &sequenceIds) override {
+        _syncRequest->SetSequences(sequenceIds);
+    }
+
+    /**
+     * @brief Sets the collector of metrics of the executable network, the requests are not counted without it
+     */
+    void SetMetricsCollector(const MetricsCollector::Ptr &metrics) {
+        _metrics = metrics;
+    }
+
 protected:
     ITaskExecutor::Ptr _requestExecutor;
     TaskSynchronizer::Ptr _requestSynchronizer;
@@ -267,6 +302,8 @@ protected:
     std::list<StagedTask::Ptr> _listAsyncTasks;
     void *_userData;
     CallbackManager _callbackManager;
+    MetricsCollector::Ptr _metrics;
+    MetricsCollector::Clock::time_point _startTime;
 };
 
 }  // namespace InferenceEngine
@@ -96,6 +96,11 @@ public:
         SetBatch_ThreadUnsafe(batch);
     };
 
+    void SetSequences(const std::vector<size_t> &sequenceIds) override {
+        if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+        SetSequences_ThreadUnsafe(sequenceIds);
+    };
+
     /**
      * @brief methods with _ThreadUnsafe prefix are to implement in plugins
      * or in default wrapper (e.g. AsyncInferRequestThreadSafeDefault)
@@ -118,6 +123,8 @@ public:
     virtual void GetBlob_ThreadUnsafe(const char *name, Blob::Ptr &data) = 0;
 
     virtual void SetBatch_ThreadUnsafe(int batch) = 0;
+
+    virtual void SetSequences_ThreadUnsafe(const std::vector<size_t> &sequenceIds) = 0;
 };
 
 }  // namespace InferenceEngine
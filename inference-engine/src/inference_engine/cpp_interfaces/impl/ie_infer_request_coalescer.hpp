@@ -0,0 +1,332 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <blob_factory.hpp>
+#include <cpp_interfaces/interface/ie_iinfer_async_request_internal.hpp>
+#include <cpp_interfaces/exception2status.hpp>
+#include "ie_infer_request_internal.hpp"
+#include "ie_infer_async_request_thread_safe_default.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Combines independent single-item inferences into batched inferences of an executable network.
+ * Every worker owns a request created with dynamic batch enabled. It collects pending items until the batch is full
+ * or the oldest item waits longer than the latency budget, copies inputs of the items into the batch slots,
+ * runs the request with the batch equal to the number of items and copies outputs back to the items.
+ * The items are completed by the worker, so the callers do not need threads of their own to wait for the batch.
+ */
+class InferRequestCoalescer {
+public:
+    typedef std::shared_ptr<InferRequestCoalescer> Ptr;
+
+    /**
+     * @brief Completion of an item, it gets the exception of the batch or nullptr if the batch succeeded
+     */
+    typedef std::function<void(std::exception_ptr)> Completion;
+
+    /**
+     * @param batchedRequests - requests used to run batches, one worker thread per request
+     * @param batchLimit - maximum number of items in a batch, the batch size of the requests
+     * @param timeout - maximum time the first item of a batch waits for the other items
+     */
+    InferRequestCoalescer(const std::vector<IAsyncInferRequestInternal::Ptr> &batchedRequests,
+                          size_t batchLimit, std::chrono::microseconds timeout)
+            : _batchLimit(batchLimit), _timeout(timeout), _isStopped(false) {
+        if (batchedRequests.empty() || batchLimit < 1)
+            THROW_IE_EXCEPTION << "Coalescer requires at least one request with positive batch limit";
+        for (auto &request : batchedRequests)
+            _workers.emplace_back([this, request] { run(request); });
+    }
+
+    ~InferRequestCoalescer() {
+        {
+            std::lock_guard<std::mutex> lock(_queueMutex);
+            _isStopped = true;
+        }
+        _queueCondVar.notify_all();
+        for (auto &worker : _workers)
+            if (worker.joinable()) worker.join();
+    }
+
+    /**
+     * @brief Queues inference of a single item as a part of some batch
+     * @param inputs - input blobs of the item, the batch dimension must be 1. They are read when the batch is run.
+     * @param outputs - output blobs of the item, the batch dimension must be 1. They are written before the completion.
+     * @param done - completion of the item, it is called by the worker thread which ran the batch
+     */
+    void StartAsync(const BlobMap &inputs, const BlobMap &outputs, Completion done) {
+        std::unique_ptr<Item> item(new Item {&inputs, &outputs, std::chrono::steady_clock::now(), std::move(done)});
+        {
+            std::lock_guard<std::mutex> lock(_queueMutex);
+            if (_isStopped) THROW_IE_EXCEPTION << "Coalescer is stopped";
+            _queue.push_back(std::move(item));
+        }
+        _queueCondVar.notify_all();
+    }
+
+    /**
+     * @brief Runs inference of a single item as a part of some batch, blocks until the batch is done
+     */
+    void Infer(const BlobMap &inputs, const BlobMap &outputs) {
+        // the worker may still be in set_value() when the caller wakes up, so the promise is shared with it
+        auto promise = std::make_shared<std::promise<void>>();
+        auto done = promise->get_future();
+        StartAsync(inputs, outputs, [promise](std::exception_ptr error) {
+            if (error)
+                promise->set_exception(error);
+            else
+                promise->set_value();
+        });
+        done.get();
+    }
+
+private:
+    struct Item {
+        const BlobMap *inputs;
+        const BlobMap *outputs;
+        std::chrono::steady_clock::time_point arrival;
+        Completion done;
+    };
+
+    static uint8_t *slot(const Blob::Ptr &batched, size_t itemSize, size_t n) {
+        return batched->buffer().as<uint8_t *>() + n * itemSize;
+    }
+
+    /**
+     * @brief Checks that the blob of an item is a batch slot of the batched blob: the same precision, layout and
+     * dimensions except the batch, so the item can be copied to and from the slot as is
+     */
+    void checkItemBlob(const std::string &name, const Blob::Ptr &item, const Blob::Ptr &batched) const {
+        if (!item || !batched)
+            THROW_IE_EXCEPTION << NOT_ALLOCATED_str << "Blob " << name << " is not allocated";
+        const TensorDesc &itemDesc = item->getTensorDesc();
+        const TensorDesc &batchedDesc = batched->getTensorDesc();
+        if (itemDesc.getPrecision() != batchedDesc.getPrecision())
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Blob " << name << " has precision "
+                               << itemDesc.getPrecision() << " instead of " << batchedDesc.getPrecision();
+        if (itemDesc.getLayout() != batchedDesc.getLayout())
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Blob " << name << " has layout "
+                               << itemDesc.getLayout() << " instead of " << batchedDesc.getLayout();
+        const SizeVector &itemDims = itemDesc.getDims();
+        const SizeVector &batchedDims = batchedDesc.getDims();
+        if (itemDims.size() != batchedDims.size() || itemDims.empty() ||
+                !std::equal(itemDims.begin() + 1, itemDims.end(), batchedDims.begin() + 1) ||
+                item->byteSize() * _batchLimit != batched->byteSize())
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Blob " << name << " does not match the batch item size";
+    }
+
+    void run(const IAsyncInferRequestInternal::Ptr &request) {
+        std::vector<std::unique_ptr<Item>> batch;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(_queueMutex);
+                _queueCondVar.wait(lock, [this] { return _isStopped || !_queue.empty(); });
+                if (_queue.empty())
+                    return;
+                // the budget is counted from the arrival of the oldest item
+                auto deadline = _queue.front()->arrival + _timeout;
+                _queueCondVar.wait_until(lock, deadline, [this] {
+                    return _isStopped || _queue.empty() || _queue.size() >= _batchLimit;
+                });
+                // the items might be taken by another worker meanwhile
+                size_t count = std::min(_queue.size(), _batchLimit);
+                std::move(_queue.begin(), _queue.begin() + count, std::back_inserter(batch));
+                _queue.erase(_queue.begin(), _queue.begin() + count);
+            }
+            if (batch.empty())
+                continue;
+
+            std::exception_ptr error;
+            try {
+                // The items are copied, they cannot be bound to the batched request: a batch is one buffer per
+                // input and output, while the blobs of the items are separate allocations which get their slots
+                // only when the batch is formed, and SetBlob accepts only blobs of the full network batch.
+                // Batch is the outermost dimension of all the IE layouts, so every item is a contiguous part of blob.
+                // The items come from one network, so the blobs of the first one name all the batched blobs.
+                for (auto &input : *batch.front()->inputs) {
+                    Blob::Ptr batched;
+                    request->GetBlob(input.first.c_str(), batched);
+                    for (size_t n = 0; n < batch.size(); n++) {
+                        const Blob::Ptr &item = batch[n]->inputs->at(input.first);
+                        checkItemBlob(input.first, item, batched);
+                        size_t itemSize = item->byteSize();
+                        std::memcpy(slot(batched, itemSize, n), item->cbuffer().as<const uint8_t *>(), itemSize);
+                    }
+                }
+
+                request->SetBatch(static_cast<int>(batch.size()));
+                request->StartAsync();
+                StatusCode status = request->Wait(IInferRequest::WaitMode::RESULT_READY);
+                if (status != OK)
+                    THROW_IE_EXCEPTION << "Batched inference failed with status " << status;
+
+                for (auto &output : *batch.front()->outputs) {
+                    Blob::Ptr batched;
+                    request->GetBlob(output.first.c_str(), batched);
+                    for (size_t n = 0; n < batch.size(); n++) {
+                        const Blob::Ptr &item = batch[n]->outputs->at(output.first);
+                        checkItemBlob(output.first, item, batched);
+                        size_t itemSize = item->byteSize();
+                        std::memcpy(item->buffer().as<uint8_t *>(), slot(batched, itemSize, n), itemSize);
+                    }
+                }
+            } catch (...) {
+                error = std::current_exception();
+            }
+            // a completed item may be destroyed by its owner at once, so it is not touched after the completion
+            for (auto &item : batch)
+                item->done(error);
+            batch.clear();
+        }
+    }
+
+    size_t _batchLimit;
+    std::chrono::microseconds _timeout;
+    bool _isStopped;
+    std::mutex _queueMutex;
+    std::condition_variable _queueCondVar;
+    std::deque<std::unique_ptr<Item>> _queue;
+    std::vector<std::thread> _workers;
+};
+
+/**
+ * @brief Request of a single batch item, its inference is executed by InferRequestCoalescer
+ */
+class CoalescedInferRequest : public InferRequestInternal {
+public:
+    typedef std::shared_ptr<CoalescedInferRequest> Ptr;
+
+    CoalescedInferRequest(const InputsDataMap &networkInputs, const OutputsDataMap &networkOutputs,
+                          const InferRequestCoalescer::Ptr &coalescer)
+            : InferRequestInternal(networkInputs, networkOutputs), _coalescer(coalescer) {
+        for (auto &input : _networkInputs) {
+            input.second->getInputData()->setBatchSize(1);
+            _inputs[input.first] = make_blob_with_precision(input.second->getTensorDesc());
+            _inputs[input.first]->allocate();
+        }
+        for (auto &output : _networkOutputs) {
+            output.second->setBatchSize(1);
+            _outputs[output.first] = make_blob_with_precision(output.second->getTensorDesc());
+            _outputs[output.first]->allocate();
+        }
+    }
+
+    void InferImpl() override {
+        // the resize of the item is done here, the batch is run on the blobs of the network size
+        execDataPreprocessing(_inputs);
+        _coalescer->Infer(_inputs, _outputs);
+    }
+
+    /**
+     * @brief Checks and pre-processes the inputs and queues the item to the coalescer
+     * @param done - completion of the item, it is called by a worker of the coalescer
+     */
+    void StartAsync(InferRequestCoalescer::Completion done) {
+        checkBlobs();
+        execDataPreprocessing(_inputs);
+        _coalescer->StartAsync(_inputs, _outputs, std::move(done));
+    }
+
+    void GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Performance counters are not available for coalesced requests";
+    }
+
+private:
+    InferRequestCoalescer::Ptr _coalescer;
+};
+
+/**
+ * @brief Asynchronous request of a single batch item. It does not use a task executor: the request is queued
+ * to the coalescer, and the worker which ran the batch completes the task of the request, so the requests
+ * waiting for their batches do not occupy threads. The callback is run by the callback executor as usual.
+ */
+class CoalescedAsyncInferRequest : public AsyncInferRequestThreadSafeDefault {
+public:
+    typedef std::shared_ptr<CoalescedAsyncInferRequest> Ptr;
+
+    CoalescedAsyncInferRequest(const CoalescedInferRequest::Ptr &request, const ITaskExecutor::Ptr &callbackExecutor)
+            : AsyncInferRequestThreadSafeDefault(request, nullptr, std::make_shared<TaskSynchronizer>(), callbackExecutor),
+              _coalescedRequest(request) {}
+
+    void startAsyncTask() override {
+        auto task = _asyncTask;
+        if (!task->occupy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+        auto complete = [this, task](std::exception_ptr error) {
+            _error = error;
+            task->runNoThrowNoBusyCheck();
+        };
+        try {
+            _coalescedRequest->StartAsync(complete);
+        } catch (...) {
+            // the failed start is reported in the same way as the failed inference
+            complete(std::current_exception());
+        }
+    }
+
+    StagedTask::Ptr createAsyncRequestTask() override {
+        return std::make_shared<StagedTask>([this]() {
+            auto asyncTaskCopy = _asyncTask;
+            try {
+                switch (asyncTaskCopy->getStage()) {
+                    case 2: {
+                        // the inference has been done by the coalescer already
+                        auto error = _error;
+                        _error = nullptr;
+                        if (_metrics) {
+                            if (error) {
+                                _metrics->failedRequests++;
+                            } else {
+                                _metrics->execution.add(MetricsCollector::sinceUs(_startTime));
+                                _metrics->requests++;
+                            }
+                        }
+                        if (error)
+                            std::rethrow_exception(error);
+                        asyncTaskCopy->stageDone();
+                        if (_callbackManager.isCallbackEnabled()) {
+                            _callbackManager.startTask(asyncTaskCopy);
+                        } else {
+                            asyncTaskCopy->stageDone();
+                        }
+                    }
+                        break;
+                    case 1: {
+                        setIsRequestBusy(false);
+                        asyncTaskCopy->stageDone();
+                        _callbackManager.runCallback();
+                    }
+                        break;
+                    default:
+                        break;
+                }
+            } catch (...) {
+                processAsyncTaskFailure(asyncTaskCopy);
+            }
+        }, 2);
+    }
+
+private:
+    CoalescedInferRequest::Ptr _coalescedRequest;
+    std::exception_ptr _error;
+};
+
+}  // namespace InferenceEngine
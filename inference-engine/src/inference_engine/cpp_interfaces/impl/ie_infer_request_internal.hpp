@@ -168,6 +168,10 @@ public:
         THROW_IE_EXCEPTION << "Dynamic batch is not supported";
     };
 
+    void SetSequences(const std::vector<size_t> &sequenceIds) override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Sequences of memory states are not supported";
+    };
+
     /**
      * @brief Checks and executes input data pre-processing if needed.
      */
@@ -10,6 +10,7 @@
 #include <string>
 #include <ie_iinfer_request.hpp>
 #include <ie_primitive_info.hpp>
+#include <ie_executable_network_metrics.hpp>
 #include <cpp_interfaces/interface/ie_imemory_state_internal.hpp>
 
 namespace InferenceEngine {
@@ -67,6 +68,19 @@ public:
     virtual void GetExecGraphInfo(ICNNNetwork::Ptr &graphPtr) = 0;
 
     virtual std::vector<IMemoryStateInternal::Ptr> QueryState() = 0;
+
+    /**
+    * @brief Releases a memory state kept for the sequence
+    * @param sequenceId id of the sequence
+    */
+    virtual void ReleaseSequence(size_t sequenceId) = 0;
+
+    /**
+    * @brief Gets a snapshot of the counters collected by the executable network
+    * @param metrics - reference to the object to fill in
+    * @param reset - if true, the counters are reset after the snapshot
+    */
+    virtual void GetMetrics(ExecutableNetworkMetrics &metrics, bool reset) = 0;
 };
 
 }  // namespace InferenceEngine
@@ -55,6 +55,12 @@ public:
     * @param batch - new batch size to be used by all the following inference calls for this request.
     */
     virtual void SetBatch(int batch) = 0;
+
+    /**
+    * @brief Binds memory states of the given sequences to the request, one sequence per batch item.
+    * @param sequenceIds - ids of the sequences, empty list unbinds them.
+    */
+    virtual void SetSequences(const std::vector<size_t> &sequenceIds) = 0;
 };
 
 }  // namespace InferenceEngine
@@ -31,4 +31,17 @@ static const char PRECISION[] = "precision";
  * @brief A general key for CNNLayer::params map. Used to get value of execution time of the executable primitive.
  */
 static const char PERF_COUNTER[] = "execTimeMcs";
+/**
+ * @brief General keys for CNNLayer::params map. Used to get the minimal execution time and the 99th percentile
+ *        of the execution time of the executable primitive, and the number of the measured executions.
+ */
+static const char PERF_COUNTER_MIN[] = "execTimeMinMcs";
+static const char PERF_COUNTER_P99[] = "execTimeP99Mcs";
+static const char PERF_COUNTER_SAMPLES[] = "execSamples";
+/**
+ * @brief General keys for CNNLayer::params map. Used to get the theoretical number of floating point operations
+ *        of the executable primitive including the fused layers, and the achieved GFLOP/s of the measured executions.
+ */
+static const char FLOPS[] = "flops";
+static const char ACHIEVED_GFLOPS[] = "achievedGflops";
 }  // namespace ExecGraphInfoSerialization
\ No newline at end of file
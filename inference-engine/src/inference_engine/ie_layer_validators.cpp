@@ -1696,9 +1696,11 @@ void RNNBaseValidator<CELL>::checkCorrespondence(const CNNLayer* layer,
     if (!rnn)
         THROW_IE_EXCEPTION << "Layer is not instance of RNNLayer class";
 
-    if (blobs.size() != 2)
+    // quantization parameters may be added to blobs by the int8 normalizer
+    size_t trainedBlobs = blobs.size() - blobs.count("rnn-data-qparams");
+    if (trainedBlobs != 2)
         THROW_IE_EXCEPTION << "Expected only 2 blobs with trained parameters (weights and biases), "
-                           << "but provided only " << blobs.size();
+                           << "but provided only " << trainedBlobs;
     if (inShapes.empty())
         THROW_IE_EXCEPTION << "No input tensors.";
 
@@ -39,12 +39,30 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // zero and any negative value will be treated
             // as default batch size
             batchLimit = std::max(val_i, 0);
+        } else if (key == PluginConfigParams::KEY_DYN_BATCH_COALESCE_TIMEOUT) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_DYN_BATCH_COALESCE_TIMEOUT
+                                   << ". Expected only non-negative numbers (microseconds)";
+            }
+            coalesceTimeout = std::max(val_i, 0);
         } else if (key == PluginConfigParams::KEY_PERF_COUNT) {
             if (val == PluginConfigParams::YES) collectPerfCounters = true;
             else if (val == PluginConfigParams::NO) collectPerfCounters = false;
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_PERF_COUNT
                                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_PERF_COUNT_SAMPLING) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PERF_COUNT_SAMPLING
+                                   << ". Expected only positive numbers (one of N inferences is measured)";
+            }
+            perfCountSampling = std::max(val_i, 1);
         } else if (key == PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS) {
             if (val == PluginConfigParams::YES) exclusiveAsyncRequests = true;
             else if (val == PluginConfigParams::NO) exclusiveAsyncRequests = false;
@@ -77,6 +95,21 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 if (val_i > 0)
                     throughputStreams = val_i;
             }
+        } else if (key == PluginConfigParams::KEY_CPU_SHARED_STREAMS) {
+            if (val == PluginConfigParams::YES) sharedStreams = true;
+            else if (val == PluginConfigParams::NO) sharedStreams = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHARED_STREAMS
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_STREAMS_WEIGHT) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_STREAMS_WEIGHT
+                                   << ". Expected only positive numbers (share of the streams)";
+            }
+            streamsWeight = std::max(val_i, 1);
         } else if (key == PluginConfigParams::KEY_CPU_THREADS_NUM) {
             int val_i;
             try {
@@ -87,6 +120,15 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             }
             if (val_i > 0)
                 threadsNum = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_PARALLEL_GRAIN) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PARALLEL_GRAIN
+                                   << ". Expected only non-negative numbers (work per thread)";
+            }
+            parallelGrain = std::max(val_i, 0);
         } else if (key.compare(PluginConfigParams::KEY_DYN_BATCH_ENABLED) == 0) {
             if (val.compare(PluginConfigParams::YES) == 0)
                 enableDynamicBatch = true;
@@ -95,6 +137,31 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_DYN_BATCH_ENABLED
                 << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_MEMORY_POOLING) {
+            if (val == PluginConfigParams::YES) memoryPooling = true;
+            else if (val == PluginConfigParams::NO) memoryPooling = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_MEMORY_POOLING
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_HUGE_PAGES) {
+            if (val == PluginConfigParams::YES) hugePages = true;
+            else if (val == PluginConfigParams::NO) hugePages = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_HUGE_PAGES
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_NUMA_MEMORY_BINDING) {
+            if (val == PluginConfigParams::YES) numaMemoryBinding = true;
+            else if (val == PluginConfigParams::NO) numaMemoryBinding = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_NUMA_MEMORY_BINDING
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_LOG_LEVEL) {
+            if (val == PluginConfigParams::LOG_DEBUG) debugLog = true;
+            else if (val == PluginConfigParams::LOG_NONE || val == PluginConfigParams::LOG_WARNING ||
+                     val == PluginConfigParams::LOG_INFO) debugLog = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_LOG_LEVEL
+                                   << ". Expected only LOG_NONE/LOG_WARNING/LOG_INFO/LOG_DEBUG";
         } else if (key.compare(PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT) == 0) {
             // empty string means that dumping is switched off
             dumpToDot = val;
@@ -102,8 +169,10 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property " << key << " by CPU plugin";
         }
     }
-    if (exclusiveAsyncRequests)  // Exclusive request feature disables the streams
+    if (exclusiveAsyncRequests) {  // Exclusive request feature disables the streams
         throughputStreams = 1;
+        sharedStreams = false;
+    }
 }
 
 }  // namespace MKLDNNPlugin
@@ -14,10 +14,20 @@ struct Config {
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
+    bool memoryPooling = false;
+    bool hugePages = false;
+    bool numaMemoryBinding = false;
+    bool sharedStreams = false;
+    // reports the facts of the network load which are not layers, e.g. the statistics of the memory allocators
+    bool debugLog = false;
     std::string dumpToDot = "";
     int batchLimit = 0;
+    int coalesceTimeout = 0;
     int throughputStreams = 1;
+    int streamsWeight = 1;
     int threadsNum = 0;
+    int parallelGrain = 0;
+    int perfCountSampling = 1;
 
     void readProperties(const std::map<std::string, std::string> &config);
 };
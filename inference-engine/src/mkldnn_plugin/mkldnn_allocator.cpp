@@ -0,0 +1,178 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_allocator.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#else
+#include <sys/mman.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#endif
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+const size_t alignment = 64;
+
+#if defined(__linux__)
+// the same as MPOL_PREFERRED of numaif.h, the memory falls back to other nodes if the node is full
+const int mpolPreferred = 1;
+
+bool bindToNumaNode(void *ptr, size_t size, int node) {
+#ifdef SYS_mbind
+    const size_t bitsPerWord = sizeof(unsigned long) * 8;  // NOLINT
+    std::vector<unsigned long> nodeMask(node / bitsPerWord + 1, 0);  // NOLINT
+    nodeMask[node / bitsPerWord] = 1ul << (node % bitsPerWord);
+    return syscall(SYS_mbind, ptr, size, mpolPreferred, nodeMask.data(), nodeMask.size() * bitsPerWord + 1, 0) == 0;
+#else
+    return false;
+#endif
+}
+#endif
+
+}  // namespace
+
+MKLDNNAllocator::MKLDNNAllocator(int numaNode, bool hugePages, bool pooling)
+        : numaNode(numaNode), hugePages(hugePages), pooling(pooling) {}
+
+MKLDNNAllocator::~MKLDNNAllocator() {
+    for (auto &sizeBlocks : pool)
+        for (auto &block : sizeBlocks.second)
+            systemFree(block.first, block.second.size, block.second.mapped);
+    // blocks which are not released by the owners are not freed, they may still be in use
+}
+
+size_t MKLDNNAllocator::sizeClass(size_t size) {
+    if (size >= hugePageSize)
+        return (size + hugePageSize - 1) / hugePageSize * hugePageSize;
+    size_t result = alignment;
+    while (result < size)
+        result <<= 1;
+    return result;
+}
+
+void *MKLDNNAllocator::systemAlloc(size_t size, bool &mapped) {
+    mapped = false;
+#if defined(__linux__)
+    bool useHugePages = hugePages && size >= hugePageSize;
+    if (useHugePages || numaNode >= 0) {
+        // the mapping is aligned to the huge page size, so the whole block can be backed by huge pages
+        size_t mappedSize = size + (useHugePages ? hugePageSize : 0);
+        void *ptr = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED)
+            return nullptr;
+        uint8_t *begin = static_cast<uint8_t *>(ptr);
+        if (useHugePages) {
+            uint8_t *aligned = reinterpret_cast<uint8_t *>(
+                    (reinterpret_cast<uintptr_t>(begin) + hugePageSize - 1) / hugePageSize * hugePageSize);
+            if (aligned != begin)
+                munmap(begin, aligned - begin);
+            if (aligned + size != begin + mappedSize)
+                munmap(aligned + size, begin + mappedSize - (aligned + size));
+            begin = aligned;
+#ifdef MADV_HUGEPAGE
+            if (madvise(begin, size, MADV_HUGEPAGE) == 0)
+                stats.hugePageBytes += size;
+#endif
+        }
+        if (numaNode >= 0)
+            bindToNumaNode(begin, size, numaNode);
+        mapped = true;
+        return begin;
+    }
+#endif
+#if defined(_WIN32)
+    return _aligned_malloc(size, alignment);
+#else
+    void *ptr = nullptr;
+    return posix_memalign(&ptr, alignment, size) == 0 ? ptr : nullptr;
+#endif
+}
+
+void MKLDNNAllocator::systemFree(void *ptr, size_t size, bool mapped) {
+#if !defined(_WIN32)
+    if (mapped) {
+        munmap(ptr, size);
+        return;
+    }
+#endif
+#if defined(_WIN32)
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+void *MKLDNNAllocator::alloc(size_t size) noexcept {
+    try {
+        size_t blockSize = sizeClass(size);
+        std::lock_guard<std::mutex> lock(mutex);
+        stats.allocations++;
+
+        std::pair<void *, Block> block {nullptr, {blockSize, false}};
+        auto pooled = pool.find(blockSize);
+        if (pooled != pool.end() && !pooled->second.empty()) {
+            block = pooled->second.back();
+            pooled->second.pop_back();
+            stats.poolHits++;
+            stats.bytesPooled -= blockSize;
+        } else {
+            block.first = systemAlloc(blockSize, block.second.mapped);
+            if (!block.first)
+                return nullptr;
+            stats.systemAllocations++;
+        }
+        blocks[block.first] = block.second;
+        stats.bytesInUse += blockSize;
+        return block.first;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+bool MKLDNNAllocator::free(void *handle) noexcept {
+    try {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto found = blocks.find(handle);
+        if (found == blocks.end())
+            return false;
+        Block block = found->second;
+        blocks.erase(found);
+        stats.bytesInUse -= block.size;
+        if (pooling) {
+            pool[block.size].emplace_back(handle, block);
+            stats.bytesPooled += block.size;
+        } else {
+            systemFree(handle, block.size, block.mapped);
+        }
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+MKLDNNAllocator::Statistics MKLDNNAllocator::getStatistics() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+std::string MKLDNNAllocator::getStatisticsString() const {
+    Statistics s = getStatistics();
+    std::stringstream str;
+    str << "node=" << numaNode << " allocs=" << s.allocations << " system=" << s.systemAllocations
+        << " pool_hits=" << s.poolHits << " in_use=" << s.bytesInUse << " pooled=" << s.bytesPooled
+        << " huge_pages=" << s.hugePageBytes;
+    return str.str();
+}
@@ -0,0 +1,87 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_allocator.hpp>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Allocator of the graph workspaces and the request blobs.
+ * It can place the memory on a given NUMA node, request transparent huge pages for large allocations
+ * and keep released memory in size classes to serve the next allocations without system calls.
+ */
+class MKLDNNAllocator : public InferenceEngine::IAllocator {
+public:
+    typedef std::shared_ptr<MKLDNNAllocator> Ptr;
+
+    struct Statistics {
+        size_t allocations = 0;        // calls of alloc()
+        size_t systemAllocations = 0;  // allocations served by the system
+        size_t poolHits = 0;           // allocations served by the pool
+        size_t bytesInUse = 0;
+        size_t bytesPooled = 0;
+        size_t hugePageBytes = 0;      // bytes advised to be backed by huge pages
+    };
+
+    /**
+     * @param numaNode - NUMA node to place the memory on, -1 to keep the default (first touch) policy
+     * @param hugePages - request huge pages for allocations of at least the huge page size
+     * @param pooling - keep released memory for reuse until the allocator is destroyed
+     */
+    MKLDNNAllocator(int numaNode, bool hugePages, bool pooling);
+    ~MKLDNNAllocator() override;
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void *lock(void *handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void *handle) noexcept override {}
+
+    void *alloc(size_t size) noexcept override;
+    bool free(void *handle) noexcept override;
+
+    int getNumaNode() const {
+        return numaNode;
+    }
+
+    Statistics getStatistics() const;
+    std::string getStatisticsString() const;
+
+    static const size_t hugePageSize = 2 * 1024 * 1024;
+
+private:
+    struct Block {
+        size_t size;
+        bool mapped;
+    };
+
+    static size_t sizeClass(size_t size);
+    void *systemAlloc(size_t size, bool &mapped);
+    void systemFree(void *ptr, size_t size, bool mapped);
+
+    int numaNode;
+    bool hugePages;
+    bool pooling;
+
+    mutable std::mutex mutex;
+    std::unordered_map<void *, Block> blocks;
+    // released blocks by their size class
+    std::map<size_t, std::vector<std::pair<void *, Block>>> pool;
+    Statistics stats;
+};
+
+}  // namespace MKLDNNPlugin
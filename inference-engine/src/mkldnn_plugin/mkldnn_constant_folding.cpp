@@ -0,0 +1,209 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_constant_folding.h"
+#include "mkldnn_graph.h"
+#include <details/caseless.hpp>
+#include <details/ie_cnn_network_tools.h>
+#include <blob_factory.hpp>
+#include <ie_util_internal.hpp>
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+namespace {
+
+// the outputs of these layers depend on the shapes of their inputs only
+const caseless_set<std::string> shapeOnlyLayers = {"PriorBox", "PriorBoxClustered"};
+
+// these layers keep a state between inferences or are executed by the graph in a special way
+const caseless_set<std::string> notFoldedLayers = {"Input", "Memory", "TensorIterator"};
+
+bool isConstLayer(const CNNLayerPtr& layer) {
+    return CaselessEq<std::string>()(layer->type, "Const");
+}
+
+}  // namespace
+
+MKLDNNConstantFolding::Statistics MKLDNNConstantFolding::FoldConstants(CNNNetworkImpl& network,
+                                                                       const MKLDNNExtensionManager::Ptr& extMgr) {
+    Statistics statistics;
+
+    std::set<CNNLayerPtr> constLayers;
+    std::vector<CNNLayerPtr> sortedLayers = CNNNetSortTopologically(network);
+    for (const auto& layer : sortedLayers) {
+        bool isConst;
+        if (isConstLayer(layer)) {
+            isConst = layer->blobs.size() == 1 && layer->blobs.begin()->second &&
+                      layer->blobs.begin()->second->getTensorDesc().getPrecision() == Precision::FP32;
+        } else if (layer->insData.empty() || notFoldedLayers.find(layer->type) != notFoldedLayers.end()) {
+            isConst = false;
+        } else if (shapeOnlyLayers.find(layer->type) != shapeOnlyLayers.end()) {
+            // the data inputs must stay consumed by other layers, otherwise the network would lose its inputs
+            isConst = true;
+            for (const auto& in : layer->insData) {
+                auto data = in.lock();
+                if (constLayers.find(data->getCreatorLayer().lock()) != constLayers.end())
+                    continue;
+                bool consumed = false;
+                for (const auto& consumer : data->getInputTo())
+                    consumed |= shapeOnlyLayers.find(consumer.second->type) == shapeOnlyLayers.end();
+                isConst &= consumed;
+            }
+        } else {
+            isConst = true;
+            for (const auto& in : layer->insData)
+                isConst &= constLayers.find(in.lock()->getCreatorLayer().lock()) != constLayers.end();
+        }
+        // the Const layers of the plugin hold FP32 data only
+        for (const auto& out : layer->outData)
+            isConst &= out->getPrecision() == Precision::FP32;
+
+        if (isConst)
+            constLayers.insert(layer);
+    }
+
+    // The layers to compute: the non-Const ones and the Const ones feeding them. The Const layers
+    // consumed by the other layers only are already in the final form, so they are left as they are.
+    std::vector<CNNLayerPtr> foldedLayers;
+    std::set<CNNLayerPtr> removedLayers;
+    for (const auto& layer : sortedLayers) {
+        if (constLayers.find(layer) == constLayers.end())
+            continue;
+
+        bool feedsFolded = false, feedsOthers = false;
+        for (const auto& out : layer->outData) {
+            for (const auto& consumer : out->getInputTo()) {
+                bool isConst = constLayers.find(consumer.second) != constLayers.end();
+                feedsFolded |= isConst;
+                feedsOthers |= !isConst;
+            }
+        }
+        if (isConstLayer(layer) && !feedsFolded)
+            continue;
+
+        foldedLayers.push_back(layer);
+        if (!isConstLayer(layer) || !feedsOthers)
+            removedLayers.insert(layer);
+    }
+
+    // the data computed by the removed layers and still used by the network
+    std::vector<DataPtr> results;
+    for (const auto& layer : removedLayers) {
+        for (const auto& out : layer->outData) {
+            bool isResult = out->getInputTo().empty();
+            for (const auto& consumer : out->getInputTo())
+                isResult |= constLayers.find(consumer.second) == constLayers.end();
+            if (isResult)
+                results.push_back(out);
+        }
+        if (!isConstLayer(layer))
+            statistics.layers++;
+    }
+    if (statistics.layers == 0)
+        return statistics;
+
+    // The subgraphs are computed by a graph of their own. The graph needs inputs, so the Const layers become
+    // its inputs fed with their blobs. The non-constant inputs of the shape-only layers are inputs as well,
+    // they are filled with zeros since only their shapes matter.
+    auto foldingNetwork = cloneNet(foldedLayers, nullptr);
+    for (const auto& result : results)
+        foldingNetwork->addOutput(result->getName());
+
+    BlobMap inputBlobs;
+    for (const auto& item : foldingNetwork->allLayers()) {
+        const CNNLayerPtr& layer = item.second;
+        if (!isConstLayer(layer))
+            continue;
+        const DataPtr& data = layer->outData[0];
+        if (layer->blobs.size() != 1 || !layer->blobs.begin()->second)
+            THROW_IE_EXCEPTION << "Incorrect const layer " << layer->name;
+        const Blob::Ptr& constBlob = layer->blobs.begin()->second;
+        size_t size = 1;
+        for (auto dim : data->getTensorDesc().getDims())
+            size *= dim;
+        if (constBlob->size() != size || constBlob->getTensorDesc().getPrecision() != Precision::FP32)
+            THROW_IE_EXCEPTION << "Incorrect blob of const layer " << layer->name;
+        // the data of the Const layers are planar
+        inputBlobs[data->getName()] = make_blob_with_precision(data->getTensorDesc(), constBlob->buffer());
+
+        layer->type = "Input";
+        auto input = std::make_shared<InputInfo>();
+        input->setInputData(data);
+        foldingNetwork->setInputInfo(input);
+    }
+
+    InputsDataMap inputs;
+    foldingNetwork->getInputsInfo(inputs);
+    for (const auto& input : inputs) {
+        if (inputBlobs.find(input.first) != inputBlobs.end())
+            continue;
+        Blob::Ptr blob = make_blob_with_precision(input.second->getTensorDesc());
+        blob->allocate();
+        std::memset(blob->buffer(), 0, blob->byteSize());
+        inputBlobs[input.first] = blob;
+    }
+
+    MKLDNNGraph graph;
+    graph.CreateGraph(*foldingNetwork, extMgr);
+    for (const auto& input : inputBlobs)
+        graph.PushInputData(input.first, input.second);
+    graph.Infer();
+
+    OutputsDataMap outputs;
+    foldingNetwork->getOutputsInfo(outputs);
+    BlobMap outputBlobs;
+    for (const auto& output : outputs) {
+        Blob::Ptr blob = make_blob_with_precision(output.second->getTensorDesc());
+        blob->allocate();
+        outputBlobs[output.first] = blob;
+    }
+    graph.PullOutputData(outputBlobs);
+
+    // detach the removed layers from the network
+    for (const auto& layer : removedLayers) {
+        for (const auto& in : layer->insData) {
+            auto data = in.lock();
+            auto& consumers = data->getInputTo();
+            for (auto it = consumers.begin(); it != consumers.end();) {
+                if (it->second == layer)
+                    it = consumers.erase(it);
+                else
+                    it++;
+            }
+        }
+        network.removeLayer(layer->name);
+    }
+    for (const auto& layer : removedLayers) {
+        for (const auto& out : layer->outData) {
+            if (std::find(results.begin(), results.end(), out) == results.end())
+                network.removeData(out->getName());
+        }
+    }
+
+    // every result is kept by a Const layer, the layer is named after the data as it may be one of several outputs
+    for (const auto& result : results) {
+        std::string name = result->getName();
+        CNNLayerPtr layer;
+        while (network.getLayerByName(name.c_str(), layer, nullptr) == StatusCode::OK)
+            name += "_folded";
+
+        CNNLayerPtr constLayer(new CNNLayer({name, "Const", Precision::FP32}));
+        constLayer->blobs["custom"] = outputBlobs.at(result->getName());
+        constLayer->outData.push_back(result);
+        result->getCreatorLayer() = constLayer;
+        network.addLayer(constLayer);
+
+        statistics.bytes += constLayer->blobs["custom"]->byteSize();
+    }
+
+    return statistics;
+}
@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cnn_network_impl.hpp>
+#include "mkldnn_extension_mngr.h"
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Evaluates the constant subgraphs of the network once on load and replaces them by Const layers holding
+ * the results, so the graphs of the streams neither execute the subgraphs nor keep their own copies of the results
+ */
+class MKLDNNConstantFolding {
+public:
+    struct Statistics {
+        // removed layers except the Const ones
+        size_t layers = 0;
+        // size of the results kept by the new Const layers
+        size_t bytes = 0;
+
+        std::string toString() const {
+            return "layers=" + std::to_string(layers) + " bytes=" + std::to_string(bytes);
+        }
+    };
+
+    /**
+     * @brief Folds the layers which have only constant inputs (or depend only on the shapes of their inputs, as PriorBox)
+     * @return statistics of the folded layers
+     */
+    static Statistics FoldConstants(InferenceEngine::details::CNNNetworkImpl& network,
+                                    const MKLDNNExtensionManager::Ptr& extMgr);
+};
+
+}  // namespace MKLDNNPlugin
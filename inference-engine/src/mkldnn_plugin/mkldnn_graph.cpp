@@ -9,17 +9,23 @@
 #include <unordered_set>
 #include <limits>
 #include <fstream>
+#include <iostream>
+#include <sstream>
 #include <unordered_map>
 #include <memory>
 #include "details/caseless.hpp"
 
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_optimizer.h"
+#include "mkldnn_constant_folding.h"
 #include <debug.h>
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
 #include <nodes/mkldnn_depthwise_node.h>
 #include <nodes/mkldnn_conv_node.h>
+#include <nodes/mkldnn_concat_node.h>
+#include <nodes/mkldnn_memory_node.hpp>
+#include <nodes/mkldnn_tensoriterator_node.h>
 
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_extension_mngr.h"
@@ -30,6 +36,9 @@
 #include "memory_solver.hpp"
 #include "mkldnn_infer_request.h"
 #include "mkldnn_async_infer_request.h"
+#include "mkldnn_memory_state.h"
+#include "mkldnn_topology.h"
+#include "mkldnn_shared_streams.h"
 #include <blob_factory.hpp>
 #include <ie_util_internal.hpp>
 #include <net_pass.h>
@@ -81,6 +90,7 @@ void MKLDNNGraph::CreateGraph(const ICNNNetwork &network, const MKLDNNExtensionM
 
     Replicate(network, extMgr);
     InitGraph();
+    InitBlobReorders(network);
     status = Ready;
 }
 
@@ -194,6 +204,10 @@ void MKLDNNGraph::InitGraph() {
 
     CreatePrimitives();
 
+    InitNodesParallelism();
+
+    InitMemoryStates();
+
     // Do it before cleanup. Because it will lose original layers information
     for (auto &graphNode : graphNodes) {
         auto nodeType = graphNode->getType();
@@ -329,6 +343,27 @@ static inline bool isConstOutput(MKLDNNEdgePtr edge) {
     return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
 }
 
+/**
+ * @brief Returns the blob of the Const input if the edges are the outputs of the input only and have the layout of the blob
+ */
+static Blob::Ptr getSharedConstBlob(const std::vector<MKLDNNEdgePtr>& edges) {
+    auto *input = dynamic_cast<MKLDNNInputNode *>(edges[0]->getParent().get());
+    if (!input || input->getType() != Input || !input->getConstBlob())
+        return nullptr;
+
+    const Blob::Ptr &constBlob = input->getConstBlob();
+    if (constBlob->getTensorDesc().getPrecision() != Precision::FP32)
+        return nullptr;
+    for (auto &edge : edges) {
+        if (edge->getParent().get() != input || edge->getChild()->getType() == Output)
+            return nullptr;
+        if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation &&
+                MKLDNNMemoryDesc(edge->getDesc()) != MKLDNNMemoryDesc(constBlob->getTensorDesc()))
+            return nullptr;
+    }
+    return constBlob;
+}
+
 void MKLDNNGraph::AllocateWithReuse() {
     std::vector<std::vector<MKLDNNEdgePtr>> edge_clasters;
 
@@ -397,6 +432,21 @@ void MKLDNNGraph::AllocateWithReuse() {
     }
     //======= End of WA ============
 
+    // The data of the Const inputs read by their consumers only are bound to the blobs of the inputs instead of
+    // the workspace, so the graphs of all the streams share them
+    for (auto claster = edge_clasters.begin(); claster != edge_clasters.end();) {
+        const Blob::Ptr constBlob = getSharedConstBlob(*claster);
+        if (!constBlob) {
+            claster++;
+            continue;
+        }
+        for (auto &edge : *claster) {
+            if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation)
+                edge->allocate(constBlob->cbuffer());
+        }
+        claster = edge_clasters.erase(claster);
+    }
+
     const int64_t alignment = 32;  // 32 bytes
 
     std::vector<MemorySolver::Box> boxes(edge_clasters.size());
@@ -444,7 +494,17 @@ void MKLDNNGraph::AllocateWithReuse() {
     size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
 
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
-    memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
+    if (allocator) {
+        MKLDNNAllocator::Ptr alloc = allocator;
+        workspaceData = std::shared_ptr<void>(alloc->alloc(total_size), [alloc](void *ptr) {
+            if (ptr) alloc->free(ptr);
+        });
+        if (!workspaceData)
+            THROW_IE_EXCEPTION << "Cannot allocate workspace of " << total_size << " bytes";
+        memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)), workspaceData.get());
+    } else {
+        memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
+    }
     auto* workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
 
     for (int i = 0; i < edge_clasters.size(); i++) {
@@ -480,10 +540,326 @@ void MKLDNNGraph::Allocate() {
 
 void MKLDNNGraph::CreatePrimitives() {
     for (auto& node : graphNodes) {
+        // the weights are placed to the memory of the graph allocator, so they are local to the NUMA node of the stream
+        node->weightsAllocator = allocator;
         node->createPrimitive();
     }
 }
 
+/**
+ * @brief Estimates the work of the node as the number of multiply-adds for the layers with weights
+ * and as the number of processed elements for the other ones
+ * @return the estimated work, 0 if it cannot be estimated
+ */
+static size_t estimateNodeWork(const MKLDNNNodePtr& node) {
+    size_t inputElements = 0, outputElements = 0;
+    for (size_t i = 0; i < node->getParentEdges().size(); i++)
+        inputElements = std::max(inputElements, static_cast<size_t>(node->getParentEdgeAt(i)->getDims().size()));
+    for (size_t i = 0; i < node->getChildEdges().size(); i++)
+        outputElements = std::max(outputElements, static_cast<size_t>(node->getChildEdgeAt(i)->getDims().size()));
+
+    const CNNLayerPtr& layer = node->getCnnLayer();
+    switch (node->getType()) {
+        case Convolution:
+        case Convolution_Sum:
+        case Convolution_Activation:
+        case Convolution_Depthwise:
+        case Convolution_Sum_Activation:
+        case Deconvolution:
+        case BinaryConvolution: {
+            // every output (input for deconvolution) value takes IC/group (OC/group) * kernel multiply-adds
+            size_t kernel = 1, group = 1;
+            if (auto* convLayer = dynamic_cast<ConvolutionLayer*>(layer.get())) {
+                for (size_t i = 0; i < convLayer->_kernel.size(); i++)
+                    kernel *= convLayer->_kernel[i];
+                group = convLayer->_group;
+            } else if (auto* binConvLayer = dynamic_cast<BinaryConvolutionLayer*>(layer.get())) {
+                for (size_t i = 0; i < binConvLayer->_kernel.size(); i++)
+                    kernel *= binConvLayer->_kernel[i];
+                group = binConvLayer->_group;
+            } else {
+                return 0;
+            }
+            bool isDeconv = node->getType() == Deconvolution;
+            const MKLDNNDims& dims = isDeconv ? node->getChildEdgeAt(0)->getDims() : node->getParentEdgeAt(0)->getDims();
+            size_t channels = dims.ndims() > 1 ? static_cast<size_t>(dims[1]) : 1;
+            return (isDeconv ? inputElements : outputElements) * kernel * channels / std::max<size_t>(group, 1);
+        }
+        case FullyConnected:
+        case FullyConnected_Activation: {
+            const MKLDNNDims& dims = node->getParentEdgeAt(0)->getDims();
+            size_t batch = dims.ndims() > 0 ? static_cast<size_t>(dims[0]) : 1;
+            return outputElements * inputElements / std::max<size_t>(batch, 1);
+        }
+        case Gemm: {
+            auto* gemmLayer = dynamic_cast<GemmLayer*>(layer.get());
+            const MKLDNNDims& dims = node->getParentEdgeAt(0)->getDims();
+            if (!gemmLayer || dims.ndims() < 2)
+                return 0;
+            size_t k = static_cast<size_t>(dims[gemmLayer->transpose_a ? dims.ndims() - 2 : dims.ndims() - 1]);
+            return outputElements * k;
+        }
+        case MKLDNNPlugin::RNNCell:
+        case MKLDNNPlugin::RNNSeq:
+        case MKLDNNPlugin::TensorIterator:
+        case Generic:
+            // recurrent sequences, loops and extension layers are not estimated, they use all the threads
+            return 0;
+        default:
+            return std::max(inputElements, outputElements);
+    }
+}
+
+/**
+ * @brief Estimates the theoretical cost of the node: two floating point operations per multiply-add
+ * of the layers with weights and one per processed element of the other ones. The nodes fused into the node
+ * are accounted by the type of the node, e.g. Convolution_Sum_Activation, since their edges are removed.
+ * @return the number of floating point operations, 0 if it cannot be estimated
+ */
+static uint64_t estimateNodeFlops(const MKLDNNNodePtr& node) {
+    uint64_t work = estimateNodeWork(node);
+    switch (node->getType()) {
+        case Convolution:
+        case Convolution_Sum:
+        case Convolution_Activation:
+        case Convolution_Depthwise:
+        case Convolution_Sum_Activation:
+        case Deconvolution:
+        case BinaryConvolution:
+        case FullyConnected:
+        case FullyConnected_Activation:
+        case Gemm:
+            return 2 * work;
+        default:
+            return work;
+    }
+}
+
+void MKLDNNGraph::InitNodesParallelism() {
+#if IE_THREAD == IE_THREAD_TBB
+    const int maxThreads = ptrArena ? ptrArena->max_concurrency() : parallel_get_max_threads();
+    // the shared streams are pinned by their pool, which the graph does not know, so the nodes keep the whole stream
+    const bool pinnedByPool = config.sharedStreams && config.useThreadBinding && !check_env_variables();
+#else
+    const int maxThreads = parallel_get_max_threads();
+#endif
+    for (auto& node : graphNodes) {
+        // the cost is reported by the performance counters along with the achieved GFLOP/s
+        int batch = 1;
+        if (!node->getChildEdges().empty() && node->getChildEdgeAt(0)->getDims().ndims() > 0)
+            batch = node->getChildEdgeAt(0)->getDims()[0];
+        node->PerfCounter().setFlops(estimateNodeFlops(node), batch);
+
+        node->execThreads = 0;
+        if (config.parallelGrain <= 0 || maxThreads <= 1 || node->isConstant())
+            continue;
+#if IE_THREAD == IE_THREAD_TBB
+        if (pinnedByPool)
+            continue;
+#endif
+        size_t work = estimateNodeWork(node);
+        if (work == 0)
+            continue;
+        size_t threads = (work + config.parallelGrain - 1) / config.parallelGrain;
+        if (threads < static_cast<size_t>(maxThreads))
+            node->execThreads = std::max(static_cast<int>(threads), 1);
+    }
+
+#if IE_THREAD == IE_THREAD_TBB
+    // the arenas are created in advance, so the inference does not allocate them
+    nodeObservers.clear();
+    nodeArenas.clear();
+    nodeArenas.resize(maxThreads);
+    for (auto& node : graphNodes) {
+        int threads = node->execThreads;
+        if (threads == 0 || nodeArenas[threads])
+            continue;
+        nodeArenas[threads] = std::unique_ptr<tbb::task_arena>(new tbb::task_arena(threads));
+        // the workers of the node arena come from the global pool, so they are pinned the same way as the stream ones
+        if (pinning.streamId >= 0) {
+            nodeObservers.emplace_back(new pinning_observer(*nodeArenas[threads], pinning.streamId,
+                                                            pinning.threadsPerStream, pinning.step,
+                                                            pinning.processors, true));
+            nodeObservers.back()->observe(true);
+        }
+    }
+#endif
+}
+
+void MKLDNNGraph::ExecuteNode(const MKLDNNNodePtr& node, mkldnn::stream& stream) {
+    const int threads = node->execThreads;
+    if (threads == 0) {
+        node->execute(stream);
+        return;
+    }
+#if IE_THREAD == IE_THREAD_TBB
+    // the parallel loops of the node (and of the mkldnn primitives) are limited by the concurrency of the arena
+    nodeArenas[threads]->execute([&] { node->execute(stream); });
+#elif IE_THREAD == IE_THREAD_OMP
+    const int maxThreads = parallel_get_max_threads();
+    if (threads >= maxThreads) {
+        node->execute(stream);
+        return;
+    }
+    parallel_set_num_threads(threads);
+    node->execute(stream);
+    parallel_set_num_threads(maxThreads);
+#else
+    node->execute(stream);
+#endif
+}
+
+void MKLDNNGraph::InitMemoryStates() {
+    for (auto& node : graphNodes) {
+        if (node->getType() != MemoryInput)
+            continue;
+        auto* memoryNode = dynamic_cast<MKLDNNMemoryInputNode *>(node.get());
+        if (!memoryNode)
+            THROW_IE_EXCEPTION << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
+
+        MemoryState state;
+        state.id = memoryNode->getId();
+        const MKLDNNMemory& memory = node->getChildEdgeAt(0)->getMemory();
+        state.defaultPtr = memory.GetData();
+        state.size = memory.GetSize();
+        state.batch = static_cast<size_t>(memory.GetDims()[0]);
+
+        auto blocking = memory.GetDescriptor().data.layout_desc.blocking;
+        state.isBatchOuter = blocking.offset_padding == 0 &&
+                blocking.strides[0][0] * state.batch * MKLDNNExtensionUtils::sizeOfDataType(memory.GetDataType()) == state.size;
+
+        state.canBeSwapped = true;
+        for (auto& edge : graphEdges) {
+            if (edge->getMemory().GetPrimitive().get_data_handle() != state.defaultPtr)
+                continue;
+            state.edges.push_back(edge);
+
+            // Concat and Split use the pointers which are resolved on primitive creation
+            auto& child = edge->getChild();
+            auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
+            if ((concat && concat->isOptimized()) || child->getType() == Split || child->isConstant())
+                state.canBeSwapped = false;
+        }
+        memoryStates.push_back(state);
+    }
+}
+
+bool MKLDNNGraph::CanRebindInput(const MKLDNNNodePtr& input) {
+    // Input cannot be in-place with other primitives
+    for (size_t i = 0; i < input->getChildEdges().size(); i++) {
+        auto& child = input->getChildEdgeAt(i)->getChild();
+        if (child->isConstant())
+            return false;
+        auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
+        if (concat && concat->isOptimized())
+            return false;
+        // Cannot be in-place before split because split is using different ptrs without offsets
+        if (child->getType() == Split)
+            return false;
+
+        if (child->isInplace())
+            return false;
+        for (size_t j = 0; j < child->getChildEdges().size(); j++) {
+            if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
+                    input->getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle())
+                return false;
+        }
+    }
+    return true;
+}
+
+bool MKLDNNGraph::CanRebindOutput(const MKLDNNNodePtr& output) {
+    void * defaultPtr = output->getParentEdgeAt(0)->getMemory().GetPrimitivePtr()->get_data_handle();
+    // Cannot be in-place after concat because concat is using different ptrs without offsets
+    auto parent = output->getParentEdgeAt(0)->getParent();
+    MKLDNNNodePtr previousParent;
+    do {
+        previousParent = parent;
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace())
+            return false;
+
+        for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
+            if (parent->getParentEdgeAt(i)->getMemory().GetPrimitivePtr()->get_data_handle() == defaultPtr) {
+                parent = parent->getParentEdgeAt(i)->getParent();
+                break;
+            }
+        }
+    } while (previousParent != parent);
+    return true;
+}
+
+namespace {
+
+memory::format getInputBlobFormat(InferenceEngine::Layout layout, const MKLDNNDims& dims) {
+    if (layout == CHW && dims.ndims() == 4)
+        layout = NCHW;
+    return MKLDNNMemory::Convert(layout);
+}
+
+memory::data_type getInputBlobDataType(const InferenceEngine::Precision& precision) {
+    // U16 is unsupported by mkldnn, it is converted to FP32 before the reorder
+    if (precision == InferenceEngine::Precision::U16)
+        return memory::f32;
+    return MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
+}
+
+}  // namespace
+
+void MKLDNNGraph::InitBlobReorders(const ICNNNetwork &network) {
+    // the reorders for the layouts and precisions of the network inputs and outputs are created on load,
+    // so the inference does not generate their code unless the user sets blobs of other layouts
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+    for (const auto& input : inputs) {
+        auto node = inputNodes.find(input.first);
+        if (node == inputNodes.end())
+            continue;
+        const MKLDNNMemory &memory = node->second->getChildEdgeAt(0)->getMemory();
+        auto format = getInputBlobFormat(input.second->getLayout(), node->second->getChildEdgeAt(0)->getDims());
+        auto dataType = getInputBlobDataType(input.second->getPrecision());
+        if ((memory.GetFormat() != format || memory.GetDataType() != dataType) &&
+                MKLDNNMemory::isConsistant(memory.GetDims(), format))
+            GetBlobReorder(inputReorders, input.first, memory, dataType, format, true);
+    }
+
+    OutputsDataMap outputs;
+    network.getOutputsInfo(outputs);
+    for (auto& node : outputNodes) {
+        std::string name = node->getName().substr(4);
+        auto output = outputs.find(name);
+        if (output == outputs.end())
+            continue;
+        const MKLDNNMemory &memory = node->getParentEdgeAt(0)->getMemory();
+        auto format = MKLDNNMemory::Convert(output->second->getLayout());
+        if (format != memory::blocked && memory.GetFormat() != format &&
+                MKLDNNMemory::isConsistant(memory.GetDims(), format))
+            GetBlobReorder(outputReorders, name, memory, memory.GetDataType(), format, false);
+    }
+}
+
+const MKLDNNGraph::BlobReorder& MKLDNNGraph::GetBlobReorder(std::map<std::string, BlobReorder>& reorders,
+                                                            const std::string& name, const MKLDNNMemory& memory,
+                                                            memory::data_type dataType, memory::format format,
+                                                            bool isInput) {
+    auto found = reorders.find(name);
+    if (found != reorders.end() && found->second.dataType == dataType && found->second.format == format)
+        return found->second;
+
+    BlobReorder &reorder = reorders[name];
+    reorder.dataType = dataType;
+    reorder.format = format;
+    reorder.blobMemory.reset(new MKLDNNMemory(eng));
+    // the memory of the graph is a placeholder for the blob data, the data is bound on every execution
+    reorder.blobMemory->Create(memory.GetDims(), dataType, format, memory.GetData());
+    if (isInput)
+        reorder.reorder.reset(new mkldnn::reorder(reorder.blobMemory->GetPrimitive(), memory.GetPrimitive()));
+    else
+        reorder.reorder.reset(new mkldnn::reorder(memory.GetPrimitive(), reorder.blobMemory->GetPrimitive()));
+    if (status == Ready)
+        inferAllocations++;
+    return reorder;
+}
+
 void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
     if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
 
@@ -491,22 +867,57 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
     if (input != inputNodes.end()) {
         MKLDNNDims outDims = input->second->getChildEdgeAt(0)->getDims();
 
+        const MKLDNNMemory &inter_memory = input->second->getChildEdgeAt(0)->getMemory();
         const void *ext_data_ptr = in->cbuffer();
-        void *inter_data_ptr = input->second->getChildEdgeAt(0)->getMemory().GetData();
+        void *inter_data_ptr = inter_memory.GetData();
 
         if (ext_data_ptr != inter_data_ptr) {
-            auto l = in->getTensorDesc().getLayout();
-            if (l == CHW && input->second->getChildEdgeAt(0)->getDims().ndims() == 4)
-                l = NCHW;
-
-            input->second->getChildEdgeAt(0)->getMemory().SetData(
-                    MKLDNNExtensionUtils::IEPrecisionToDataType(in->getTensorDesc().getPrecision()),
-                    MKLDNNMemory::Convert(l), ext_data_ptr, in->byteSize(), false);
+            if (metrics)
+                metrics->inputCopyBytes += in->byteSize();
+            auto format = getInputBlobFormat(in->getTensorDesc().getLayout(), input->second->getChildEdgeAt(0)->getDims());
+
+            if (in->getTensorDesc().getPrecision() == InferenceEngine::Precision::U16) {
+                // U16 is unsupported by mkldnn, so the data is converted to FP32 without temporary blobs:
+                // right into the input memory if it has the same plain layout, otherwise via a reusable buffer
+                const uint16_t *src = in->cbuffer().as<const uint16_t *>() +
+                                      in->getTensorDesc().getBlockingDesc().getOffsetPadding();
+                size_t size = in->size();
+                float *dst = nullptr;
+                bool direct = inter_memory.GetFormat() == format && inter_memory.GetDataType() == memory::f32 &&
+                              inter_memory.GetDescriptor().data.layout_desc.blocking.offset_padding == 0 &&
+                              inter_memory.GetSize() == size * sizeof(float);
+                if (direct) {
+                    dst = static_cast<float *>(inter_data_ptr);
+                } else {
+                    auto &buffer = inputConversionBuffers[name];
+                    if (buffer.size() < size) {
+                        buffer.resize(size);
+                        inferAllocations++;
+                    }
+                    dst = buffer.data();
+                }
+                parallel_for(size, [&](size_t i) {
+                    dst[i] = static_cast<float>(src[i]);
+                });
+                if (!direct) {
+                    if (inter_memory.GetFormat() != format || inter_memory.GetDataType() != memory::f32)
+                        GetBlobReorder(inputReorders, name, inter_memory, memory::f32, format, true).execute(dst);
+                    else
+                        inter_memory.SetData(memory::f32, format, dst, size * sizeof(float), false);
+                }
+            } else {
+                // the reorder converts I16 and U8 to FP32 when the input has a mean image
+                auto dataType = getInputBlobDataType(in->getTensorDesc().getPrecision());
+                if (inter_memory.GetFormat() != format || inter_memory.GetDataType() != dataType)
+                    GetBlobReorder(inputReorders, name, inter_memory, dataType, format, true).execute(ext_data_ptr);
+                else
+                    inter_memory.SetData(dataType, format, ext_data_ptr, in->byteSize(), false);
+            }
         }
 
         // todo: make sure 'name' exists in this map...
         if (_meanImages.find(name) != _meanImages.end()) {
-            if (in->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
+            if (inter_memory.GetDataType() == memory::f32) {
                 _meanImages[name].Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr), in->getTensorDesc().getLayout());
             } else {
                 THROW_IE_EXCEPTION << "Mean image of type " << in->getTensorDesc().getPrecision().name() << " is unsupported";
@@ -554,6 +965,18 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
         // That is the same memory. No need to copy
         if (ext_blob_ptr == intr_blob_ptr) continue;
 
+        if (metrics)
+            metrics->outputCopyBytes += ext_blob->byteSize();
+
+        auto format = MKLDNNMemory::Convert(ext_blob->getTensorDesc().getLayout());
+        if (format != memory::blocked && format != intr_blob.GetFormat() &&
+                ext_blob->getTensorDesc().getPrecision() == Precision::FP32 &&
+                MKLDNNMemory::isConsistant(intr_blob.GetDims(), format)) {
+            // the whole batch is reordered, the batch limit only saves the copying
+            GetBlobReorder(outputReorders, name, intr_blob, intr_blob.GetDataType(), format, false).execute(ext_blob_ptr);
+            continue;
+        }
+
         int MB = intr_blob.GetDims()[0];
         int MB_to_process = node->batchToProcess();
         // TODO: Should we support InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT???
@@ -570,18 +993,21 @@ void MKLDNNGraph::Infer(int batch) {
         THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
     }
 
+    // the inferences are sampled randomly, so the measured ones do not follow periodic patterns of the requests
+    bool profile = config.collectPerfCounters &&
+                   (config.perfCountSampling <= 1 || perfSampler() % config.perfCountSampling == 0);
+
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
     for (int i = 0; i < graphNodes.size(); i++) {
-        PERF(graphNodes[i]);
-
         if (batch > 0)
             graphNodes[i]->setDynamicBatchLim(batch);
 
         ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
 
         if (!graphNodes[i]->isConstant()) {
+            PERF(graphNodes[i], profile, batch);
             IE_PROFILING_AUTO_SCOPE_TASK(graphNodes[i]->profilingTask)
-            graphNodes[i]->execute(stream);
+            ExecuteNode(graphNodes[i], stream);
         }
 
         ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
@@ -674,31 +1100,40 @@ void MKLDNNGraph::SortTopologically() {
 
 void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
     unsigned i = 0;
-    std::function<void(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &, const MKLDNNNodePtr&)>
-            getPerfMapFor = [&](std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap, const MKLDNNNodePtr& node) {
+    std::function<void(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &, const MKLDNNNodePtr&,
+                       const MKLDNNNodePtr&)>
+            getPerfMapFor = [&](std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap,
+                                const MKLDNNNodePtr& node, const MKLDNNNodePtr& host) {
         InferenceEngine::InferenceEngineProfileInfo &pc = perfMap[node->getName()];
         pc.execution_index = i++;
         // TODO: Why time counter is signed?
-        pc.cpu_uSec = pc.realTime_uSec = (long long) node->PerfCounter().avg();
-        pc.status = pc.cpu_uSec > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
-                                    : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
-        std::string pdType = node->getPrimitiveDescriptorType();
+        if (host) {
+            // the time of the fused and merged nodes is counted by the node executing them
+            pc.cpu_uSec = pc.realTime_uSec = 0;
+            pc.status = host->PerfCounter().count() > 0 ? InferenceEngine::InferenceEngineProfileInfo::OPTIMIZED_OUT
+                                                        : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
+        } else {
+            pc.cpu_uSec = pc.realTime_uSec = (long long) node->PerfCounter().avg();
+            pc.status = node->PerfCounter().count() > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
+                                                        : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
+        }
+        std::string pdType = (host ? host : node)->getPrimitiveDescriptorType();
         size_t typeLen = sizeof(pc.exec_type) / sizeof(pc.exec_type[0]);
         pdType.copy(pc.exec_type, typeLen, 0);
         size_t layerTypeLen = sizeof(pc.layer_type) / sizeof(pc.layer_type[0]);
         node->typeStr.copy(pc.layer_type, layerTypeLen, 0);
 
         for (auto& fusedNode : node->fusedWith) {
-            getPerfMapFor(perfMap, fusedNode);
+            getPerfMapFor(perfMap, fusedNode, host ? host : node);
         }
 
         for (auto& mergedWith : node->mergedWith) {
-            getPerfMapFor(perfMap, mergedWith);
+            getPerfMapFor(perfMap, mergedWith, host ? host : node);
         }
     };
 
     for (int i = 1; i < graphNodes.size(); i++) {
-        getPerfMapFor(perfMap, graphNodes[i]);
+        getPerfMapFor(perfMap, graphNodes[i], nullptr);
     }
 
     if (!config.dumpToDot.empty()) dumpToDotFile(config.dumpToDot + "_perf.dot");
@@ -929,7 +1364,7 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::ICNNNetwork &n
 InferenceEngine::InferRequestInternal::Ptr
 MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
                                           InferenceEngine::OutputsDataMap networkOutputs) {
-    if (graphs.size() > 1)  // streams uses special requests that are not connected to graphs
+    if (graphs.size() > 1 || sharedStreams)  // streams uses special requests that are not connected to graphs
         return std::make_shared<MKLDNNGraphlessInferRequest>(networkInputs, networkOutputs);
     else
         return std::make_shared<MKLDNNInferRequest>(networkInputs, networkOutputs);
@@ -948,7 +1383,19 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         cnnorm.NormalizeNetwork(*clonedNetwork, *pstats);
     }
 
-    bool ti_proc_ok = !NetPass::CombineRNNSeq(*clonedNetwork) ? NetPass::UnrollTI(*clonedNetwork) : true;
+    bool ti_proc_ok = true;
+    if (!NetPass::CombineRNNSeq(*clonedNetwork)) {
+        // The remaining TensorIterators are executed as loops over their bodies compiled once.
+        // They are unrolled only if some of them cannot be executed so.
+        bool ti_loops_ok = true;
+        for (const auto& layer : CNNNetSortTopologically(*clonedNetwork)) {
+            auto ti = std::dynamic_pointer_cast<InferenceEngine::TensorIterator>(layer);
+            if (ti && !MKLDNNTensorIteratorNode::isSupported(*ti))
+                ti_loops_ok = false;
+        }
+        if (!ti_loops_ok)
+            ti_proc_ok = NetPass::UnrollTI(*clonedNetwork);
+    }
     ti_proc_ok &= NetPass::UnrollRNN_if(*clonedNetwork, [] (const RNNCellBase &rnn) -> bool {
         if (rnn.clip != 0.0f)
             return true;
@@ -965,6 +1412,8 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
                               "None TI optimization pattern has been applied successfully";
 
 
+    MKLDNNConstantFolding::Statistics folding = MKLDNNConstantFolding::FoldConstants(*clonedNetwork, extensionManager);
+
     if (cfg.batchLimit > 1) {
         // check topology for applicability
         if (!CanProcessDynBatch(*clonedNetwork)) {
@@ -980,28 +1429,83 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
     const int threads = cfg.threadsNum ? cfg.threadsNum : (env_threads ? env_threads : hw_cores);
     const int threads_per_stream = std::max(1, threads/cfg.throughputStreams);
 
+    // the shared streams are partitioned by the pool of the process, the first network using them sets the partitions
+    sharedStreams = cfg.sharedStreams;
+    SharedStreamsPool::Ptr sharedPool;
+    if (sharedStreams)
+        sharedPool = SharedStreamsPool::get(cfg.throughputStreams, threads_per_stream, bPinningRequested);
+
+    // every stream is confined to a single NUMA node, the single stream uses all the nodes as before
+    std::vector<StreamPlacement> placements;
+    std::shared_ptr<CpuTopology> topology;
+    if (bPinningRequested && cfg.throughputStreams > 1 && !sharedStreams) {
+        cpu_set_t *processMask = nullptr;
+        int ncpus = 0;
+        if (get_process_mask(ncpus, processMask)) {
+            topology = std::make_shared<CpuTopology>(get_processors_of_mask(ncpus, processMask));
+            placements = topology->placeStreams(cfg.throughputStreams, threads_per_stream);
+            CPU_FREE(processMask);
+        }
+    }
+
     // graph(s) initialization in taskExecutor threads (streams), in parallel (in case of streams)
     std::vector<Task::Ptr> tasks;
 
+    metrics = std::make_shared<MetricsCollector>(cfg.throughputStreams);
     for (int n = 0; n < cfg.throughputStreams; n++) {
         MKLDNNGraph::Ptr _graph = std::make_shared<MKLDNNGraph>();
+        _graph->setMetrics(metrics, n);
         graphs.push_back(_graph);
         auto task = std::make_shared<InferenceEngine::Task>([=, &cfg, &network]() {
-            _graph->CreateArena(threads_per_stream);
+            if (sharedPool) {
+                // the graph runs in the arena of any shared stream, its own one just tells the concurrency
+                _graph->CreateArena(sharedPool->getThreadsPerStream());
+            } else {
+                _graph->CreateArena(threads_per_stream);
+            }
 
-            if (bPinningRequested) {
-                _graph->CreateObserver(n, threads_per_stream);
+            if (bPinningRequested && !sharedPool) {
+                if (static_cast<size_t>(n) < placements.size()) {
+                    _graph->CreateObserver(n, threads_per_stream, 1, placements[n].processors);
+                    _graph->setStreamPlacement("stream=" + std::to_string(n) + " " + topology->toString(placements[n]));
+                } else {
+                    _graph->CreateObserver(n, threads_per_stream);
+                }
             }
 
             _graph->setConfig(cfg);
+            if (cfg.memoryPooling || cfg.hugePages || cfg.numaMemoryBinding) {
+                int numaNode = -1;
+                if (cfg.numaMemoryBinding && static_cast<size_t>(n) < placements.size()) {
+                    numaNode = placements[n].node;
+                } else if (cfg.numaMemoryBinding && bPinningRequested && !sharedPool) {
+                    cpu_set_t *processMask = nullptr;
+                    int ncpus = 0;
+                    if (get_process_mask(ncpus, processMask)) {
+                        // the node of the first core of the stream
+                        numaNode = get_numa_node_of_vacant_core(n * threads_per_stream, 1, ncpus, processMask);
+                        CPU_FREE(processMask);
+                    }
+                }
+                _graph->setAllocator(std::make_shared<MKLDNNAllocator>(numaNode, cfg.hugePages, cfg.memoryPooling));
+            }
             _graph->CreateGraph(*clonedNetwork, extensionManager);
-            if (cfg.throughputStreams > 1)  // for streams, each worker thread has it's own graph
+            if (cfg.throughputStreams > 1 && !sharedPool)  // for streams, each worker thread has it's own graph
                 MKLDNNPlugin::MultiWorkerTaskExecutor::ptrContext.ptrGraph = _graph;
         });
         tasks.push_back(task);
     }
 
-    if (cfg.throughputStreams > 1) {
+    if (sharedPool) {
+        // the graphs are created by the shared streams as well, then the streams take them to run the requests
+        auto executor = std::make_shared<SharedStreamsExecutor>(sharedPool, clonedNetwork->getName(), cfg.streamsWeight,
+                                                                graphs, cfg.debugLog);
+        _taskExecutor = executor;
+        for (auto t : tasks)
+            executor->startTask(t);
+        for (auto t : tasks)
+            t->wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
+    } else if (cfg.throughputStreams > 1) {
         // special executor with as many threads as requested #streams, each with it's own initialization task
         _taskExecutor = std::make_shared<MultiWorkerTaskExecutor>(tasks);
     } else {
@@ -1015,6 +1519,30 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
     }
     for (auto t : tasks)
         t->checkException();
+
+    statePool = std::make_shared<MKLDNNStatePool>(*graphs[0]);
+
+    if (cfg.debugLog)
+        LogLoadInfo(clonedNetwork->getName(), folding);
+}
+
+void MKLDNNExecNetwork::LogLoadInfo(const std::string& name, const MKLDNNConstantFolding::Statistics& folding) const {
+    std::ostringstream log;
+    // the layers folded on load and the size of their results shared by the streams
+    if (folding.layers > 0)
+        log << "[ DEBUG ] CPU plugin: network " << name << ": constant folding " << folding.toString() << std::endl;
+    // the partitions of the streams shared by the networks of the process and the share of the network
+    auto sharedExecutor = std::dynamic_pointer_cast<SharedStreamsExecutor>(_taskExecutor);
+    if (sharedExecutor)
+        log << "[ DEBUG ] CPU plugin: network " << name << ": shared streams " << sharedExecutor->toString() << std::endl;
+    for (size_t n = 0; n < graphs.size(); n++) {
+        const std::string prefix = "[ DEBUG ] CPU plugin: network " + name + " graph " + std::to_string(n) + ": ";
+        if (!graphs[n]->getStreamPlacement().empty())
+            log << prefix << "placement " << graphs[n]->getStreamPlacement() << std::endl;
+        if (graphs[n]->getAllocator())
+            log << prefix << "memory allocator " << graphs[n]->getAllocator()->getStatisticsString() << std::endl;
+    }
+    std::cout << log.str() << std::flush;
 }
 
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
@@ -1023,21 +1551,74 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
 }
 
 void MKLDNNExecNetwork::CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) {
-    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
-    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
-    auto asyncRequestImpl = std::make_shared<MKLDNNAsyncInferRequest>(syncRequestImpl, _taskExecutor,
-                                                                      _taskSynchronizer, _callbackExecutor);
-    asyncRequest.reset(new InferRequestBase<MKLDNNAsyncInferRequest>(asyncRequestImpl),
+    Config cfg = graphs[0]->getProperty();
+    if (cfg.coalesceTimeout > 0) {
+        if (!cfg.enableDynamicBatch || cfg.batchLimit < 2)
+            THROW_IE_EXCEPTION << "Coalescing of requests requires dynamic batch with the limit greater than 1.";
+        InferRequestCoalescer::Ptr requestCoalescer;
+        {
+            // the inputs of the network are set after its construction, so the coalescer is created
+            // by the first request, and the requests may be created by several threads at once
+            std::lock_guard<std::mutex> lock(coalescerMutex);
+            if (!coalescer) {
+                // the batched requests are owned by the network, so they don't keep a pointer to it
+                std::vector<IAsyncInferRequestInternal::Ptr> batchedRequests;
+                for (size_t i = 0; i < graphs.size(); i++)
+                    batchedRequests.push_back(CreateAsyncInferRequestImpl(false));
+                coalescer = std::make_shared<InferRequestCoalescer>(batchedRequests, cfg.batchLimit,
+                                                                    std::chrono::microseconds(cfg.coalesceTimeout));
+            }
+            requestCoalescer = coalescer;
+        }
+        auto syncRequestImpl = std::make_shared<CoalescedInferRequest>(_networkInputs, _networkOutputs, requestCoalescer);
+        syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+        // a request waiting for its batch does not occupy a thread, it is completed by the worker of the coalescer
+        auto asyncRequestImpl = std::make_shared<CoalescedAsyncInferRequest>(syncRequestImpl, _callbackExecutor);
+        asyncRequestImpl->SetMetricsCollector(metrics);
+        asyncRequest.reset(new InferRequestBase<AsyncInferRequestThreadSafeDefault>(asyncRequestImpl),
+                           [](IInferRequest *p) { p->Release(); });
+        asyncRequestImpl->SetPointerToPublicInterface(asyncRequest);
+        return;
+    }
+
+    auto asyncRequestImpl = CreateAsyncInferRequestImpl(true);
+    asyncRequest.reset(new InferRequestBase<AsyncInferRequestThreadSafeDefault>(asyncRequestImpl),
                        [](IInferRequest *p) { p->Release(); });
 
     asyncRequestImpl->SetPointerToPublicInterface(asyncRequest);
+}
 
-    if (graphs.size() == 1) {  // single-stream (legacy/hetero) case - single graph for all requests
+InferenceEngine::AsyncInferRequestThreadSafeDefault::Ptr MKLDNNExecNetwork::CreateAsyncInferRequestImpl(bool linkToNetwork) {
+    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    if (linkToNetwork)
+        syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    auto asyncRequestImpl = std::make_shared<MKLDNNAsyncInferRequest>(syncRequestImpl, _taskExecutor,
+                                                                      _taskSynchronizer, _callbackExecutor);
+    // the batched requests of the coalescer are counted by the requests of the user
+    if (linkToNetwork)
+        asyncRequestImpl->SetMetricsCollector(metrics);
+
+    if (graphs.size() == 1 && !sharedStreams) {  // single-stream (legacy/hetero) case - single graph for all requests
         auto mkldnnSyncRequest = dynamic_cast<MKLDNNInferRequest *>(syncRequestImpl.get());
         if (!mkldnnSyncRequest)
             THROW_IE_EXCEPTION << " Cannot get mkldnn sync request.";
         mkldnnSyncRequest->SetGraph(graphs[0]);
+        mkldnnSyncRequest->SetStatePool(statePool);
+    } else {
+        auto mkldnnSyncRequest = dynamic_cast<MKLDNNGraphlessInferRequest *>(syncRequestImpl.get());
+        if (!mkldnnSyncRequest)
+            THROW_IE_EXCEPTION << " Cannot get mkldnn graphless sync request.";
+        mkldnnSyncRequest->SetStatePool(statePool);
     }
+    return asyncRequestImpl;
+}
+
+void MKLDNNExecNetwork::ReleaseSequence(size_t sequenceId) {
+    statePool->Release(sequenceId);
+}
+
+void MKLDNNExecNetwork::GetMetrics(InferenceEngine::ExecutableNetworkMetrics &result, bool reset) {
+    metrics->get(result, reset);
 }
 
 void MKLDNNExecNetwork::GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &graphPtr) {
@@ -8,7 +8,11 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <random>
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <cpp_interfaces/impl/ie_infer_request_coalescer.hpp>
+#include <cpp_interfaces/ie_metrics_collector.hpp>
 
 #include "ie_parallel.hpp"
 #include "mkldnn_memory.h"
@@ -20,9 +24,13 @@
 #include "mkldnn_edge.h"
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_streams.h"
+#include "mkldnn_allocator.h"
+#include "mkldnn_constant_folding.h"
 
 namespace MKLDNNPlugin {
 
+class MKLDNNStatePool;
+
 class MKLDNNGraph {
 public:
     typedef std::shared_ptr<MKLDNNGraph> Ptr;
@@ -78,6 +86,17 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    /**
+     * @brief Sets the allocator of the workspace, it must be set before the graph is created
+     */
+    void setAllocator(const MKLDNNAllocator::Ptr& alloc) {
+        allocator = alloc;
+    }
+
+    MKLDNNAllocator::Ptr getAllocator() const {
+        return allocator;
+    }
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void DropNode(const MKLDNNNodePtr& node);
@@ -90,29 +109,76 @@ public:
         #endif
     }
 
-    void CreateObserver(int _stream_id, int _threads_per_stream, int _pinning_step = 1) {
+    /**
+     * @brief Pins threads of the stream, to the given processors if they are specified,
+     * otherwise to the vacant cores in the round-robin scheme
+     */
+    void CreateObserver(int _stream_id, int _threads_per_stream, int _pinning_step = 1,
+                        const std::vector<int>& _processors = {}) {
         #if IE_THREAD == IE_THREAD_TBB
         ptrObserver
                 = std::unique_ptr<tbb::task_scheduler_observer>(
-                new pinning_observer(*ptrArena.get(), _stream_id, _threads_per_stream, _pinning_step));
+                new pinning_observer(*ptrArena.get(), _stream_id, _threads_per_stream, _pinning_step, _processors));
+        pinning.streamId = _stream_id;
+        pinning.threadsPerStream = _threads_per_stream;
+        pinning.step = _pinning_step;
+        pinning.processors = _processors;
         #else
-        cpu_set_t *process_mask = nullptr;
-        int ncpus = 0;
-        get_process_mask(ncpus, process_mask);
-            #if IE_THREAD == IE_THREAD_OMP
-            #pragma omp parallel for
-                    for (int thread_index = 0; thread_index < _threads_per_stream; thread_index++) {
-                        pin_thread_to_vacant_core(_stream_id * _threads_per_stream + thread_index, 1, ncpus, process_mask);
-                    }
-            #elif IE_THREAD == IE_THREAD_SEQ
-            pin_thread_to_vacant_core(_stream_id * _threads_per_stream, 1, ncpus, process_mask);
-            #endif
-        CPU_FREE(process_mask);
+        pin_stream_threads(_stream_id, _threads_per_stream, _processors);
         #endif
     }
 
+    /**
+     * @brief Sets description of the stream placement, the NUMA node and the processors of the stream running the graph
+     */
+    void setStreamPlacement(const std::string& placement) {
+        streamPlacement = placement;
+    }
+
+    const std::string& getStreamPlacement() const {
+        return streamPlacement;
+    }
+
+    /**
+     * @brief Sets the metrics of the executable network, the graph counts the copied bytes and its busy time as the stream
+     */
+    void setMetrics(const InferenceEngine::MetricsCollector::Ptr& collector, size_t stream) {
+        metrics = collector;
+        metricsStream = stream;
+    }
+
     InferenceEngine::ICNNNetwork::Ptr dump() const;
 
+    /**
+     * @brief Data of a MemoryInput node kept by the graph between inferences
+     */
+    struct MemoryState {
+        std::string id;
+        // all the edges that refer to the state data (peers and in-place consumers)
+        std::vector<MKLDNNEdgePtr> edges;
+        void *defaultPtr;
+        size_t size;
+        size_t batch;
+        // the state is placed batch item by batch item, so a part of the batch can be copied
+        bool isBatchOuter;
+        // no consumer keeps the data pointer, so the state data can be replaced by pointer
+        bool canBeSwapped;
+    };
+
+    std::vector<MemoryState>& GetMemoryStates() {
+        return memoryStates;
+    }
+
+    /**
+     * @brief Checks if the data of the input node can be replaced by pointer, so no consumer keeps its own pointer
+     */
+    static bool CanRebindInput(const MKLDNNNodePtr& input);
+
+    /**
+     * @brief Checks if the data of the output node can be replaced by pointer, so the producer writes right to it
+     */
+    static bool CanRebindOutput(const MKLDNNNodePtr& output);
+
 protected:
     void VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes);
     void SortTopologically();
@@ -125,23 +191,77 @@ protected:
         outputNodes.clear();
         graphNodes.clear();
         graphEdges.clear();
+        memoryStates.clear();
         _meanImages.clear();
+        inputConversionBuffers.clear();
+        inputReorders.clear();
+        outputReorders.clear();
     }
     Status status;
     Config config;
 
     MKLDNNMemoryPtr memWorkspace;
+    MKLDNNAllocator::Ptr allocator;
+    // the workspace memory if it is provided by the allocator
+    std::shared_ptr<void> workspaceData;
+    std::string streamPlacement;
+    InferenceEngine::MetricsCollector::Ptr metrics;
+    size_t metricsStream = 0;
+    // chooses the inferences measured by the performance counters, see Config::perfCountSampling
+    std::minstd_rand perfSampler{std::random_device()()};
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
+    std::vector<MemoryState> memoryStates;
 
     std::map<std::string, MeanImage> _meanImages;
 
+    // FP32 buffers for inputs of precisions unsupported by mkldnn, reused between inferences
+    std::map<std::string, std::vector<float>> inputConversionBuffers;
+    // number of heap allocations made on the inference path since the graph was created, read by the unit tests
+    size_t inferAllocations = 0;
+
+    /**
+     * @brief Reorder between the data of an input or output blob and the memory of the graph.
+     * It is created once for the format and the precision of the blob, the blob data is bound to it before execution.
+     */
+    struct BlobReorder {
+        mkldnn::memory::data_type dataType;
+        mkldnn::memory::format format;
+        MKLDNNMemoryPtr blobMemory;
+        std::shared_ptr<mkldnn::reorder> reorder;
+
+        void execute(const void *data) const {
+            blobMemory->GetPrimitive().set_data_handle(const_cast<void *>(data));
+            mkldnn::stream(mkldnn::stream::kind::eager).submit({*reorder});
+        }
+    };
+    std::map<std::string, BlobReorder> inputReorders;
+    std::map<std::string, BlobReorder> outputReorders;
+
+    /**
+     * @brief Returns the cached reorder of the blob, creates it if the format or the precision of the blob changed
+     */
+    const BlobReorder& GetBlobReorder(std::map<std::string, BlobReorder>& reorders, const std::string& name,
+                                      const MKLDNNMemory& memory, mkldnn::memory::data_type dataType,
+                                      mkldnn::memory::format format, bool isInput);
+
     #if IE_THREAD == IE_THREAD_TBB
     std::unique_ptr<tbb::task_arena> ptrArena;
     std::unique_ptr<tbb::task_scheduler_observer> ptrObserver;
+    // arenas of the nodes executed by fewer threads than the stream has, indexed by the number of threads
+    std::vector<std::unique_ptr<tbb::task_arena>> nodeArenas;
+    // pin the workers joining the arenas of the nodes to the cores of the stream, destroyed before the arenas
+    std::vector<std::unique_ptr<tbb::task_scheduler_observer>> nodeObservers;
+    // parameters of the observer of the stream, the stream is not pinned if streamId is negative
+    struct {
+        int streamId = -1;
+        int threadsPerStream = 0;
+        int step = 1;
+        std::vector<int> processors;
+    } pinning;
     #endif
     mkldnn::engine eng;
 
@@ -152,12 +272,17 @@ protected:
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
+    void InitNodesParallelism();
+    void ExecuteNode(const MKLDNNNodePtr& node, mkldnn::stream& stream);
+    void InitMemoryStates();
+    void InitBlobReorders(const InferenceEngine::ICNNNetwork &network);
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
     void do_after(const std::string &dir, const MKLDNNNodePtr &node);
 
     friend class MKLDNNInferRequest;
     friend class MKLDNNGraphlessInferRequest;
+    friend class MKLDNNTensorIteratorNode;
     friend std::shared_ptr<InferenceEngine::ICNNNetwork> dump_graph_as_ie_net(const MKLDNNGraph &graph);
 
 private:
@@ -183,6 +308,7 @@ public:
                       const MKLDNNExtensionManager::Ptr& extMgr);
 
     ~MKLDNNExecNetwork() {
+        coalescer.reset();
         graphs.clear();
         extensionManager.reset();
     }
@@ -191,11 +317,29 @@ public:
 
     void GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &graphPtr) override;
 
+    void ReleaseSequence(size_t sequenceId) override;
+
+    void GetMetrics(InferenceEngine::ExecutableNetworkMetrics &result, bool reset) override;
+
 protected:
     std::vector<MKLDNNGraph::Ptr> graphs;
+    std::shared_ptr<MKLDNNStatePool> statePool;
+    InferenceEngine::MetricsCollector::Ptr metrics;
+    InferenceEngine::InferRequestCoalescer::Ptr coalescer;
+    std::mutex coalescerMutex;
     MKLDNNExtensionManager::Ptr extensionManager;
+    // the requests run on the streams shared by the networks of the process
+    bool sharedStreams = false;
 
     bool CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network) const;
+
+    /**
+     * @brief Prints the facts of the load which are not layers with KEY_LOG_LEVEL set to LOG_DEBUG,
+     * they are reported once as they do not change with the inferences
+     */
+    void LogLoadInfo(const std::string& name, const MKLDNNConstantFolding::Statistics& folding) const;
+
+    InferenceEngine::AsyncInferRequestThreadSafeDefault::Ptr CreateAsyncInferRequestImpl(bool linkToNetwork);
 };
 
 }  // namespace MKLDNNPlugin
@@ -11,6 +11,8 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <sstream>
+#include <iomanip>
 
 using namespace InferenceEngine;
 
@@ -161,8 +163,20 @@ void copy_node_metadata(const MKLDNNNodePtr &node, CNNLayer::Ptr &layer) {
     layer->params[ExecGraphInfoSerialization::PRECISION] = precision;
 
     // Performance
-    if (node->PerfCounter().avg() != 0) {
-        layer->params[ExecGraphInfoSerialization::PERF_COUNTER] = std::to_string(node->PerfCounter().avg());
+    PerfCount &perf = node->PerfCounter();
+    if (perf.getFlops() != 0) {
+        layer->params[ExecGraphInfoSerialization::FLOPS] = std::to_string(perf.getFlops());
+    }
+    if (perf.count() != 0) {
+        layer->params[ExecGraphInfoSerialization::PERF_COUNTER] = std::to_string(perf.avg());
+        layer->params[ExecGraphInfoSerialization::PERF_COUNTER_MIN] = std::to_string(perf.minimum());
+        layer->params[ExecGraphInfoSerialization::PERF_COUNTER_P99] = std::to_string(perf.p99());
+        layer->params[ExecGraphInfoSerialization::PERF_COUNTER_SAMPLES] = std::to_string(perf.count());
+        if (perf.getFlops() != 0) {
+            std::ostringstream gflops;
+            gflops << std::fixed << std::setprecision(2) << perf.gflops();
+            layer->params[ExecGraphInfoSerialization::ACHIEVED_GFLOPS] = gflops.str();
+        }
     } else {
         layer->params[ExecGraphInfoSerialization::PERF_COUNTER] = "not_executed";  // it means it was not calculated yet
     }
@@ -193,6 +207,12 @@ void drawer_callback(const InferenceEngine::CNNLayerPtr layer,
         node_properties.push_back({"fillcolor", prec->second == "FP32" ? GREEN : BLUE});
     }
 
+    // Achieved performance
+    auto gflops = params.find(ExecGraphInfoSerialization::ACHIEVED_GFLOPS);
+    if (gflops != params.end()) {
+        printed_properties.push_back({"gflops", gflops->second});
+    }
+
     // Set xlabel containing PM data if calculated
     auto perf = layer->params.find(ExecGraphInfoSerialization::PERF_COUNTER);
     node_properties.push_back({"xlabel", (perf != layer->params.end()) ? perf->second : ""});
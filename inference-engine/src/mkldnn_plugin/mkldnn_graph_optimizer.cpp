@@ -11,6 +11,7 @@
 #include "nodes/mkldnn_depthwise_node.h"
 #include "nodes/mkldnn_concat_node.h"
 #include "nodes/mkldnn_reorder_node.h"
+#include "nodes/mkldnn_generic_node.h"
 
 #include <string>
 #include <list>
@@ -52,6 +53,9 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseFullyConnectedAndActivation(graph);
     graph.RemoveDroppedNodes();
 
+    FuseGenericAndSimpleOperation(graph);
+    graph.RemoveDroppedNodes();
+
     RemoveIdentityOperator(graph);
     graph.RemoveDroppedNodes();
 
@@ -658,6 +662,30 @@ void MKLDNNGraphOptimizer::FuseFullyConnectedAndActivation(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::FuseGenericAndSimpleOperation(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        if (graphNodes[i]->getType() != Generic)
+            continue;
+
+        auto* genericNode = dynamic_cast<MKLDNNGenericNode *>(graphNodes[i].get());
+        if (genericNode == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get generic node " << graphNodes[i]->getName();
+
+        // Activations and ScaleShifts following Resample, Interp, MVN or Normalize are applied
+        // in place on the output, so no separate nodes (and reorders around them) are needed
+        while (genericNode->getChildEdges().size() == 1) {
+            auto child = genericNode->getChildEdgeAt(0)->getChild();
+            if (!genericNode->canFuse(child))
+                break;
+
+            genericNode->fuseWith(child);
+            graph.DropNode(child);
+        }
+    }
+}
+
 void MKLDNNGraphOptimizer::RemoveIdentityOperator(MKLDNNGraph &graph) {
     for (MKLDNNNodePtr& node : graph.GetNodes()) {
         bool toDrop = false;
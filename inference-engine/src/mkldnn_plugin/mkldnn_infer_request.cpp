@@ -9,8 +9,6 @@
 #include <string>
 #include <map>
 #include <blob_factory.hpp>
-#include <nodes/mkldnn_concat_node.h>
-#include <nodes/mkldnn_split_node.h>
 
 MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsDataMap networkInputs,
                                                      InferenceEngine::OutputsDataMap networkOutputs)
@@ -37,12 +35,13 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
         THROW_IE_EXCEPTION << "Network not loaded.";
     }
     auto infer = [this] {
+        auto start = InferenceEngine::MetricsCollector::Clock::now();
         // execute input pre-processing.
         execDataPreprocessing(_inputs);
+        if (graph->metrics && !_preProcData.empty())
+            graph->metrics->preprocessing.add(InferenceEngine::MetricsCollector::sinceUs(start));
 
         changeDefaultPtr();
-        // need to retain converted blobs until infer finish
-        std::vector<InferenceEngine::Blob::Ptr> convertedInputs;
         for (auto input : _inputs) {
             if (!_networkInputs[input.first]) {
                 THROW_IE_EXCEPTION <<
@@ -58,8 +57,6 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
 
 
 
-            InferenceEngine::Blob::Ptr iconv;
-            InferenceEngine::TBlob<float> *in_f = nullptr;
             switch (input.second->precision()) {
                 case InferenceEngine::Precision::FP32:
                     pushInput<float>(input.first, input.second);
@@ -71,60 +68,26 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
                     pushInput<int8_t>(input.first, input.second);
                     break;
                 case InferenceEngine::Precision::U16:
-                    // U16 is unsupported by mkldnn, so here we convert the blob and send FP32
-                    iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
-                            InferenceEngine::Precision::FP32,
-                            input.second->getTensorDesc().getLayout(), input.second->dims());
-                    convertedInputs.push_back(iconv);
-                    iconv->allocate();
-                    in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                    if (in_f == nullptr)
-                        THROW_IE_EXCEPTION << "Cannot get TBlob";
-                    InferenceEngine::copyToFloat<uint16_t>(in_f->data(), input.second.get());
-                    pushInput<float>(input.first, iconv);
+                    // U16 is unsupported by mkldnn, the graph converts it to FP32 on the way to the input memory
+                    pushInput<uint16_t>(input.first, input.second);
                     break;
                 case InferenceEngine::Precision::I16:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
-                                InferenceEngine::Precision::FP32,
-                                input.second->getTensorDesc().getLayout(), input.second->dims());
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        if (in_f == nullptr)
-                            THROW_IE_EXCEPTION << "Cannot get TBlob";
-                        InferenceEngine::copyToFloat<int16_t>(in_f->data(), input.second.get());
-                        pushInput<float>(input.first, iconv);
-                    } else {
-                        // Instead we can send I16 directly
-                        pushInput<int16_t>(input.first, input.second);
-                    }
+                    pushInput<int16_t>(input.first, input.second);
                     break;
                 case InferenceEngine::Precision::U8:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
-                                InferenceEngine::Precision::FP32,
-                                input.second->getTensorDesc().getLayout(), input.second->dims());
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        if (in_f == nullptr)
-                            THROW_IE_EXCEPTION << "Cannot get TBlob";
-                        InferenceEngine::copyToFloat<uint8_t>(in_f->data(), input.second.get());
-                        pushInput<float>(input.first, iconv);
-                    } else {
-                        // Instead we can send I8 directly
-                        pushInput<uint8_t>(input.first, input.second);
-                    }
+                    pushInput<uint8_t>(input.first, input.second);
                     break;
                 default:
                     THROW_IE_EXCEPTION << "Unsupported input precision " << input.second->precision();
             }
         }
+        std::unique_ptr<MKLDNNStatePool::Binding> states;
+        if (!sequenceIds.empty())
+            states.reset(new MKLDNNStatePool::Binding(*statePool, *graph, sequenceIds, m_curBatch));
         graph->Infer(m_curBatch);
         graph->PullOutputData(_outputs);
+        if (graph->metrics)
+            graph->metrics->addStreamBusy(graph->metricsStream, InferenceEngine::MetricsCollector::sinceUs(start));
     };
 #if IE_THREAD == IE_THREAD_TBB
     auto_scope_observing observer(graph->ptrObserver);
@@ -173,7 +136,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
             desc = InferenceEngine::TensorDesc(p, dims, l);
         }
 
-        _inputs[name] = make_blob_with_precision(desc);
+        _inputs[name] = makeBlob(desc);
         _inputs[name]->allocate();
         if (desc.getPrecision() == originPrecision &&
                 graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
@@ -193,7 +156,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
             return;
         }
 
-        _outputs[name] = make_blob_with_precision(blobs[name]->getTensorDesc());
+        _outputs[name] = makeBlob(blobs[name]->getTensorDesc());
         _outputs[name]->allocate();
         if (blobs[name]->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
                 !graph->getProperty().batchLimit) {
@@ -272,28 +235,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
         if (input != graph->inputNodes.end()) {
             if (input->second->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
                 continue;
-            // Input cannot be in-place with other primitives
-            bool canBeInPlace = true;
-            for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
-                auto& child = input->second->getChildEdgeAt(i)->getChild();
-                if (child->isConstant())
-                    canBeInPlace = false;
-                auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
-                if (canBeInPlace && concat && concat->isOptimized())
-                    canBeInPlace = false;
-                // Cannot be in-place before split because split is using different ptrs without offsets
-                auto* split = dynamic_cast<MKLDNNSplitNode *>(child.get());
-                if (canBeInPlace && split)
-                    canBeInPlace = false;
-
-                if (child->isInplace())
-                    canBeInPlace = false;
-                for (size_t j = 0; canBeInPlace && j < child->getChildEdges().size(); j++) {
-                    if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
-                            input->second->getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle())
-                        canBeInPlace = false;
-                }
-            }
+            bool canBeInPlace = MKLDNNGraph::CanRebindInput(input->second);
             for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
                 changeEdgePtr(input->second->getChildEdgeAt(i), it.second);
             }
@@ -310,26 +252,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
         if (output) {
             if (output->getParentEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
                 continue;
-            bool canBeInPlace = true;
-            void * defaultPtr = output->getParentEdgeAt(0)->getMemory().GetPrimitivePtr()->get_data_handle();
-            // Cannot be in-place after concat because concat is using different ptrs without offsets
-            auto parent = output->getParentEdgeAt(0)->getParent();
-            MKLDNNNodePtr previousParent;
-            do {
-                previousParent = parent;
-                if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
-                    if (parent->getParentEdgeAt(i)->getMemory().GetPrimitivePtr()->get_data_handle() == defaultPtr) {
-                        parent = parent->getParentEdgeAt(i)->getParent();
-                        break;
-                    }
-                }
-            } while (previousParent != parent);
-            if (canBeInPlace)
+            if (MKLDNNGraph::CanRebindOutput(output))
                 changeEdgePtr(output->getParentEdgeAt(0), it.second);
             continue;
         }
@@ -337,6 +260,14 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
     }
 }
 
+InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::makeBlob(const InferenceEngine::TensorDesc& desc) {
+    // the blobs are placed the same way as the graph memory
+    auto allocator = graph->getAllocator();
+    if (allocator)
+        return make_blob_with_precision(desc, allocator);
+    return make_blob_with_precision(desc);
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::SetGraph(const MKLDNNPlugin::MKLDNNGraph::Ptr &graph) {
     this->graph = graph;
 
@@ -365,3 +296,13 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBatch(int new_batch) {
 
     m_curBatch = new_batch;
 }
+
+void MKLDNNPlugin::MKLDNNInferRequest::SetSequences(const std::vector<size_t> &sequenceIds) {
+    if (!statePool || statePool->empty())
+        THROW_IE_EXCEPTION << "Network has no memory states.";
+    this->sequenceIds = sequenceIds;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::SetStatePool(const MKLDNNStatePool::Ptr &pool) {
+    statePool = pool;
+}
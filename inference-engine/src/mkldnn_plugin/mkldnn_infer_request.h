@@ -5,6 +5,7 @@
 #pragma once
 
 #include "mkldnn_graph.h"
+#include "mkldnn_memory_state.h"
 #include <memory>
 #include <string>
 #include <map>
@@ -40,11 +41,18 @@ public:
 
     void SetBatch(int batch = -1) override;
 
+    void SetSequences(const std::vector<size_t> &sequenceIds) override;
+
+    void SetStatePool(const MKLDNNStatePool::Ptr& pool);
+
 private:
     template <typename T> void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob);
+    InferenceEngine::Blob::Ptr makeBlob(const InferenceEngine::TensorDesc& desc);
 
     void changeDefaultPtr();
     MKLDNNGraph::Ptr graph;
     std::map<std::string, void*> externalPtr;
+    MKLDNNStatePool::Ptr statePool;
+    std::vector<size_t> sequenceIds;
 };
 }  // namespace MKLDNNPlugin
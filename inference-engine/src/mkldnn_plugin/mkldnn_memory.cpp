@@ -56,7 +56,7 @@ void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data) {
         prim.reset(new memory(primitive_desc));
 
         size_t real_size = 0;
-        if (desc.data.format == mkldnn_wino_fmt)
+        if (desc.data.format == mkldnn_wino_fmt || desc.data.format == mkldnn_rnn_packed)
             return;
         if (prim->get_primitive_desc().desc().data.ndims > 0) {
             real_size = static_cast<size_t>(prim->get_primitive_desc().desc().data.layout_desc.blocking.padding_dims[0]);
@@ -74,6 +74,21 @@ void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data) {
     }
 }
 
+void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const MKLDNNAllocator::Ptr& allocator) {
+    auto primitive_desc = memory::primitive_desc(desc, eng);
+    size_t size = primitive_desc.get_size();
+    MKLDNNAllocator::Ptr alloc = allocator;
+    std::shared_ptr<void> data(alloc->alloc(size), [alloc](void *ptr) {
+        if (ptr) alloc->free(ptr);
+    });
+    if (!data)
+        THROW_IE_EXCEPTION << "Cannot allocate memory of " << size << " bytes";
+    // padded areas of the blocked formats must be zero
+    memset(data.get(), 0, size);
+    prim.reset(new memory(primitive_desc, data.get()));
+    allocatedData = data;
+}
+
 void MKLDNNMemory::SetData(memory::data_type dataType, memory::format format, const void* data, size_t size, bool ftz) const {
     uint8_t itemSize = MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type(dataType));
 
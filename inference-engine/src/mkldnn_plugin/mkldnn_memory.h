@@ -9,6 +9,7 @@
 
 #include "inference_engine.hpp"
 #include "mkldnn_dims.h"
+#include "mkldnn_allocator.h"
 #include <mkldnn.hpp>
 #include <string>
 #include <mkldnn_types.h>
@@ -103,6 +104,11 @@ public:
 
     void Create(const mkldnn::memory::desc& desc, const void* data = nullptr);
 
+    /**
+     * @brief Creates zero-filled memory in a buffer of the allocator, the buffer is released with the memory
+     */
+    void Create(const mkldnn::memory::desc& desc, const MKLDNNAllocator::Ptr& allocator);
+
     void SetData(mkldnn::memory::data_type dataType, mkldnn::memory::format format, const void* data, size_t size, bool ftz = true) const;
     void SetData(const MKLDNNMemory& memory, bool ftz = true) const;
 
@@ -120,6 +126,7 @@ public:
 
 private:
     std::shared_ptr<mkldnn::memory> prim;
+    std::shared_ptr<void> allocatedData;
     mkldnn::engine eng;
 };
 
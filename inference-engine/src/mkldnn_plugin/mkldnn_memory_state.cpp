@@ -0,0 +1,107 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_memory_state.h"
+#include <cstring>
+#include <vector>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+struct MKLDNNStatePool::Sequence {
+    std::vector<MKLDNNMemoryPtr> states;
+    bool busy = false;
+};
+
+MKLDNNStatePool::MKLDNNStatePool(MKLDNNGraph &graph) : eng(graph.getEngine()) {
+    for (auto &state : graph.GetMemoryStates())
+        itemSizes.push_back(state.size / state.batch);
+}
+
+std::vector<std::shared_ptr<MKLDNNStatePool::Sequence>>
+MKLDNNStatePool::acquire(const std::vector<size_t> &sequenceIds) {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<std::shared_ptr<Sequence>> result;
+    for (auto id : sequenceIds) {
+        auto &sequence = sequences[id];
+        if (!sequence) {
+            // a new sequence starts from zero state
+            sequence = std::make_shared<Sequence>();
+            for (auto size : itemSizes) {
+                MKLDNNMemoryPtr state = std::make_shared<MKLDNNMemory>(eng);
+                state->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {size}, Layout::C)));
+                memset(state->GetData(), 0, size);
+                sequence->states.push_back(state);
+            }
+        }
+        if (sequence->busy) {
+            for (auto &acquired : result)
+                acquired->busy = false;
+            THROW_IE_EXCEPTION << REQUEST_BUSY_str << "Sequence " << id << " is processed by another request";
+        }
+        sequence->busy = true;
+        result.push_back(sequence);
+    }
+    return result;
+}
+
+void MKLDNNStatePool::release(const std::vector<std::shared_ptr<Sequence>> &sequences) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto &sequence : sequences)
+        sequence->busy = false;
+}
+
+void MKLDNNStatePool::Release(size_t sequenceId) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto sequence = sequences.find(sequenceId);
+    if (sequence == sequences.end())
+        THROW_IE_EXCEPTION << NOT_FOUND_str << "Sequence " << sequenceId << " has no memory state";
+    if (sequence->second->busy)
+        THROW_IE_EXCEPTION << REQUEST_BUSY_str << "Sequence " << sequenceId << " is processed by another request";
+    sequences.erase(sequence);
+}
+
+MKLDNNStatePool::Binding::Binding(MKLDNNStatePool &pool, MKLDNNGraph &graph,
+                                  const std::vector<size_t> &sequenceIds, int batch) : pool(pool), graph(graph) {
+    auto &states = graph.GetMemoryStates();
+    for (auto &state : states) {
+        size_t maxSequences = batch > 0 ? std::min(static_cast<size_t>(batch), state.batch) : state.batch;
+        if (sequenceIds.size() > maxSequences)
+            THROW_IE_EXCEPTION << "Number of sequences " << sequenceIds.size() << " exceeds the batch size " << maxSequences;
+        if (sequenceIds.size() > 1 && !state.isBatchOuter)
+            THROW_IE_EXCEPTION << "Memory state " << state.id << " cannot be split by batch items";
+    }
+
+    sequences = pool.acquire(sequenceIds);
+    swapped.resize(states.size());
+    for (size_t i = 0; i < states.size(); i++) {
+        auto &state = states[i];
+        swapped[i] = sequences.size() == 1 && state.batch == 1 && state.canBeSwapped;
+        if (swapped[i]) {
+            void *data = sequences[0]->states[i]->GetData();
+            for (auto &edge : state.edges)
+                edge->getMemory().GetPrimitivePtr()->set_data_handle(data);
+        } else {
+            size_t itemSize = pool.itemSizes[i];
+            for (size_t n = 0; n < sequences.size(); n++)
+                memcpy(static_cast<uint8_t *>(state.defaultPtr) + n * itemSize, sequences[n]->states[i]->GetData(), itemSize);
+        }
+    }
+}
+
+MKLDNNStatePool::Binding::~Binding() {
+    auto &states = graph.GetMemoryStates();
+    for (size_t i = 0; i < states.size(); i++) {
+        auto &state = states[i];
+        if (swapped[i]) {
+            for (auto &edge : state.edges)
+                edge->getMemory().GetPrimitivePtr()->set_data_handle(state.defaultPtr);
+        } else {
+            size_t itemSize = pool.itemSizes[i];
+            for (size_t n = 0; n < sequences.size(); n++)
+                memcpy(sequences[n]->states[i]->GetData(), static_cast<uint8_t *>(state.defaultPtr) + n * itemSize, itemSize);
+        }
+    }
+    pool.release(sequences);
+}
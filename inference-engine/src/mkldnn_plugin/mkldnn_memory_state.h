@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "mkldnn_graph.h"
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Keeps the memory states of the sequences processed by an executable network.
+ * Any infer request can pick up a sequence: a state of a single sequence is swapped into the graph by pointer
+ * (when the graph allows that), the states of several sequences are copied to the batch items of the graph.
+ */
+class MKLDNNStatePool {
+    struct Sequence;
+
+public:
+    typedef std::shared_ptr<MKLDNNStatePool> Ptr;
+
+    explicit MKLDNNStatePool(MKLDNNGraph &graph);
+
+    bool empty() const {
+        return itemSizes.empty();
+    }
+
+    /**
+     * @brief Pushes states of the sequences into the graph on construction and pulls them back on destruction.
+     * The sequences are locked for the lifetime of the object.
+     */
+    class Binding {
+    public:
+        Binding(MKLDNNStatePool &pool, MKLDNNGraph &graph, const std::vector<size_t> &sequenceIds, int batch);
+        ~Binding();
+
+    private:
+        MKLDNNStatePool &pool;
+        MKLDNNGraph &graph;
+        std::vector<std::shared_ptr<Sequence>> sequences;
+        std::vector<bool> swapped;
+    };
+
+    void Release(size_t sequenceId);
+
+private:
+    std::vector<std::shared_ptr<Sequence>> acquire(const std::vector<size_t> &sequenceIds);
+    void release(const std::vector<std::shared_ptr<Sequence>> &sequences);
+
+    mkldnn::engine eng;
+    // size of a state per batch item, in the graph order of states
+    std::vector<size_t> itemSizes;
+    std::mutex mutex;
+    std::unordered_map<size_t, std::shared_ptr<Sequence>> sequences;
+};
+
+}  // namespace MKLDNNPlugin
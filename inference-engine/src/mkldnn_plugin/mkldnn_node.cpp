@@ -38,6 +38,7 @@
 #include <nodes/mkldnn_rnn.h>
 #include <nodes/mkldnn_quantize_node.h>
 #include <nodes/mkldnn_bin_conv_node.h>
+#include <nodes/mkldnn_tensoriterator_node.h>
 #include <mkldnn_types.h>
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_plugin.h"
@@ -77,6 +78,7 @@ MKLDNNNode::Register<MKLDNNBinaryConvolutionNode> MKLDNNBinaryConvolutionNode::r
 MKLDNNNode::Register<MKLDNNMemoryInputNode> MKLDNNMemoryInputNode::reg;
 MKLDNNNode::Register<MKLDNNMemoryOutputNode> MKLDNNMemoryOutputNode::reg;
 MKLDNNNode::Register<MKLDNNRNN> MKLDNNRNN::reg;
+MKLDNNNode::Register<MKLDNNTensorIteratorNode> MKLDNNTensorIteratorNode::reg;
 
 MKLDNNNode::MKLDNNNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng)
         : cnnLayer(layer), name(layer->name), typeStr(layer->type), type(TypeFromName(layer->type)), engine(eng),
@@ -602,13 +604,19 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
         const auto &internalBlob = internalBlobs[i];
 
         const uint64_t data_hash =  Engine::GetWeightsSharing().GetHashFunc().hash(internalBlob->buffer(), internalBlob->byteSize());
-        const std::string string_hash = name + "_" + std::to_string(i)
+        std::string string_hash = name + "_" + std::to_string(i)
                                      + "_" + std::to_string(internalBlob->byteSize())
                                      + "_" + std::to_string(data_hash);
+        // every NUMA node has its own replica of the weights
+        if (weightsAllocator && weightsAllocator->getNumaNode() >= 0)
+            string_hash += "_node" + std::to_string(weightsAllocator->getNumaNode());
         MKLDNNMemoryPtr ptr =
                 Engine::GetWeightsSharing().findOrCreate(string_hash, [&] () {
                     MKLDNNMemoryPtr _ptr = MKLDNNMemoryPtr(new MKLDNNMemory(engine));
-                    _ptr->Create(intDescs[i]);
+                    if (weightsAllocator)
+                        _ptr->Create(intDescs[i], weightsAllocator);
+                    else
+                        _ptr->Create(intDescs[i]);
                     MKLDNNMemory memory(engine);
 
                     auto newDesc = MKLDNNMemoryDesc(internalBlob->getTensorDesc());
@@ -770,6 +778,8 @@ std::string MKLDNNNode::typeToStr(Type type) {
             return "RNNSeq";
         case RNNCell:
             return "RNNCell";
+        case TensorIterator:
+            return "TensorIterator";
 
         default:
             return "Unknown";
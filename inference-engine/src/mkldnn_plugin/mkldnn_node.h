@@ -64,7 +64,8 @@ enum Type {
     RNNCell,
     RNNSeq,
     Quantize,
-    BinaryConvolution
+    BinaryConvolution,
+    TensorIterator
 };
 
 static Type TypeFromName(const std::string type) {
@@ -118,6 +119,7 @@ static Type TypeFromName(const std::string type) {
             { "RNNSequence", RNNSeq },
             { "Quantize", Quantize },
             { "BinaryConvolution", BinaryConvolution },
+            { "TensorIterator", TensorIterator },
             { "MemoryInput", MemoryInput},  // for construction from name ctor, arbitrary name is used
             { "Memory", MemoryOutput },  // for construction from layer ctor
     };
@@ -258,6 +260,11 @@ public:
 
     PerfCount &PerfCounter() { return perfCounter; }
 
+    /**
+     * @brief Returns the number of threads executing the node, 0 means all threads of the stream
+     */
+    int getExecThreads() const { return execThreads; }
+
     virtual void setDynamicBatchLim(int lim);
 
     void resolveNotAllocatedEdges();
@@ -378,6 +385,10 @@ protected:
     ConstantType constant = ConstantType::Unknown;
     std::vector<InferenceEngine::Blob::Ptr> internalBlobs;
     std::vector<MKLDNNMemoryPtr> internalBlobMemory;
+    // allocator of the weights memory, the default mkldnn allocation is used if it is not set
+    MKLDNNAllocator::Ptr weightsAllocator;
+    // number of threads executing the node, 0 means all threads of the stream
+    int execThreads = 0;
     std::vector<PrimitiveDescInfo> supportedPrimitiveDescriptors;
     MKLDNNPrimitive prim;
     std::vector<MKLDNNDescriptor> descs;
@@ -0,0 +1,240 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <iostream>
+#include <mutex>
+#include "ie_parallel.hpp"
+#include "mkldnn_shared_streams.h"
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+namespace {
+// set by a worker thread of a pool, the pool released by a task of its own worker tells the thread to exit
+thread_local bool* isPoolOfThreadDestroyed = nullptr;
+}  // namespace
+
+constexpr uint64_t SharedStreamsPool::strideScale;
+
+std::string SharedStreamDecision::toString() const {
+    return "stream=" + std::to_string(stream) + "/" + std::to_string(streams) + " " + *placement +
+           " weight=" + std::to_string(weight) + " queued=" + std::to_string(queued) +
+           " dispatched=" + std::to_string(dispatched) + (affinity ? " affinity" : "");
+}
+
+SharedStreamsExecutor::SharedStreamsExecutor(const std::shared_ptr<SharedStreamsPool>& pool, const std::string& name,
+                                             int weight, const std::vector<std::shared_ptr<MKLDNNGraph>>& graphs,
+                                             bool debugLog)
+        : pool(pool), name(name), weight(std::max(weight, 1)),
+          stride(SharedStreamsPool::strideScale / static_cast<uint64_t>(std::max(weight, 1))), debugLog(debugLog) {
+    for (auto& graph : graphs)
+        freeGraphs.emplace_back(graph, -1);
+    pool->add(this);
+}
+
+SharedStreamsExecutor::~SharedStreamsExecutor() {
+    pool->remove(this);
+}
+
+bool SharedStreamsExecutor::startTask(Task::Ptr task) {
+    if (!task->occupy()) return false;
+    pool->push(this, task);
+    return true;
+}
+
+std::string SharedStreamsExecutor::toString() const {
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    std::string result = "streams=" + std::to_string(pool->getStreamsCount()) +
+                         " threads=" + std::to_string(pool->getThreadsPerStream()) +
+                         " weight=" + std::to_string(weight) + " graphs=" + std::to_string(freeGraphs.size());
+    for (size_t stream = 0; stream < pool->placementNames.size(); stream++)
+        result += " | stream=" + std::to_string(stream) + " " + pool->placementNames[stream];
+    return result;
+}
+
+SharedStreamsPool::Ptr SharedStreamsPool::get(int streams, int threadsPerStream, bool pinning) {
+    static std::mutex processPoolMutex;
+    static std::weak_ptr<SharedStreamsPool> processPool;
+    std::lock_guard<std::mutex> lock(processPoolMutex);
+    auto pool = processPool.lock();
+    if (!pool) {
+        pool = std::make_shared<SharedStreamsPool>(streams, threadsPerStream, pinning);
+        processPool = pool;
+    }
+    return pool;
+}
+
+SharedStreamsPool::SharedStreamsPool(int streams, int threadsPerStream, bool pinning)
+        : threadsPerStream(std::max(threadsPerStream, 1)), pinning(pinning) {
+    streams = std::max(streams, 1);
+    std::shared_ptr<CpuTopology> topology;
+    if (pinning) {
+        cpu_set_t *processMask = nullptr;
+        int ncpus = 0;
+        if (get_process_mask(ncpus, processMask)) {
+            topology = std::make_shared<CpuTopology>(get_processors_of_mask(ncpus, processMask));
+            placements = topology->placeStreams(streams, this->threadsPerStream);
+            CPU_FREE(processMask);
+        }
+    }
+    // the threads are pinned in the round-robin scheme if the topology is not known
+    placements.resize(streams);
+    for (auto& placement : placements) {
+        if (topology && !placement.processors.empty())
+            placementNames.push_back(topology->toString(placement));
+        else
+            placementNames.push_back(pinning ? "cpus=round-robin" : "cpus=any");
+    }
+
+    for (int stream = 0; stream < streams; stream++)
+        threads.emplace_back([this, stream] { work(stream); });
+}
+
+SharedStreamsPool::~SharedStreamsPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        isStopped = true;
+    }
+    condVar.notify_all();
+    for (auto& thread : threads) {
+        if (thread.get_id() == std::this_thread::get_id()) {
+            // the last network is released by the request run on this stream, the thread exits after the request
+            *isPoolOfThreadDestroyed = true;
+            thread.detach();
+        } else if (thread.joinable()) {
+            thread.join();
+        }
+    }
+}
+
+void SharedStreamsPool::add(SharedStreamsExecutor* executor) {
+    std::lock_guard<std::mutex> lock(mutex);
+    executor->pass = virtualTime;
+    executors.push_back(executor);
+}
+
+void SharedStreamsPool::remove(SharedStreamsExecutor* executor) {
+    std::unique_lock<std::mutex> lock(mutex);
+    doneCondVar.wait(lock, [executor] { return executor->running == 0 && executor->tasks.empty(); });
+    executors.erase(std::find(executors.begin(), executors.end(), executor));
+}
+
+void SharedStreamsPool::push(SharedStreamsExecutor* executor, Task::Ptr task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        // the network becoming busy does not get the share it has not used while it was idle
+        if (executor->tasks.empty() && executor->running == 0)
+            executor->pass = std::max(executor->pass, virtualTime);
+        executor->tasks.push_back(std::move(task));
+    }
+    condVar.notify_one();
+}
+
+SharedStreamsExecutor* SharedStreamsPool::pick(const SharedStreamsExecutor* last, bool& affinity) const {
+    SharedStreamsExecutor* best = nullptr;
+    SharedStreamsExecutor* previous = nullptr;
+    for (auto executor : executors) {
+        if (executor->tasks.empty() || executor->freeGraphs.empty())
+            continue;
+        if (executor == last)
+            previous = executor;
+        if (!best || executor->pass < best->pass)
+            best = executor;
+    }
+    // keeping to the previous network takes at most one more request of its share
+    affinity = previous && previous != best && previous->pass <= best->pass + previous->stride;
+    return affinity ? previous : best;
+}
+
+void SharedStreamsPool::work(int stream) {
+    bool isDestroyed = false;
+    isPoolOfThreadDestroyed = &isDestroyed;
+    auto& context = MultiWorkerTaskExecutor::ptrContext;
+#if IE_THREAD == IE_THREAD_TBB
+    tbb::task_arena arena(threadsPerStream);
+    std::unique_ptr<tbb::task_scheduler_observer> observer;
+    if (pinning) {
+        observer.reset(new pinning_observer(arena, stream, threadsPerStream, 1, placements[stream].processors));
+        observer->observe(true);
+    }
+    context.ptrArena = &arena;
+#else
+    parallel_set_num_threads(threadsPerStream);
+    if (pinning)
+        pin_stream_threads(stream, threadsPerStream, placements[stream].processors);
+#endif
+
+    SharedStreamDecision decision;
+    decision.stream = stream;
+    decision.streams = getStreamsCount();
+    decision.placement = &placementNames[stream];
+    const SharedStreamsExecutor* last = nullptr;
+    while (!isDestroyed) {
+        Task::Ptr task;
+        SharedStreamsExecutor* executor = nullptr;
+        std::shared_ptr<MKLDNNGraph> graph;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            bool affinity = false;
+            condVar.wait(lock, [&] { return isStopped || (executor = pick(last, affinity)) != nullptr; });
+            if (!executor)
+                break;
+            task = std::move(executor->tasks.front());
+            executor->tasks.pop_front();
+            // the graph which ran on the stream last has its data in the caches of the partition
+            auto& graphs = executor->freeGraphs;
+            auto found = std::find_if(graphs.begin(), graphs.end(),
+                                      [stream](const std::pair<std::shared_ptr<MKLDNNGraph>, int>& free) {
+                                          return free.second == stream;
+                                      });
+            if (found == graphs.end())
+                found = graphs.end() - 1;
+            graph = found->first;
+            graphs.erase(found);
+
+            executor->running++;
+            virtualTime = executor->pass;
+            executor->pass += executor->stride;
+            executor->dispatched++;
+
+            decision.network = &executor->name;
+            decision.weight = executor->weight;
+            decision.queued = executor->tasks.size();
+            decision.affinity = affinity;
+            decision.dispatched = executor->dispatched;
+        }
+        if (executor->debugLog) {
+            std::cout << "[ DEBUG ] CPU plugin: network " + *decision.network + ": shared " + decision.toString() + "\n"
+                      << std::flush;
+        }
+
+        context.ptrGraph = graph;
+        task->runNoThrowNoBusyCheck();
+        context.ptrGraph = nullptr;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            executor->freeGraphs.emplace_back(std::move(graph), stream);
+            executor->running--;
+        }
+        // the free graph may let another stream run the next request of the network
+        condVar.notify_one();
+        doneCondVar.notify_all();
+        last = executor;
+        // the task may hold the last reference to the network, which holds the last reference to the pool
+        task = nullptr;
+    }
+
+#if IE_THREAD == IE_THREAD_TBB
+    context.ptrArena = nullptr;
+#endif
+    isPoolOfThreadDestroyed = nullptr;
+}
+
+}  // namespace MKLDNNPlugin
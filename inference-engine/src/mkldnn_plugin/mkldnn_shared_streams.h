@@ -0,0 +1,154 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <condition_variable>
+#include <cpp_interfaces/ie_itask_executor.hpp>
+#include "mkldnn_streams.h"
+#include "mkldnn_topology.h"
+
+/* Shared streams let the executable networks of the process run on the same CPU streams instead of creating
+ * their own ones, so loading many networks does not oversubscribe the cores.
+ *  - The pool of the process owns the streams: the core partitions, one worker thread and one arena per partition.
+ *  - Every network gives its graphs (the copies of its intermediate data) to its SharedStreamsExecutor,
+ *    the number of graphs limits how many requests of the network run at once.
+ *  - A stream becoming idle takes the request of the network with the least progress relative to its weight
+ *    (stride scheduling), so the networks share the streams in proportion to their weights and any idle stream
+ *    runs the requests of any network.
+ *  - A stream keeps to the network and the graph it ran last while it does not exceed the share of the network,
+ *    so the weights and the intermediate data stay in the caches of the partition.
+ */
+namespace MKLDNNPlugin {
+
+class SharedStreamsPool;
+
+/* Scheduling decision of a shared stream, it is logged for the networks loaded with KEY_LOG_LEVEL set to LOG_DEBUG */
+struct SharedStreamDecision {
+    int stream = -1;
+    int streams = 0;
+    const std::string* placement = nullptr;
+    const std::string* network = nullptr;
+    int weight = 1;
+    // requests of the network left in its queue
+    size_t queued = 0;
+    // the stream kept to the network it ran last instead of the network with the least progress
+    bool affinity = false;
+    // requests of the network dispatched so far
+    uint64_t dispatched = 0;
+
+    std::string toString() const;
+};
+
+/* Executor of an executable network running its requests on the shared streams of the process. */
+class SharedStreamsExecutor : public InferenceEngine::ITaskExecutor {
+public:
+    typedef std::shared_ptr<SharedStreamsExecutor> Ptr;
+
+    /**
+     * @param debugLog - prints the decision of the stream before every request of the network is run
+     */
+    SharedStreamsExecutor(const std::shared_ptr<SharedStreamsPool>& pool, const std::string& name, int weight,
+                          const std::vector<std::shared_ptr<MKLDNNGraph>>& graphs, bool debugLog = false);
+
+    /**
+     * @brief Waits for the running requests of the network and leaves the pool
+     */
+    ~SharedStreamsExecutor();
+
+    /**
+     * @brief Queues the task, it is run by the first stream which is idle and picks the network
+     * @note a stream runs the task with a free graph of the network set to MultiWorkerTaskExecutor::ptrContext
+     */
+    bool startTask(InferenceEngine::Task::Ptr task) override;
+
+    /**
+     * @brief Returns the description of the streams and the share of the network, it is logged on load
+     * @note the number of the graphs counts only the free ones, so it is the number of all graphs before the requests start
+     */
+    std::string toString() const;
+
+private:
+    friend class SharedStreamsPool;
+
+    std::shared_ptr<SharedStreamsPool> pool;
+    const std::string name;
+    const int weight;
+    const uint64_t stride;
+    const bool debugLog;
+
+    // the fields below are guarded by the mutex of the pool
+    std::deque<InferenceEngine::Task::Ptr> tasks;
+    // free graphs and the streams which ran them last
+    std::vector<std::pair<std::shared_ptr<MKLDNNGraph>, int>> freeGraphs;
+    size_t running = 0;
+    // progress of the network, it grows by the stride with every dispatched request
+    uint64_t pass = 0;
+    uint64_t dispatched = 0;
+};
+
+/* CPU streams shared by the executable networks of the process. */
+class SharedStreamsPool {
+public:
+    typedef std::shared_ptr<SharedStreamsPool> Ptr;
+
+    /**
+     * @brief Returns the pool of the process. It is created by the first network using the shared streams,
+     * so the partitions are set by its streams and threads, and it is destroyed with the last network.
+     */
+    static Ptr get(int streams, int threadsPerStream, bool pinning);
+
+    /**
+     * @param streams - number of the streams (core partitions)
+     * @param threadsPerStream - number of threads of every stream
+     * @param pinning - pins the threads of every stream to the cores of its partition
+     */
+    SharedStreamsPool(int streams, int threadsPerStream, bool pinning);
+
+    ~SharedStreamsPool();
+
+    int getStreamsCount() const {
+        return static_cast<int>(placements.size());
+    }
+
+    int getThreadsPerStream() const {
+        return threadsPerStream;
+    }
+
+private:
+    friend class SharedStreamsExecutor;
+
+    static constexpr uint64_t strideScale = 1 << 20;
+
+    void add(SharedStreamsExecutor* executor);
+    void remove(SharedStreamsExecutor* executor);
+    void push(SharedStreamsExecutor* executor, InferenceEngine::Task::Ptr task);
+    SharedStreamsExecutor* pick(const SharedStreamsExecutor* last, bool& affinity) const;
+    void work(int stream);
+
+    const int threadsPerStream;
+    const bool pinning;
+    std::vector<StreamPlacement> placements;
+    // descriptions of the partitions reported on load and with the decisions
+    std::vector<std::string> placementNames;
+    std::vector<std::thread> threads;
+
+    std::mutex mutex;
+    std::condition_variable condVar;
+    // notified when a stream completes a request, the networks leaving the pool wait for their requests
+    std::condition_variable doneCondVar;
+    std::vector<SharedStreamsExecutor*> executors;
+    // the pass of the last dispatched network, a network becoming busy starts from it
+    uint64_t virtualTime = 0;
+    bool isStopped = false;
+};
+
+}  // namespace MKLDNNPlugin
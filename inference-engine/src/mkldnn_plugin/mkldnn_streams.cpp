@@ -9,10 +9,17 @@
 #include <chrono>
 #include <climits>
 #include <memory>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#if !(defined(__APPLE__) || defined(_WIN32))
+#include <dirent.h>
+#endif
 
 #include "mkldnn_graph.h"
 #include "ie_parallel.hpp"
 #include "mkldnn_streams.h"
+#include "mkldnn_memory_state.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -58,11 +65,8 @@ bool get_process_mask(int& ncpus, cpu_set_t*& mask) {
 bool pin_current_thread_by_mask(int ncores, const cpu_set_t* proc_mask) {
     return 0 == sched_setaffinity(0, ncores, proc_mask);
 }
-/* Pin thread to a spare core in the round-robin scheme, while respecting the given process mask.
- * The function can also handle the hyper-threading (by populating the physical cores first) */
-bool pin_thread_to_vacant_core(int thr_idx, int hyperthreads, int ncores, const cpu_set_t* proc_mask) {
-    if (proc_mask == nullptr)
-        return false;
+/* Find a spare core in the round-robin scheme, the same as pin_thread_to_vacant_core uses */
+static int get_vacant_core(int thr_idx, int hyperthreads, int ncores, const cpu_set_t* proc_mask) {
     const size_t size = CPU_ALLOC_SIZE(ncores);
     const int num_cpus = CPU_COUNT_S(size, proc_mask);
     thr_idx %= num_cpus;  // To limit unique number in [; num_cpus-1] range
@@ -81,6 +85,15 @@ bool pin_thread_to_vacant_core(int thr_idx, int hyperthreads, int ncores, const
         if (CPU_ISSET_S(++mapped_idx, size, proc_mask))
             --cpu_idx;
     }
+    return mapped_idx;
+}
+/* Pin thread to a spare core in the round-robin scheme, while respecting the given process mask.
+ * The function can also handle the hyper-threading (by populating the physical cores first) */
+bool pin_thread_to_vacant_core(int thr_idx, int hyperthreads, int ncores, const cpu_set_t* proc_mask) {
+    if (proc_mask == nullptr)
+        return false;
+    const size_t size = CPU_ALLOC_SIZE(ncores);
+    int mapped_idx = get_vacant_core(thr_idx, hyperthreads, ncores, proc_mask);
 
     cpu_set_t *target_mask = CPU_ALLOC(ncores);
     CPU_ZERO_S(size, target_mask);
@@ -89,6 +102,50 @@ bool pin_thread_to_vacant_core(int thr_idx, int hyperthreads, int ncores, const
     CPU_FREE(target_mask);
     return res;
 }
+/* Get NUMA node of the core that pin_thread_to_vacant_core selects for the thread, -1 if unknown */
+int get_numa_node_of_vacant_core(int thr_idx, int hyperthreads, int ncores, const cpu_set_t* proc_mask) {
+    if (proc_mask == nullptr)
+        return -1;
+    int mapped_idx = get_vacant_core(thr_idx, hyperthreads, ncores, proc_mask);
+    // the sysfs directory of a core contains a "node<N>" link to its NUMA node
+    std::string path = "/sys/devices/system/cpu/cpu" + std::to_string(mapped_idx);
+    DIR *dir = opendir(path.c_str());
+    if (!dir)
+        return -1;
+    int node = -1;
+    while (dirent *entry = readdir(dir)) {
+        if (std::strncmp(entry->d_name, "node", 4) == 0 && std::isdigit(entry->d_name[4])) {
+            node = std::atoi(entry->d_name + 4);
+            break;
+        }
+    }
+    closedir(dir);
+    return node;
+}
+/* Pin current thread to the given logical processor. */
+bool pin_current_thread_to_processor(int processor) {
+    if (processor < 0)
+        return false;
+    cpu_set_t *target_mask = CPU_ALLOC(processor + 1);
+    const size_t size = CPU_ALLOC_SIZE(processor + 1);
+    CPU_ZERO_S(size, target_mask);
+    CPU_SET_S(processor, size, target_mask);
+    bool res = pin_current_thread_by_mask(size, target_mask);
+    CPU_FREE(target_mask);
+    return res;
+}
+/* Get ids of the logical processors enabled in the mask */
+std::vector<int> get_processors_of_mask(int ncores, const cpu_set_t* proc_mask) {
+    std::vector<int> processors;
+    if (proc_mask == nullptr)
+        return processors;
+    const size_t size = CPU_ALLOC_SIZE(ncores);
+    for (int i = 0; i < ncores; i++) {
+        if (CPU_ISSET_S(i, size, proc_mask))
+            processors.push_back(i);
+    }
+    return processors;
+}
 #else   // no threads pinning/binding on Win/MacOS
 bool get_process_mask(int& ncpus, cpu_set_t*& mask) {
     ncpus = 0;
@@ -101,8 +158,38 @@ bool pin_thread_to_vacant_core(int thr_idx, int hyperthreads, int ncores, const
 bool pin_current_thread_by_mask(int ncores, const cpu_set_t* proc_mask) {
     return false;
 }
+int get_numa_node_of_vacant_core(int thr_idx, int hyperthreads, int ncores, const cpu_set_t* proc_mask) {
+    return -1;
+}
+bool pin_current_thread_to_processor(int processor) {
+    return false;
+}
+std::vector<int> get_processors_of_mask(int ncores, const cpu_set_t* proc_mask) {
+    return {};
+}
 #endif  // !(defined(__APPLE__) || defined(_WIN32))
 
+void pin_stream_threads(int stream_id, int threads_per_stream, const std::vector<int>& processors) {
+    cpu_set_t *process_mask = nullptr;
+    int ncpus = 0;
+    get_process_mask(ncpus, process_mask);
+    auto pin = [&](int thread_index) {
+        if (processors.empty())
+            pin_thread_to_vacant_core(stream_id * threads_per_stream + thread_index, 1, ncpus, process_mask);
+        else
+            pin_current_thread_to_processor(processors[thread_index % processors.size()]);
+    };
+#if IE_THREAD == IE_THREAD_OMP
+    #pragma omp parallel for
+    for (int thread_index = 0; thread_index < threads_per_stream; thread_index++) {
+        pin(thread_index);
+    }
+#else
+    pin(0);
+#endif
+    CPU_FREE(process_mask);
+}
+
 MultiWorkerTaskExecutor::MultiWorkerTaskExecutor(const std::vector<Task::Ptr>& init_tasks, std::string name) :
         _isStopped(false), _name(name), _initCount(0) {
     for (auto t : init_tasks) {
@@ -193,87 +280,52 @@ void MKLDNNPlugin::MKLDNNGraphlessInferRequest::InferImpl() {
             THROW_IE_EXCEPTION << "Invalid dynamic batch size " << m_curBatch <<
                                " for this request.";
 
+        auto start = MetricsCollector::Clock::now();
         // execute input pre-processing.
         execDataPreprocessing(_inputs);
+        if (graph->metrics && !_preProcData.empty())
+            graph->metrics->preprocessing.add(MetricsCollector::sinceUs(start));
 
-        // need to retain converted blobs until infer finish
-        std::vector<InferenceEngine::Blob::Ptr> convertedInputs;
         for (auto input : _inputs) {
             if (!_networkInputs[input.first]) {
                 THROW_IE_EXCEPTION <<
                                    "input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name "
                                    << input.first;
             }
-            InferenceEngine::Blob::Ptr iconv;
-            InferenceEngine::TBlob<float> *in_f = nullptr;
             switch (input.second->precision()) {
                 case InferenceEngine::Precision::FP32:
-                    graph->PushInputData(input.first, input.second);
-                    break;
                 case InferenceEngine::Precision::U16:
-                    // U16 is unsupported by mkldnn, so here we convert the blob and send FP32
-                    iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
-                            InferenceEngine::Precision::FP32,
-                            input.second->getTensorDesc().getLayout(), input.second->dims());
-                    convertedInputs.push_back(iconv);
-                    iconv->allocate();
-                    in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                    if (in_f == nullptr)
-                        THROW_IE_EXCEPTION << "Cannot get TBlob";
-                    InferenceEngine::copyToFloat<uint16_t>(in_f->data(), input.second.get());
-                    graph->PushInputData(input.first, iconv);
-                    break;
                 case InferenceEngine::Precision::I16:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
-                                InferenceEngine::Precision::FP32,
-                                input.second->getTensorDesc().getLayout(), input.second->dims());
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        if (in_f == nullptr)
-                            THROW_IE_EXCEPTION << "Cannot get TBlob";
-                        InferenceEngine::copyToFloat<int16_t>(in_f->data(), input.second.get());
-                        graph->PushInputData(input.first, iconv);
-                    } else {
-                        // Instead we can send I16 directly
-                        graph->PushInputData(input.first, input.second);
-                    }
-                    break;
                 case InferenceEngine::Precision::U8:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
-                                InferenceEngine::Precision::FP32,
-                                input.second->getTensorDesc().getLayout(), input.second->dims());
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        if (in_f == nullptr)
-                            THROW_IE_EXCEPTION << "Cannot get TBlob";
-                        InferenceEngine::copyToFloat<uint8_t>(in_f->data(), input.second.get());
-                        graph->PushInputData(input.first, iconv);
-                    } else {
-                        // Instead we can send I8 directly
-                        graph->PushInputData(input.first, input.second);
-                    }
+                    // integer inputs are converted to FP32 by the graph on the way to the input memory if needed
+                    graph->PushInputData(input.first, input.second);
                     break;
                 default:
                     THROW_IE_EXCEPTION << "Unsupported input precision " << input.second->precision();
             }
         }
+        std::unique_ptr<MKLDNNStatePool::Binding> states;
+        if (!sequenceIds.empty())
+            states.reset(new MKLDNNStatePool::Binding(*statePool, *graph, sequenceIds, m_curBatch));
         graph->Infer(m_curBatch);
         graph->PullOutputData(_outputs);
+        if (graph->metrics)
+            graph->metrics->addStreamBusy(graph->metricsStream, MetricsCollector::sinceUs(start));
         if (graph->getProperty().collectPerfCounters) {
             m_perfMap.clear();
             graph->GetPerfData(m_perfMap);
         }
     };
 #if IE_THREAD == IE_THREAD_TBB
-    auto_scope_observing observer(MKLDNNPlugin::MultiWorkerTaskExecutor::ptrContext.ptrGraph->ptrObserver);
+    auto& context = MKLDNNPlugin::MultiWorkerTaskExecutor::ptrContext;
+    if (context.ptrArena) {
+        // the shared stream pins the threads of its arena itself
+        context.ptrArena->execute([&] { infer(); });
+        return;
+    }
+    auto_scope_observing observer(context.ptrGraph->ptrObserver);
     // a TBB arena is made "this" for Infer call via executing lambda for the arena
-    MKLDNNPlugin::MultiWorkerTaskExecutor::ptrContext.ptrGraph->ptrArena->execute([&] { infer(); });
+    context.ptrGraph->ptrArena->execute([&] { infer(); });
 #else
     infer();
 #endif
@@ -378,4 +430,14 @@ void MKLDNNPlugin::MKLDNNGraphlessInferRequest::SetBatch(int new_batch) {
     m_curBatch = new_batch;
 }
 
+void MKLDNNPlugin::MKLDNNGraphlessInferRequest::SetSequences(const std::vector<size_t> &sequenceIds) {
+    if (!statePool || statePool->empty())
+        THROW_IE_EXCEPTION << "Network has no memory states.";
+    this->sequenceIds = sequenceIds;
+}
+
+void MKLDNNPlugin::MKLDNNGraphlessInferRequest::SetStatePool(const std::shared_ptr<MKLDNNStatePool> &pool) {
+    statePool = pool;
+}
+
 }  // namespace MKLDNNPlugin
@@ -37,12 +37,17 @@ namespace MKLDNNPlugin {
 
 using namespace InferenceEngine;
 class MKLDNNGraph;
+class MKLDNNStatePool;
 class pinning_observer;
 
 /* This structure handles an "execution context" - data required to execute an Infer Request.
  * This includes graph (which handles the intermediate data) and arena/observer for the TBB */
 struct MultiWorkerTaskContext {
     std::shared_ptr<MKLDNNGraph> ptrGraph;
+#if IE_THREAD == IE_THREAD_TBB
+    // arena of the shared stream running the graph, the arena of the graph is used if it is null
+    tbb::task_arena* ptrArena = nullptr;
+#endif
 };
 
 #if defined(__APPLE__) || defined(_WIN32)
@@ -59,6 +64,15 @@ bool pin_current_thread_by_mask(int ncores, const cpu_set_t* proc_mask);
 /* Pin thread to a spare core in the round-robin scheme, while respecting the given process mask.
  * The function can also handle the hyper-threading (by populating the physical cores first) */
 bool pin_thread_to_vacant_core(int thr_idx, int hyperthreads, int ncores, const cpu_set_t* proc_mask);
+/* Get NUMA node of the core that pin_thread_to_vacant_core selects for the thread, -1 if unknown */
+int get_numa_node_of_vacant_core(int thr_idx, int hyperthreads, int ncores, const cpu_set_t* proc_mask);
+/* Pin current thread to the given logical processor. */
+bool pin_current_thread_to_processor(int processor);
+/* Get ids of the logical processors enabled in the mask */
+std::vector<int> get_processors_of_mask(int ncores, const cpu_set_t* proc_mask);
+/* Pin the OpenMP threads (or the current thread) of a stream to the given processors if they are specified,
+ * otherwise to the vacant cores in the round-robin scheme. The TBB threads are pinned by pinning_observer. */
+void pin_stream_threads(int stream_id, int threads_per_stream, const std::vector<int>& processors);
 
 #if IE_THREAD == IE_THREAD_TBB
 /* Simple observer that handles pinning threads to the cores, it serves as a callback for threads entering the arena. */
@@ -67,24 +81,34 @@ class pinning_observer: public tbb::task_scheduler_observer {
     int ncpus;
     int stream_id, threads_per_stream;
     const int pinning_step;
+    // processors of the stream threads, the round-robin scheme is used if empty
+    const std::vector<int> processors;
+    // the arena is entered from the (already pinned) arena of the stream, only the workers joining it are pinned
+    const bool nested;
 
 public:
-    pinning_observer(tbb::task_arena& _arena, int _stream_id, int _threads_per_stream, int _pinning_step = 1) :
+    pinning_observer(tbb::task_arena& _arena, int _stream_id, int _threads_per_stream, int _pinning_step = 1,
+                     const std::vector<int>& _processors = {}, bool _nested = false) :
             tbb::task_scheduler_observer(_arena),
-            stream_id(_stream_id), threads_per_stream(_threads_per_stream), pinning_step(_pinning_step) {
+            stream_id(_stream_id), threads_per_stream(_threads_per_stream), pinning_step(_pinning_step),
+            processors(_processors), nested(_nested) {
         get_process_mask(ncpus, mask);
     }
 
-    void on_scheduler_entry(bool) override {
-        if (!mask) return;
+    void on_scheduler_entry(bool is_worker) override {
+        if (!mask || (nested && !is_worker)) return;
         int thread_idx = tbb::task_arena::current_thread_index();
+        if (!processors.empty()) {
+            pin_current_thread_to_processor(processors[thread_idx % processors.size()]);
+            return;
+        }
         int thr_idx = stream_id * threads_per_stream + thread_idx;
         // pin thread to the vacant slot
         pin_thread_to_vacant_core(thr_idx, pinning_step, ncpus, mask);
     }
 
-    void on_scheduler_exit(bool) override {
-        if (!mask) return;
+    void on_scheduler_exit(bool is_worker) override {
+        if (!mask || (nested && !is_worker)) return;
         // reset the thread's mask (to the original process mask)
         pin_current_thread_by_mask(ncpus, mask);
     }
@@ -168,8 +192,14 @@ public:
 
     void SetBatch(int batch = -1) override;
 
+    void SetSequences(const std::vector<size_t> &sequenceIds) override;
+
+    void SetStatePool(const std::shared_ptr<MKLDNNStatePool>& pool);
+
 private:
     int m_curBatch;
+    std::shared_ptr<MKLDNNStatePool> statePool;
+    std::vector<size_t> sequenceIds;
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> m_perfMap;
 };
 
@@ -0,0 +1,206 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_topology.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+bool readLine(const std::string& path, std::string& line) {
+    std::ifstream file(path);
+    return file && std::getline(file, line);
+}
+
+int readInt(const std::string& path, int defaultValue) {
+    std::string line;
+    if (!readLine(path, line) || line.empty())
+        return defaultValue;
+    return std::atoi(line.c_str());
+}
+
+// sysfs reports sizes like "32K" or "36608K"
+size_t parseSize(const std::string& str) {
+    size_t size = std::strtoull(str.c_str(), nullptr, 10);
+    if (str.find('K') != std::string::npos) size <<= 10;
+    if (str.find('M') != std::string::npos) size <<= 20;
+    return size;
+}
+
+}  // namespace
+
+std::vector<int> MKLDNNPlugin::parse_processors_list(const std::string& list) {
+    std::vector<int> result;
+    std::stringstream stream(list);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        if (range.empty() || !std::isdigit(range[0]))
+            continue;
+        auto dash = range.find('-');
+        int first = std::atoi(range.c_str());
+        int last = dash == std::string::npos ? first : std::atoi(range.c_str() + dash + 1);
+        for (int id = first; id <= last; id++)
+            result.push_back(id);
+    }
+    return result;
+}
+
+std::string MKLDNNPlugin::format_processors_list(std::vector<int> processors) {
+    std::sort(processors.begin(), processors.end());
+    processors.erase(std::unique(processors.begin(), processors.end()), processors.end());
+    std::stringstream result;
+    for (size_t i = 0; i < processors.size();) {
+        size_t j = i;
+        while (j + 1 < processors.size() && processors[j + 1] == processors[j] + 1)
+            j++;
+        result << (i ? "," : "") << processors[i];
+        if (j > i)
+            result << "-" << processors[j];
+        i = j + 1;
+    }
+    return result.str();
+}
+
+CpuTopology::CpuTopology(const std::vector<int>& ids, const std::string& sysfsRoot) {
+    std::map<int, int> nodeOfProcessor;
+    std::string online;
+    if (readLine(sysfsRoot + "/node/online", online)) {
+        for (int node : parse_processors_list(online)) {
+            std::string cpus;
+            if (!readLine(sysfsRoot + "/node/node" + std::to_string(node) + "/cpulist", cpus))
+                continue;
+            for (int id : parse_processors_list(cpus))
+                nodeOfProcessor[id] = node;
+        }
+    }
+
+    for (int id : ids) {
+        const std::string cpuPath = sysfsRoot + "/cpu/cpu" + std::to_string(id);
+        Processor processor;
+        processor.id = id;
+        processor.socket = readInt(cpuPath + "/topology/physical_package_id", 0);
+        processor.core = readInt(cpuPath + "/topology/core_id", id);
+        processor.node = nodeOfProcessor.count(id) ? nodeOfProcessor[id] : -1;
+        processor.thread = 0;
+        std::string siblings;
+        if (readLine(cpuPath + "/topology/thread_siblings_list", siblings)) {
+            auto list = parse_processors_list(siblings);
+            auto position = std::find(list.begin(), list.end(), id);
+            if (position != list.end())
+                processor.thread = static_cast<int>(position - list.begin());
+        }
+        processors.push_back(processor);
+
+        for (int index = 0;; index++) {
+            const std::string cachePath = cpuPath + "/cache/index" + std::to_string(index);
+            std::string type, size, shared;
+            int level = readInt(cachePath + "/level", -1);
+            if (level < 0)
+                break;
+            if (!readLine(cachePath + "/type", type) || type == "Instruction")
+                continue;
+            if (!readLine(cachePath + "/size", size) || !readLine(cachePath + "/shared_cpu_list", shared))
+                continue;
+            Cache cache {level, parseSize(size), parse_processors_list(shared)};
+            bool known = std::any_of(caches.begin(), caches.end(), [&](const Cache& c) {
+                return c.level == cache.level && c.processors == cache.processors;
+            });
+            if (!known)
+                caches.push_back(cache);
+        }
+    }
+}
+
+int CpuTopology::getSocketsCount() const {
+    std::set<int> sockets;
+    for (auto& processor : processors)
+        sockets.insert(processor.socket);
+    return static_cast<int>(sockets.size());
+}
+
+int CpuTopology::getCoresCount() const {
+    std::set<std::pair<int, int>> cores;
+    for (auto& processor : processors)
+        cores.insert({processor.socket, processor.core});
+    return static_cast<int>(cores.size());
+}
+
+int CpuTopology::getNodesCount() const {
+    std::set<int> nodes;
+    for (auto& processor : processors)
+        nodes.insert(processor.node);
+    return static_cast<int>(nodes.size());
+}
+
+size_t CpuTopology::getCacheSize(int processor, int level) const {
+    for (auto& cache : caches) {
+        if (cache.level == level &&
+                std::find(cache.processors.begin(), cache.processors.end(), processor) != cache.processors.end())
+            return cache.size;
+    }
+    return 0;
+}
+
+std::vector<StreamPlacement> CpuTopology::placeStreams(int streams, int threadsPerStream) const {
+    std::vector<StreamPlacement> placements;
+    if (empty() || streams < 1 || threadsPerStream < 1)
+        return placements;
+
+    std::map<int, std::vector<Processor>> nodes;
+    for (auto& processor : processors)
+        nodes[processor.node].push_back(processor);
+    for (auto& node : nodes) {
+        // the first threads of all the cores go before their siblings
+        std::sort(node.second.begin(), node.second.end(), [](const Processor& a, const Processor& b) {
+            return std::make_tuple(a.thread, a.socket, a.core, a.id) < std::make_tuple(b.thread, b.socket, b.core, b.id);
+        });
+    }
+
+    // every next stream goes to the node with most processors per stream
+    std::map<int, int> nodeStreams;
+    for (int stream = 0; stream < streams; stream++) {
+        auto best = nodes.begin();
+        for (auto node = nodes.begin(); node != nodes.end(); node++) {
+            if (node->second.size() * (nodeStreams[best->first] + 1) > best->second.size() * (nodeStreams[node->first] + 1))
+                best = node;
+        }
+        nodeStreams[best->first]++;
+    }
+
+    for (auto& node : nodes) {
+        const auto& nodeProcessors = node.second;
+        for (int stream = 0; stream < nodeStreams[node.first]; stream++) {
+            StreamPlacement placement;
+            placement.node = node.first;
+            for (int thread = 0; thread < threadsPerStream; thread++)
+                placement.processors.push_back(nodeProcessors[(stream * threadsPerStream + thread) % nodeProcessors.size()].id);
+            placements.push_back(placement);
+        }
+    }
+    return placements;
+}
+
+std::string CpuTopology::toString(const StreamPlacement& placement) const {
+    std::stringstream result;
+    result << "node=" << placement.node << " cpus=" << format_processors_list(placement.processors);
+    if (!placement.processors.empty()) {
+        for (int level : {2, 3}) {
+            size_t size = getCacheSize(placement.processors[0], level);
+            if (size)
+                result << " l" << level << "=" << (size >> 10) << "K";
+        }
+    }
+    return result.str();
+}
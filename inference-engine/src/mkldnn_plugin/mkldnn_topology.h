@@ -0,0 +1,96 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Placement of a CPU stream: its NUMA node and the logical processors of its threads
+ */
+struct StreamPlacement {
+    int node = -1;
+    // the processor of the i-th thread of the stream is processors[i % processors.size()]
+    std::vector<int> processors;
+};
+
+/**
+ * @brief Topology of the logical processors available to the process, it is read from sysfs on Linux
+ */
+class CpuTopology {
+public:
+    struct Processor {
+        int id;
+        int socket;
+        int core;    // core id, unique within the socket only
+        int node;    // NUMA node, -1 if unknown
+        int thread;  // index of the processor among the SMT siblings of its core
+    };
+
+    struct Cache {
+        int level;
+        size_t size;  // in bytes
+        std::vector<int> processors;  // processors sharing the cache
+    };
+
+    /**
+     * @brief Reads the topology of the given processors
+     * @param processors - ids of the logical processors, e.g. from the affinity mask of the process
+     * @param sysfsRoot - root of the system devices, it is changed by tests only
+     */
+    explicit CpuTopology(const std::vector<int>& processors, const std::string& sysfsRoot = "/sys/devices/system");
+
+    bool empty() const {
+        return processors.empty();
+    }
+
+    const std::vector<Processor>& getProcessors() const {
+        return processors;
+    }
+
+    const std::vector<Cache>& getCaches() const {
+        return caches;
+    }
+
+    int getSocketsCount() const;
+    int getCoresCount() const;
+    int getNodesCount() const;
+
+    /**
+     * @brief Returns size of the data or unified cache of the level used by the processor, 0 if unknown
+     */
+    size_t getCacheSize(int processor, int level) const;
+
+    /**
+     * @brief Distributes the streams over the NUMA nodes proportionally to the number of processors of the nodes.
+     * Each stream takes processors of a single node, the physical cores are populated before their SMT siblings.
+     * If the node has fewer processors than the threads of its streams, the threads share the processors.
+     */
+    std::vector<StreamPlacement> placeStreams(int streams, int threadsPerStream) const;
+
+    /**
+     * @brief Returns human-readable description of the placement, e.g. "node=0 cpus=0-3 l2=1024K l3=39424K"
+     */
+    std::string toString(const StreamPlacement& placement) const;
+
+private:
+    std::vector<Processor> processors;
+    std::vector<Cache> caches;
+};
+
+/**
+ * @brief Parses the list of processors in the sysfs format, e.g. "0-3,8,10-11"
+ */
+std::vector<int> parse_processors_list(const std::string& list);
+
+/**
+ * @brief Formats the list of processors in the sysfs format
+ */
+std::string format_processors_list(std::vector<int> processors);
+
+}  // namespace MKLDNNPlugin
@@ -171,6 +171,10 @@ void MKLDNNEltwiseNode::createPrimitive() {
             prim = nullptr;
         }
     }
+    if (!prim) {
+        initReferenceImpl();
+        prepareBroadcast();
+    }
 }
 
 void MKLDNNEltwiseNode::initOptimalPrimitiveDescriptor() {
@@ -250,17 +254,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_add(
 #endif
         }
     } else {
-        int dims_out[5], dims_in0[5], dims_in1[5];
-        int offset_out[5], offset_in0[5], offset_in1[5];
-        auto& child_edge_dims = getChildEdgeAt(0)->getDims();
-        auto& parent0_edge_dims = getParentEdgeAt(0)->getDims();
-        auto& parent1_edge_dims = getParentEdgeAt(1)->getDims();
-        dims_calc(dims_out, child_edge_dims);
-        dims_calc(dims_in0, parent0_edge_dims);
-        dims_calc(dims_in1, parent1_edge_dims);
-        offset_out_calc(offset_out, dims_out);
-        offset_in_calc(offset_in0, dims_in0, dims_out);
-        offset_in_calc(offset_in1, dims_in1, dims_out);
+        const int *offset_in0 = offsets_in[0].data();
+        const int *offset_in1 = offsets_in[1].data();
 
 #ifdef _WIN32
         for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -289,9 +284,7 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_add(
             const T1 *src_ptr = reinterpret_cast<const T1 *>(getParentEdgeAt(n)->getMemory().GetData()) +
                                 getParentEdgeAt(n)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-            auto& parent_edge_dims = getParentEdgeAt(n)->getDims();
-            dims_calc(dims_in1, parent_edge_dims);
-            offset_in_calc(offset_in1, dims_in1, dims_out);
+            offset_in1 = offsets_in[n].data();
 
 #ifdef _WIN32
             for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -344,17 +337,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_prod(
 #endif
         }
     } else {
-        int dims_out[5], dims_in0[5], dims_in1[5];
-        int offset_out[5], offset_in0[5], offset_in1[5];
-        auto& child_edge_dims = getChildEdgeAt(0)->getDims();
-        auto& parent0_edge_dims = getParentEdgeAt(0)->getDims();
-        auto& parent1_edge_dims = getParentEdgeAt(1)->getDims();
-        dims_calc(dims_out, child_edge_dims);
-        dims_calc(dims_in0, parent0_edge_dims);
-        dims_calc(dims_in1, parent1_edge_dims);
-        offset_out_calc(offset_out, dims_out);
-        offset_in_calc(offset_in0, dims_in0, dims_out);
-        offset_in_calc(offset_in1, dims_in1, dims_out);
+        const int *offset_in0 = offsets_in[0].data();
+        const int *offset_in1 = offsets_in[1].data();
 
 #ifdef _WIN32
         for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -383,9 +367,7 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_prod(
             const T1 *src_ptr = reinterpret_cast<const T1 *>(getParentEdgeAt(n)->getMemory().GetData()) +
                                 getParentEdgeAt(n)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-            auto& parent_edge_dims = getParentEdgeAt(n)->getDims();
-            dims_calc(dims_in1, parent_edge_dims);
-            offset_in_calc(offset_in1, dims_in1, dims_out);
+            offset_in1 = offsets_in[n].data();
 
 #ifdef _WIN32
             for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -438,17 +420,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_max(
 #endif
         }
     } else {
-        int dims_out[5], dims_in0[5], dims_in1[5];
-        int offset_out[5], offset_in0[5], offset_in1[5];
-        auto& child_edge_dims = getChildEdgeAt(0)->getDims();
-        auto& parent0_edge_dims = getParentEdgeAt(0)->getDims();
-        auto& parent1_edge_dims = getParentEdgeAt(1)->getDims();
-        dims_calc(dims_out, child_edge_dims);
-        dims_calc(dims_in0, parent0_edge_dims);
-        dims_calc(dims_in1, parent1_edge_dims);
-        offset_out_calc(offset_out, dims_out);
-        offset_in_calc(offset_in0, dims_in0, dims_out);
-        offset_in_calc(offset_in1, dims_in1, dims_out);
+        const int *offset_in0 = offsets_in[0].data();
+        const int *offset_in1 = offsets_in[1].data();
 
 #ifdef _WIN32
         for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -477,9 +450,7 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_max(
             const T1 *src_ptr = reinterpret_cast<const T1 *>(getParentEdgeAt(n)->getMemory().GetData()) +
                                 getParentEdgeAt(n)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-            auto& parent_edge_dims = getParentEdgeAt(n)->getDims();
-            dims_calc(dims_in1, parent_edge_dims);
-            offset_in_calc(offset_in1, dims_in1, dims_out);
+            offset_in1 = offsets_in[n].data();
 
 #ifdef _WIN32
             for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -532,17 +503,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_sub(
 #endif
         }
     } else {
-        int dims_out[5], dims_in0[5], dims_in1[5];
-        int offset_out[5], offset_in0[5], offset_in1[5];
-        auto& child_edge_dims = getChildEdgeAt(0)->getDims();
-        auto& parent0_edge_dims = getParentEdgeAt(0)->getDims();
-        auto& parent1_edge_dims = getParentEdgeAt(1)->getDims();
-        dims_calc(dims_out, child_edge_dims);
-        dims_calc(dims_in0, parent0_edge_dims);
-        dims_calc(dims_in1, parent1_edge_dims);
-        offset_out_calc(offset_out, dims_out);
-        offset_in_calc(offset_in0, dims_in0, dims_out);
-        offset_in_calc(offset_in1, dims_in1, dims_out);
+        const int *offset_in0 = offsets_in[0].data();
+        const int *offset_in1 = offsets_in[1].data();
 
 #ifdef _WIN32
         for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -571,9 +533,7 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_sub(
             const T1 *src_ptr = reinterpret_cast<const T1 *>(getParentEdgeAt(n)->getMemory().GetData()) +
                                 getParentEdgeAt(n)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-            auto& parent_edge_dims = getParentEdgeAt(n)->getDims();
-            dims_calc(dims_in1, parent_edge_dims);
-            offset_in_calc(offset_in1, dims_in1, dims_out);
+            offset_in1 = offsets_in[n].data();
 
 #ifdef _WIN32
             for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -626,17 +586,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_min(
 #endif
         }
     } else {
-        int dims_out[5], dims_in0[5], dims_in1[5];
-        int offset_out[5], offset_in0[5], offset_in1[5];
-        auto& child_edge_dims = getChildEdgeAt(0)->getDims();
-        auto& parent0_edge_dims = getParentEdgeAt(0)->getDims();
-        auto& parent1_edge_dims = getParentEdgeAt(1)->getDims();
-        dims_calc(dims_out, child_edge_dims);
-        dims_calc(dims_in0, parent0_edge_dims);
-        dims_calc(dims_in1, parent1_edge_dims);
-        offset_out_calc(offset_out, dims_out);
-        offset_in_calc(offset_in0, dims_in0, dims_out);
-        offset_in_calc(offset_in1, dims_in1, dims_out);
+        const int *offset_in0 = offsets_in[0].data();
+        const int *offset_in1 = offsets_in[1].data();
 
 #ifdef _WIN32
         for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -665,9 +616,7 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_min(
             const T1 *src_ptr = reinterpret_cast<const T1 *>(getParentEdgeAt(n)->getMemory().GetData()) +
                                 getParentEdgeAt(n)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-            auto& parent_edge_dims = getParentEdgeAt(n)->getDims();
-            dims_calc(dims_in1, parent_edge_dims);
-            offset_in_calc(offset_in1, dims_in1, dims_out);
+            offset_in1 = offsets_in[n].data();
 
 #ifdef _WIN32
             for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -720,17 +669,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_div(
 #endif
         }
     } else {
-        int dims_out[5], dims_in0[5], dims_in1[5];
-        int offset_out[5], offset_in0[5], offset_in1[5];
-        auto& child_edge_dims = getChildEdgeAt(0)->getDims();
-        auto& parent0_edge_dims = getParentEdgeAt(0)->getDims();
-        auto& parent1_edge_dims = getParentEdgeAt(1)->getDims();
-        dims_calc(dims_out, child_edge_dims);
-        dims_calc(dims_in0, parent0_edge_dims);
-        dims_calc(dims_in1, parent1_edge_dims);
-        offset_out_calc(offset_out, dims_out);
-        offset_in_calc(offset_in0, dims_in0, dims_out);
-        offset_in_calc(offset_in1, dims_in1, dims_out);
+        const int *offset_in0 = offsets_in[0].data();
+        const int *offset_in1 = offsets_in[1].data();
 
 #ifdef _WIN32
         for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -759,9 +699,7 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_div(
             const T1 *src_ptr = reinterpret_cast<const T1 *>(getParentEdgeAt(n)->getMemory().GetData()) +
                                 getParentEdgeAt(n)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-            auto& parent_edge_dims = getParentEdgeAt(n)->getDims();
-            dims_calc(dims_in1, parent_edge_dims);
-            offset_in_calc(offset_in1, dims_in1, dims_out);
+            offset_in1 = offsets_in[n].data();
 
 #ifdef _WIN32
             for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -814,17 +752,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_squared_diff
 #endif
         }
     } else {
-        int dims_out[5], dims_in0[5], dims_in1[5];
-        int offset_out[5], offset_in0[5], offset_in1[5];
-        auto& child_edge_dims = getChildEdgeAt(0)->getDims();
-        auto& parent0_edge_dims = getParentEdgeAt(0)->getDims();
-        auto& parent1_edge_dims = getParentEdgeAt(1)->getDims();
-        dims_calc(dims_out, child_edge_dims);
-        dims_calc(dims_in0, parent0_edge_dims);
-        dims_calc(dims_in1, parent1_edge_dims);
-        offset_out_calc(offset_out, dims_out);
-        offset_in_calc(offset_in0, dims_in0, dims_out);
-        offset_in_calc(offset_in1, dims_in1, dims_out);
+        const int *offset_in0 = offsets_in[0].data();
+        const int *offset_in1 = offsets_in[1].data();
 
 #ifdef _WIN32
         for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -853,9 +782,7 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_squared_diff
             const T1 *src_ptr = reinterpret_cast<const T1 *>(getParentEdgeAt(n)->getMemory().GetData()) +
                                 getParentEdgeAt(n)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-            auto& parent_edge_dims = getParentEdgeAt(n)->getDims();
-            dims_calc(dims_in1, parent_edge_dims);
-            offset_in_calc(offset_in1, dims_in1, dims_out);
+            offset_in1 = offsets_in[n].data();
 
 #ifdef _WIN32
             for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -908,17 +835,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_floor_mod(
 #endif
         }
     } else {
-        int dims_out[5], dims_in0[5], dims_in1[5];
-        int offset_out[5], offset_in0[5], offset_in1[5];
-        auto& child_edge_dims = getChildEdgeAt(0)->getDims();
-        auto& parent0_edge_dims = getParentEdgeAt(0)->getDims();
-        auto& parent1_edge_dims = getParentEdgeAt(1)->getDims();
-        dims_calc(dims_out, child_edge_dims);
-        dims_calc(dims_in0, parent0_edge_dims);
-        dims_calc(dims_in1, parent1_edge_dims);
-        offset_out_calc(offset_out, dims_out);
-        offset_in_calc(offset_in0, dims_in0, dims_out);
-        offset_in_calc(offset_in1, dims_in1, dims_out);
+        const int *offset_in0 = offsets_in[0].data();
+        const int *offset_in1 = offsets_in[1].data();
 
 #ifdef _WIN32
         for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -947,9 +865,7 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_floor_mod(
             const T1 *src_ptr = reinterpret_cast<const T1 *>(getParentEdgeAt(n)->getMemory().GetData()) +
                                 getParentEdgeAt(n)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-            auto& parent_edge_dims = getParentEdgeAt(n)->getDims();
-            dims_calc(dims_in1, parent_edge_dims);
-            offset_in_calc(offset_in1, dims_in1, dims_out);
+            offset_in1 = offsets_in[n].data();
 
 #ifdef _WIN32
             for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -1002,17 +918,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_pow(
 #endif
         }
     } else {
-        int dims_out[5], dims_in0[5], dims_in1[5];
-        int offset_out[5], offset_in0[5], offset_in1[5];
-        auto& child_edge_dims = getChildEdgeAt(0)->getDims();
-        auto& parent0_edge_dims = getParentEdgeAt(0)->getDims();
-        auto& parent1_edge_dims = getParentEdgeAt(1)->getDims();
-        dims_calc(dims_out, child_edge_dims);
-        dims_calc(dims_in0, parent0_edge_dims);
-        dims_calc(dims_in1, parent1_edge_dims);
-        offset_out_calc(offset_out, dims_out);
-        offset_in_calc(offset_in0, dims_in0, dims_out);
-        offset_in_calc(offset_in1, dims_in1, dims_out);
+        const int *offset_in0 = offsets_in[0].data();
+        const int *offset_in1 = offsets_in[1].data();
 
 #ifdef _WIN32
         for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -1041,9 +948,7 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_pow(
             const T1 *src_ptr = reinterpret_cast<const T1 *>(getParentEdgeAt(n)->getMemory().GetData()) +
                                 getParentEdgeAt(n)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-            auto& parent_edge_dims = getParentEdgeAt(n)->getDims();
-            dims_calc(dims_in1, parent_edge_dims);
-            offset_in_calc(offset_in1, dims_in1, dims_out);
+            offset_in1 = offsets_in[n].data();
 
 #ifdef _WIN32
             for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -1096,17 +1001,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_equal(
 #endif
         }
     } else {
-        int dims_out[5], dims_in0[5], dims_in1[5];
-        int offset_out[5], offset_in0[5], offset_in1[5];
-        auto& child_edge_dims = getChildEdgeAt(0)->getDims();
-        auto& parent0_edge_dims = getParentEdgeAt(0)->getDims();
-        auto& parent1_edge_dims = getParentEdgeAt(1)->getDims();
-        dims_calc(dims_out, child_edge_dims);
-        dims_calc(dims_in0, parent0_edge_dims);
-        dims_calc(dims_in1, parent1_edge_dims);
-        offset_out_calc(offset_out, dims_out);
-        offset_in_calc(offset_in0, dims_in0, dims_out);
-        offset_in_calc(offset_in1, dims_in1, dims_out);
+        const int *offset_in0 = offsets_in[0].data();
+        const int *offset_in1 = offsets_in[1].data();
 
 #ifdef _WIN32
         for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -1135,9 +1031,7 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_equal(
             const T1 *src_ptr = reinterpret_cast<const T1 *>(getParentEdgeAt(n)->getMemory().GetData()) +
                                 getParentEdgeAt(n)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-            auto& parent_edge_dims = getParentEdgeAt(n)->getDims();
-            dims_calc(dims_in1, parent_edge_dims);
-            offset_in_calc(offset_in1, dims_in1, dims_out);
+            offset_in1 = offsets_in[n].data();
 
 #ifdef _WIN32
             for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -1190,17 +1084,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_not_equal(
 #endif
         }
     } else {
-        int dims_out[5], dims_in0[5], dims_in1[5];
-        int offset_out[5], offset_in0[5], offset_in1[5];
-        auto& child_edge_dims = getChildEdgeAt(0)->getDims();
-        auto& parent0_edge_dims = getParentEdgeAt(0)->getDims();
-        auto& parent1_edge_dims = getParentEdgeAt(1)->getDims();
-        dims_calc(dims_out, child_edge_dims);
-        dims_calc(dims_in0, parent0_edge_dims);
-        dims_calc(dims_in1, parent1_edge_dims);
-        offset_out_calc(offset_out, dims_out);
-        offset_in_calc(offset_in0, dims_in0, dims_out);
-        offset_in_calc(offset_in1, dims_in1, dims_out);
+        const int *offset_in0 = offsets_in[0].data();
+        const int *offset_in1 = offsets_in[1].data();
 
 #ifdef _WIN32
         for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -1229,9 +1114,7 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_not_equal(
             const T1 *src_ptr = reinterpret_cast<const T1 *>(getParentEdgeAt(n)->getMemory().GetData()) +
                                 getParentEdgeAt(n)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-            auto& parent_edge_dims = getParentEdgeAt(n)->getDims();
-            dims_calc(dims_in1, parent_edge_dims);
-            offset_in_calc(offset_in1, dims_in1, dims_out);
+            offset_in1 = offsets_in[n].data();
 
 #ifdef _WIN32
             for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -1284,17 +1167,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_less(
 #endif
         }
     } else {
-        int dims_out[5], dims_in0[5], dims_in1[5];
-        int offset_out[5], offset_in0[5], offset_in1[5];
-        auto& child_edge_dims = getChildEdgeAt(0)->getDims();
-        auto& parent0_edge_dims = getParentEdgeAt(0)->getDims();
-        auto& parent1_edge_dims = getParentEdgeAt(1)->getDims();
-        dims_calc(dims_out, child_edge_dims);
-        dims_calc(dims_in0, parent0_edge_dims);
-        dims_calc(dims_in1, parent1_edge_dims);
-        offset_out_calc(offset_out, dims_out);
-        offset_in_calc(offset_in0, dims_in0, dims_out);
-        offset_in_calc(offset_in1, dims_in1, dims_out);
+        const int *offset_in0 = offsets_in[0].data();
+        const int *offset_in1 = offsets_in[1].data();
 
 #ifdef _WIN32
         for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -1323,9 +1197,7 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_less(
             const T1 *src_ptr = reinterpret_cast<const T1 *>(getParentEdgeAt(n)->getMemory().GetData()) +
                                 getParentEdgeAt(n)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-            auto& parent_edge_dims = getParentEdgeAt(n)->getDims();
-            dims_calc(dims_in1, parent_edge_dims);
-            offset_in_calc(offset_in1, dims_in1, dims_out);
+            offset_in1 = offsets_in[n].data();
 
 #ifdef _WIN32
             for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -1378,17 +1250,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_less_equal(
 #endif
         }
     } else {
-        int dims_out[5], dims_in0[5], dims_in1[5];
-        int offset_out[5], offset_in0[5], offset_in1[5];
-        auto& child_edge_dims = getChildEdgeAt(0)->getDims();
-        auto& parent0_edge_dims = getParentEdgeAt(0)->getDims();
-        auto& parent1_edge_dims = getParentEdgeAt(1)->getDims();
-        dims_calc(dims_out, child_edge_dims);
-        dims_calc(dims_in0, parent0_edge_dims);
-        dims_calc(dims_in1, parent1_edge_dims);
-        offset_out_calc(offset_out, dims_out);
-        offset_in_calc(offset_in0, dims_in0, dims_out);
-        offset_in_calc(offset_in1, dims_in1, dims_out);
+        const int *offset_in0 = offsets_in[0].data();
+        const int *offset_in1 = offsets_in[1].data();
 
 #ifdef _WIN32
         for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -1417,9 +1280,7 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_less_equal(
             const T1 *src_ptr = reinterpret_cast<const T1 *>(getParentEdgeAt(n)->getMemory().GetData()) +
                                 getParentEdgeAt(n)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-            auto& parent_edge_dims = getParentEdgeAt(n)->getDims();
-            dims_calc(dims_in1, parent_edge_dims);
-            offset_in_calc(offset_in1, dims_in1, dims_out);
+            offset_in1 = offsets_in[n].data();
 
 #ifdef _WIN32
             for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -1472,17 +1333,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_greater(
 #endif
         }
     } else {
-        int dims_out[5], dims_in0[5], dims_in1[5];
-        int offset_out[5], offset_in0[5], offset_in1[5];
-        auto& child_edge_dims = getChildEdgeAt(0)->getDims();
-        auto& parent0_edge_dims = getParentEdgeAt(0)->getDims();
-        auto& parent1_edge_dims = getParentEdgeAt(1)->getDims();
-        dims_calc(dims_out, child_edge_dims);
-        dims_calc(dims_in0, parent0_edge_dims);
-        dims_calc(dims_in1, parent1_edge_dims);
-        offset_out_calc(offset_out, dims_out);
-        offset_in_calc(offset_in0, dims_in0, dims_out);
-        offset_in_calc(offset_in1, dims_in1, dims_out);
+        const int *offset_in0 = offsets_in[0].data();
+        const int *offset_in1 = offsets_in[1].data();
 
 #ifdef _WIN32
         for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -1511,9 +1363,7 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_greater(
             const T1 *src_ptr = reinterpret_cast<const T1 *>(getParentEdgeAt(n)->getMemory().GetData()) +
                                 getParentEdgeAt(n)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-            auto& parent_edge_dims = getParentEdgeAt(n)->getDims();
-            dims_calc(dims_in1, parent_edge_dims);
-            offset_in_calc(offset_in1, dims_in1, dims_out);
+            offset_in1 = offsets_in[n].data();
 
 #ifdef _WIN32
             for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -1566,17 +1416,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_greater_equa
 #endif
         }
     } else {
-        int dims_out[5], dims_in0[5], dims_in1[5];
-        int offset_out[5], offset_in0[5], offset_in1[5];
-        auto& child_edge_dims = getChildEdgeAt(0)->getDims();
-        auto& parent0_edge_dims = getParentEdgeAt(0)->getDims();
-        auto& parent1_edge_dims = getParentEdgeAt(1)->getDims();
-        dims_calc(dims_out, child_edge_dims);
-        dims_calc(dims_in0, parent0_edge_dims);
-        dims_calc(dims_in1, parent1_edge_dims);
-        offset_out_calc(offset_out, dims_out);
-        offset_in_calc(offset_in0, dims_in0, dims_out);
-        offset_in_calc(offset_in1, dims_in1, dims_out);
+        const int *offset_in0 = offsets_in[0].data();
+        const int *offset_in1 = offsets_in[1].data();
 
 #ifdef _WIN32
         for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -1605,9 +1446,7 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_greater_equa
             const T1 *src_ptr = reinterpret_cast<const T1 *>(getParentEdgeAt(n)->getMemory().GetData()) +
                                 getParentEdgeAt(n)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-            auto& parent_edge_dims = getParentEdgeAt(n)->getDims();
-            dims_calc(dims_in1, parent_edge_dims);
-            offset_in_calc(offset_in1, dims_in1, dims_out);
+            offset_in1 = offsets_in[n].data();
 
 #ifdef _WIN32
             for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -1660,17 +1499,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_logical_and(
 #endif
         }
     } else {
-        int dims_out[5], dims_in0[5], dims_in1[5];
-        int offset_out[5], offset_in0[5], offset_in1[5];
-        auto& child_edge_dims = getChildEdgeAt(0)->getDims();
-        auto& parent0_edge_dims = getParentEdgeAt(0)->getDims();
-        auto& parent1_edge_dims = getParentEdgeAt(1)->getDims();
-        dims_calc(dims_out, child_edge_dims);
-        dims_calc(dims_in0, parent0_edge_dims);
-        dims_calc(dims_in1, parent1_edge_dims);
-        offset_out_calc(offset_out, dims_out);
-        offset_in_calc(offset_in0, dims_in0, dims_out);
-        offset_in_calc(offset_in1, dims_in1, dims_out);
+        const int *offset_in0 = offsets_in[0].data();
+        const int *offset_in1 = offsets_in[1].data();
 
 #ifdef _WIN32
         for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -1699,9 +1529,7 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_logical_and(
             const T1 *src_ptr = reinterpret_cast<const T1 *>(getParentEdgeAt(n)->getMemory().GetData()) +
                                 getParentEdgeAt(n)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-            auto& parent_edge_dims = getParentEdgeAt(n)->getDims();
-            dims_calc(dims_in1, parent_edge_dims);
-            offset_in_calc(offset_in1, dims_in1, dims_out);
+            offset_in1 = offsets_in[n].data();
 
 #ifdef _WIN32
             for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -1754,17 +1582,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_logical_or(
 #endif
         }
     } else {
-        int dims_out[5], dims_in0[5], dims_in1[5];
-        int offset_out[5], offset_in0[5], offset_in1[5];
-        auto& child_edge_dims = getChildEdgeAt(0)->getDims();
-        auto& parent0_edge_dims = getParentEdgeAt(0)->getDims();
-        auto& parent1_edge_dims = getParentEdgeAt(1)->getDims();
-        dims_calc(dims_out, child_edge_dims);
-        dims_calc(dims_in0, parent0_edge_dims);
-        dims_calc(dims_in1, parent1_edge_dims);
-        offset_out_calc(offset_out, dims_out);
-        offset_in_calc(offset_in0, dims_in0, dims_out);
-        offset_in_calc(offset_in1, dims_in1, dims_out);
+        const int *offset_in0 = offsets_in[0].data();
+        const int *offset_in1 = offsets_in[1].data();
 
 #ifdef _WIN32
         for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -1793,9 +1612,7 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_logical_or(
             const T1 *src_ptr = reinterpret_cast<const T1 *>(getParentEdgeAt(n)->getMemory().GetData()) +
                                 getParentEdgeAt(n)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-            auto& parent_edge_dims = getParentEdgeAt(n)->getDims();
-            dims_calc(dims_in1, parent_edge_dims);
-            offset_in_calc(offset_in1, dims_in1, dims_out);
+            offset_in1 = offsets_in[n].data();
 
 #ifdef _WIN32
             for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -1848,17 +1665,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_logical_xor(
 #endif
         }
     } else {
-        int dims_out[5], dims_in0[5], dims_in1[5];
-        int offset_out[5], offset_in0[5], offset_in1[5];
-        auto& child_edge_dims = getChildEdgeAt(0)->getDims();
-        auto& parent0_edge_dims = getParentEdgeAt(0)->getDims();
-        auto& parent1_edge_dims = getParentEdgeAt(1)->getDims();
-        dims_calc(dims_out, child_edge_dims);
-        dims_calc(dims_in0, parent0_edge_dims);
-        dims_calc(dims_in1, parent1_edge_dims);
-        offset_out_calc(offset_out, dims_out);
-        offset_in_calc(offset_in0, dims_in0, dims_out);
-        offset_in_calc(offset_in1, dims_in1, dims_out);
+        const int *offset_in0 = offsets_in[0].data();
+        const int *offset_in1 = offsets_in[1].data();
 
 #ifdef _WIN32
         for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -1887,9 +1695,7 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_logical_xor(
             const T1 *src_ptr = reinterpret_cast<const T1 *>(getParentEdgeAt(n)->getMemory().GetData()) +
                                 getParentEdgeAt(n)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-            auto& parent_edge_dims = getParentEdgeAt(n)->getDims();
-            dims_calc(dims_in1, parent_edge_dims);
-            offset_in_calc(offset_in1, dims_in1, dims_out);
+            offset_in1 = offsets_in[n].data();
 
 #ifdef _WIN32
             for (size_t i0 = 0; i0 < dims_out[0]; i0++) {
@@ -1953,65 +1759,104 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::ref_eltwise(int in0,
     }
 }
 
-void MKLDNNEltwiseNode::execute(mkldnn::stream strm) {
-    if (prim) {
-        MKLDNNNode::execute(strm);
-    } else {
-        if (op == EltwiseLayer::Floor_mod) {
-            for (size_t i = 0; i < getParentEdges().size(); i++)
-                if (getParentEdgeAt(i)->getDesc().getPrecision() != Precision::I32)
-                    THROW_IE_EXCEPTION << "Floor_mod supports only I32 precision of inputs";
-            if (getChildEdgeAt(0)->getDesc().getPrecision() != Precision::I32)
-                THROW_IE_EXCEPTION << "Floor_mod supports only I32 precision of output";
-        }
-        if (getParentEdges().size() > 2) {
-            Precision pi = getParentEdgeAt(0)->getDesc().getPrecision();
-            Precision po = getChildEdgeAt(0)->getDesc().getPrecision();
-            for (int i = 1; i < getParentEdges().size(); i++) {
-                if (getParentEdgeAt(i)->getDesc().getPrecision() != pi)
-                    THROW_IE_EXCEPTION << "If Eltwise node has more than 2 inputs, all inputs must have same precision";
+void MKLDNNEltwiseNode::initReferenceImpl() {
+    ref_impl = nullptr;
+    ref_impl_error.clear();
+    if (op == EltwiseLayer::Floor_mod) {
+        for (size_t i = 0; i < getParentEdges().size(); i++)
+            if (getParentEdgeAt(i)->getDesc().getPrecision() != Precision::I32) {
+                ref_impl_error = "Floor_mod supports only I32 precision of inputs";
+                return;
             }
-            if (pi != po) {
-                THROW_IE_EXCEPTION << "If Eltwise node has more than 2 inputs, all inputs and output must have same precision";
+        if (getChildEdgeAt(0)->getDesc().getPrecision() != Precision::I32) {
+            ref_impl_error = "Floor_mod supports only I32 precision of output";
+            return;
+        }
+    }
+    ref_in0 = 0;
+    ref_in1 = 1;
+    if (getParentEdges().size() > 2) {
+        Precision pi = getParentEdgeAt(0)->getDesc().getPrecision();
+        Precision po = getChildEdgeAt(0)->getDesc().getPrecision();
+        for (int i = 1; i < getParentEdges().size(); i++) {
+            if (getParentEdgeAt(i)->getDesc().getPrecision() != pi) {
+                ref_impl_error = "If Eltwise node has more than 2 inputs, all inputs must have same precision";
+                return;
             }
-            if (pi == Precision::FP32)
-                ref_eltwise<float, float>(0, 1);
-            else if (pi == Precision::I32)
-                ref_eltwise<int32_t, int32_t>(0, 1);
-            else if (pi == Precision::I8)
-                ref_eltwise<int8_t, int8_t>(0, 1);
-            else if (pi == Precision::U8)
-                ref_eltwise<uint8_t, uint8_t>(0, 1);
-            else
-                THROW_IE_EXCEPTION << "If Eltwise node has more than 2 inputs, only FP32, I32, I8, U8 are supported";
+        }
+        if (pi != po) {
+            ref_impl_error = "If Eltwise node has more than 2 inputs, all inputs and output must have same precision";
             return;
         }
+        if (pi == Precision::FP32)
+            ref_impl = &MKLDNNEltwiseNode::ref_eltwise<float, float>;
+        else if (pi == Precision::I32)
+            ref_impl = &MKLDNNEltwiseNode::ref_eltwise<int32_t, int32_t>;
+        else if (pi == Precision::I8)
+            ref_impl = &MKLDNNEltwiseNode::ref_eltwise<int8_t, int8_t>;
+        else if (pi == Precision::U8)
+            ref_impl = &MKLDNNEltwiseNode::ref_eltwise<uint8_t, uint8_t>;
+        else
+            ref_impl_error = "If Eltwise node has more than 2 inputs, only FP32, I32, I8, U8 are supported";
+        return;
+    }
 
-        Precision pi0 = getParentEdgeAt(0)->getDesc().getPrecision();
-        Precision pi1 = getParentEdgeAt(1)->getDesc().getPrecision();
-        Precision po = getChildEdgeAt(0)->getDesc().getPrecision();
+    Precision pi0 = getParentEdgeAt(0)->getDesc().getPrecision();
+    Precision pi1 = getParentEdgeAt(1)->getDesc().getPrecision();
+    Precision po = getChildEdgeAt(0)->getDesc().getPrecision();
 
-        IE_ASSERT(getParentEdges().size() > 1);
-
-        if (po == Precision::FP32 && pi0 == po && pi1 == po) {
-            ref_eltwise<float, float>(0, 1);
-        } else if (po == Precision::FP32 && pi0 == po && pi1 == Precision::I8) {
-            ref_eltwise<float, int8_t>(0, 1);
-        } else if (po == Precision::FP32 && pi1 == po && pi0 == Precision::I8) {
-            ref_eltwise<float, int8_t>(1, 0);
-        } else if (po == Precision::FP32 && pi0 == po && pi1 == Precision::U8) {
-            ref_eltwise<float, uint8_t>(0, 1);
-        } else if (po == Precision::FP32 && pi1 == po && pi0 == Precision::U8) {
-            ref_eltwise<float, uint8_t>(1, 0);
-        } else if (po == Precision::I8 && pi0 == po && pi1 == po) {
-            ref_eltwise<int8_t, int8_t>(0, 1);
-        } else if (po == Precision::I8 && pi0 == po && pi1 == Precision::U8) {
-            ref_eltwise<int8_t, uint8_t>(0, 1);
-        } else if (po == Precision::I8 && pi1 == po && pi0 == Precision::U8) {
-            ref_eltwise<int8_t, uint8_t>(1, 0);
-        } else if (po == Precision::I32 && pi0 == po && pi1 == po) {
-            ref_eltwise<int32_t, int32_t>(0, 1);
-        }
+    IE_ASSERT(getParentEdges().size() > 1);
+
+    if (po == Precision::FP32 && pi0 == po && pi1 == po) {
+        ref_impl = &MKLDNNEltwiseNode::ref_eltwise<float, float>;
+    } else if (po == Precision::FP32 && pi0 == po && pi1 == Precision::I8) {
+        ref_impl = &MKLDNNEltwiseNode::ref_eltwise<float, int8_t>;
+    } else if (po == Precision::FP32 && pi1 == po && pi0 == Precision::I8) {
+        ref_impl = &MKLDNNEltwiseNode::ref_eltwise<float, int8_t>;
+        std::swap(ref_in0, ref_in1);
+    } else if (po == Precision::FP32 && pi0 == po && pi1 == Precision::U8) {
+        ref_impl = &MKLDNNEltwiseNode::ref_eltwise<float, uint8_t>;
+    } else if (po == Precision::FP32 && pi1 == po && pi0 == Precision::U8) {
+        ref_impl = &MKLDNNEltwiseNode::ref_eltwise<float, uint8_t>;
+        std::swap(ref_in0, ref_in1);
+    } else if (po == Precision::I8 && pi0 == po && pi1 == po) {
+        ref_impl = &MKLDNNEltwiseNode::ref_eltwise<int8_t, int8_t>;
+    } else if (po == Precision::I8 && pi0 == po && pi1 == Precision::U8) {
+        ref_impl = &MKLDNNEltwiseNode::ref_eltwise<int8_t, uint8_t>;
+    } else if (po == Precision::I8 && pi1 == po && pi0 == Precision::U8) {
+        ref_impl = &MKLDNNEltwiseNode::ref_eltwise<int8_t, uint8_t>;
+        std::swap(ref_in0, ref_in1);
+    } else if (po == Precision::I32 && pi0 == po && pi1 == po) {
+        ref_impl = &MKLDNNEltwiseNode::ref_eltwise<int32_t, int32_t>;
+    }
+}
+
+void MKLDNNEltwiseNode::prepareBroadcast() {
+    const int batch = batchToProcess();
+    if (!broadcast || batch == prepared_batch)
+        return;
+
+    int dims_in[5];
+    dims_calc(dims_out, getChildEdgeAt(0)->getDims());
+    offset_out_calc(offset_out, dims_out);
+    offsets_in.resize(getParentEdges().size());
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        dims_calc(dims_in, getParentEdgeAt(i)->getDims());
+        offset_in_calc(offsets_in[i].data(), dims_in, dims_out);
+    }
+    prepared_batch = batch;
+}
+
+void MKLDNNEltwiseNode::execute(mkldnn::stream strm) {
+    if (prim) {
+        MKLDNNNode::execute(strm);
+    } else {
+        if (!ref_impl_error.empty())
+            THROW_IE_EXCEPTION << ref_impl_error;
+        // the offsets are recomputed only if the dynamic batch is changed
+        prepareBroadcast();
+        if (ref_impl)
+            (this->*ref_impl)(ref_in0, ref_in1);
     }
 }
 
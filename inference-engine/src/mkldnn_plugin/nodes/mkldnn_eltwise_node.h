@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <array>
 #include <string>
 #include <vector>
 
@@ -33,6 +34,20 @@ private:
     std::vector<float> sum_scales;
     bool broadcast = false;
 
+    // the reference implementation and its inputs are selected once by the precisions of the edges
+    void (MKLDNNEltwiseNode::*ref_impl)(int in0, int in1) = nullptr;
+    int ref_in0 = 0;
+    int ref_in1 = 1;
+    std::string ref_impl_error;
+    void initReferenceImpl();
+
+    // dims and offsets of the broadcasting, they are recomputed only if the batch to process is changed
+    int dims_out[5];
+    int offset_out[5];
+    std::vector<std::array<int, 5>> offsets_in;
+    int prepared_batch = -1;
+    void prepareBroadcast();
+
     template <typename T0, typename T1> void ref_eltwise(int in0, int in1);
     void dims_calc(int *dims, const MKLDNNDims &edge_dims);
     void offset_out_calc(int *offset, int *dims);
@@ -154,13 +154,27 @@ void MKLDNNGemmNode::createPrimitive() {
         if (!src2MemPtr || !src2MemPtr->GetPrimitivePtr())
             THROW_IE_EXCEPTION << "Input memory isn't allocated.";
     }
+
+    auto& inDims0 = getParentEdgeAt(0)->getDims();
+    auto& inDims1 = getParentEdgeAt(1)->getDims();
+    auto& outDims = getChildEdgeAt(0)->getDims();
+
+    outNDims = outDims.ndims();
+    outMB2 = outNDims > 3 ? outDims[outNDims - 3] : 1;
+    M = inDims0[yAxis];
+    N = inDims1[xAxis];
+    K = inDims0[xAxis];
+
+    lda = transposeA ? M : K;
+    ldb = transposeB ? K : N;
+    ldc = N;
+
+    if (!isThreeInputs) {
+        beta = 0.f;
+    }
 }
 
 void MKLDNNGemmNode::execute(mkldnn::stream strm) {
-    auto inDims0 = getParentEdgeAt(0)->getDims();
-    auto inDims1 = getParentEdgeAt(1)->getDims();
-    auto outDims = getChildEdgeAt(0)->getDims();
-
     auto& srcMemory0 = getParentEdgeAt(0)->getMemory();
     auto& srcMemory1 = getParentEdgeAt(1)->getMemory();
     const float *src0_ptr = reinterpret_cast<const float*>(srcMemory0.GetData()) +
@@ -170,19 +184,12 @@ void MKLDNNGemmNode::execute(mkldnn::stream strm) {
     float *dst_ptr = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemory().GetData()) +
                      getChildEdgeAt(0)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-    int MB1 = outDims.ndims() == 4 ? batchToProcess() : 1;
-    int MB2 = outDims.ndims() == 3 ? batchToProcess() : outDims.ndims() > 3 ? outDims[outDims.ndims() - 3] : 1;
-    int M = inDims0[yAxis];
-    int N = inDims1[xAxis];
-    int K = inDims0[xAxis];
+    int MB1 = outNDims == 4 ? batchToProcess() : 1;
+    int MB2 = outNDims == 3 ? batchToProcess() : outMB2;
 
     const char transa = transposeA ? 'T' : 'N';
     const char transb = transposeB ? 'T' : 'N';
 
-    int lda = transposeA ? M : K;
-    int ldb = transposeB ? K : N;
-    int ldc = N;
-
     const float *src2_ptr;
     if (isThreeInputs) {
         auto& srcMemory2 = getParentEdgeAt(2)->getMemory();
@@ -192,10 +199,6 @@ void MKLDNNGemmNode::execute(mkldnn::stream strm) {
         src2_ptr = dst_ptr;
     }
 
-    if (!isThreeInputs) {
-        beta = 0.f;
-    }
-
     for (int b1 = 0; b1 < MB1; b1++) {
         const float *a_ptr = src0_ptr;
         const float *b_ptr = src1_ptr;
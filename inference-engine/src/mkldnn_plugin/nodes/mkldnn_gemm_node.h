@@ -38,6 +38,16 @@ private:
     std::vector<int> aOffsets;
     std::vector<int> bOffsets;
     std::vector<int> cOffsets;
+
+    // sizes of the matrices, they are computed once at createPrimitive
+    int outNDims = 0;
+    int outMB2 = 1;
+    int M = 0;
+    int N = 0;
+    int K = 0;
+    int lda = 0;
+    int ldb = 0;
+    int ldc = 0;
 };
 
 }  // namespace MKLDNNPlugin
@@ -5,9 +5,13 @@
 #include <mkldnn_extension_mngr.h>
 #include <mkldnn_extension_utils.h>
 #include "mkldnn_generic_node.h"
+#include "mkldnn_activation_node.h"
+#include "mkldnn_depthwise_node.h"
 #include <vector>
 #include <string>
+#include <algorithm>
 #include <blob_factory.hpp>
+#include "details/caseless.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -60,6 +64,7 @@ void MKLDNNGenericNode::initSupportedPrimitiveDescriptors() {
 
 void MKLDNNGenericNode::createPrimitive() {
     if (extFactory) {
+        createPostOpsPrimitives();
         return;
     }
     if (getSelectedPrimitiveDescriptor() == nullptr)
@@ -69,11 +74,120 @@ void MKLDNNGenericNode::createPrimitive() {
 void MKLDNNGenericNode::execute(mkldnn::stream strm) {
     if (!impls.empty()) {
         execLayer();
+        for (auto& postOp : postOpsPrims)
+            strm.submit({*postOp});
     } else {
         THROW_IE_EXCEPTION << "Descriptor for generic primitive doesn't exist";
     }
 }
 
+bool MKLDNNGenericNode::canFuse(const MKLDNNNodePtr& node) const {
+    // Only the layers which are known to produce a single dense FP32 output may be fused
+    static const std::vector<std::string> fusableTypes = { "Resample", "Interp", "MVN", "Normalize" };
+    InferenceEngine::details::CaselessEq<std::string> comparator;
+
+    auto layer = getCnnLayer();
+    if (!layer || layer->outData.size() != 1 || getChildEdges().size() != 1)
+        return false;
+    if (std::find_if(fusableTypes.begin(), fusableTypes.end(), [&](const std::string& type) {
+            return comparator(type, layer->type);
+        }) == fusableTypes.end())
+        return false;
+    if (layer->outData[0]->getPrecision() != InferenceEngine::Precision::FP32)
+        return false;
+    size_t ndims = layer->outData[0]->getTensorDesc().getDims().size();
+    if (ndims != 4 && ndims != 5)
+        return false;
+
+    if (!node->getCnnLayer())
+        return false;
+    if (node->getType() == Activation)
+        return true;
+    if (node->getType() == Depthwise) {
+        auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode *>(node.get());
+        return depthwiseNode &&
+               (depthwiseNode->getAlgorithm() == mkldnn::algorithm::depthwise_scale_shift ||
+                depthwiseNode->getAlgorithm() == mkldnn::algorithm::depthwise_prelu);
+    }
+    return false;
+}
+
+void MKLDNNGenericNode::createPostOpsPrimitives() {
+    postOpsPrims.clear();
+    PostOpsIntBlobMemory.clear();
+    if (fusedWith.empty())
+        return;
+
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Destination memory didn't allocate.";
+    auto dstDesc = dstMemPtr->GetDescriptor();
+    auto channels = static_cast<ptrdiff_t>(getChildEdgeAt(0)->getDims()[1]);
+
+    // Blocked kernels read the parameters by whole channel blocks, so they are padded as for the convolution.
+    // The memory is created zero filled, so the padded channels leave the output intact.
+    MKLDNNDims channelsDims({static_cast<ptrdiff_t>(rnd_up(channels, 16))});
+    auto createChannelsMemory = [&](const InferenceEngine::Blob::Ptr& blob) {
+        MKLDNNMemoryPtr mem(new MKLDNNMemory(getEngine()));
+        mem->Create(channelsDims, memory::data_type::f32, memory::format::x);
+        auto* dst = static_cast<float *>(mem->GetData());
+        const auto* src = blob->cbuffer().as<const float *>();
+        // Broadcasted parameters have the only value for all the channels
+        for (ptrdiff_t c = 0; c < channels; c++)
+            dst[c] = src[blob->size() == 1 ? 0 : c];
+        PostOpsIntBlobMemory.push_back(mem);
+        return mem;
+    };
+
+    for (auto& node : fusedWith) {
+        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+        if (activationNode) {
+            eltwise_forward::desc desc(prop_kind::forward_scoring, activationNode->getAlgorithm(), dstDesc,
+                                       activationNode->getAlpha(), activationNode->getBeta());
+            eltwise_forward::primitive_desc primDesc(desc, getEngine());
+            postOpsPrims.emplace_back();
+            postOpsPrims.back().reset(new eltwise_forward(primDesc, dstMemPtr->GetPrimitive(), dstMemPtr->GetPrimitive()));
+            continue;
+        }
+
+        auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode *>(node.get());
+        if (depthwiseNode) {
+            auto* depthwiseLayer = dynamic_cast<InferenceEngine::WeightableLayer *>(depthwiseNode->getCnnLayer().get());
+            if (depthwiseLayer == nullptr || !depthwiseLayer->_weights)
+                THROW_IE_EXCEPTION << "Cannot get weights of the fused layer " << node->getName();
+
+            auto weights = createChannelsMemory(depthwiseLayer->_weights);
+            if (depthwiseNode->isWithBiases() && depthwiseLayer->_biases) {
+                auto biases = createChannelsMemory(depthwiseLayer->_biases);
+                depthwise_forward::desc desc(prop_kind::forward_scoring, depthwiseNode->getAlgorithm(), dstDesc, dstDesc,
+                                             weights->GetDescriptor(), biases->GetDescriptor());
+                depthwise_forward::primitive_desc primDesc(desc, getEngine());
+                postOpsPrims.emplace_back();
+                postOpsPrims.back().reset(new depthwise_forward(primDesc, dstMemPtr->GetPrimitive(), weights->GetPrimitive(),
+                                                                biases->GetPrimitive(), dstMemPtr->GetPrimitive()));
+            } else {
+                depthwise_forward::desc desc(prop_kind::forward_scoring, depthwiseNode->getAlgorithm(), dstDesc, dstDesc,
+                                             weights->GetDescriptor());
+                depthwise_forward::primitive_desc primDesc(desc, getEngine());
+                postOpsPrims.emplace_back();
+                postOpsPrims.back().reset(new depthwise_forward(primDesc, dstMemPtr->GetPrimitive(), weights->GetPrimitive(),
+                                                                dstMemPtr->GetPrimitive()));
+            }
+            continue;
+        }
+
+        THROW_IE_EXCEPTION << "Fusing of " << node->getName() << " into "
+                           << getName() << " is not supported";
+    }
+}
+
+void MKLDNNGenericNode::setDynamicBatchLim(int lim) {
+    MKLDNNNode::setDynamicBatchLim(lim);
+    // The fused operations work in place on the output, which is the only data (not weights) input of them
+    for (auto& postOp : postOpsPrims)
+        postOp.setBatchLimit(batchToProcess(), 1, 1);
+}
+
 bool MKLDNNGenericNode::created() const {
     return Generic == getType();
 }
@@ -32,12 +32,21 @@ public:
 
     void execLayer();
     void cleanup() override;
+    void setDynamicBatchLim(int lim) override;
+
+    bool canFuse(const MKLDNNNodePtr& node) const;
 
 
 protected:
     InferenceEngine::ILayerImplFactory::Ptr extFactory;
     std::vector<InferenceEngine::ILayerImpl::Ptr> impls;
 
+    // Fused Activation and Depthwise nodes, applied in place on the output after the layer
+    std::vector<MKLDNNPrimitive> postOpsPrims;
+    std::vector<MKLDNNMemoryPtr> PostOpsIntBlobMemory;
+
+    void createPostOpsPrimitives();
+
 private:
     static Register<MKLDNNGenericNode> reg;
 };
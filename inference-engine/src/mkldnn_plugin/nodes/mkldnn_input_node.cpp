@@ -94,6 +94,9 @@ bool MKLDNNInputNode::created() const {
 void MKLDNNInputNode::execute(mkldnn::stream strm) {
     if (!constBlob)
         return;
+    // the output memory may be bound to the blob itself
+    if (getChildEdgeAt(0)->getMemory().GetData() == constBlob->cbuffer().as<const void *>())
+        return;
     auto dstBlob = getChildEdgeAt(0)->getBlob();
     const float *srcData = constBlob->cbuffer().as<float *>();
     float *dstData = dstBlob->buffer();
@@ -25,6 +25,10 @@ public:
         isMeanImage = true;
     }
 
+    const InferenceEngine::Blob::Ptr& getConstBlob() const {
+        return constBlob;
+    }
+
 private:
     static Register<MKLDNNInputNode> reg;
     InferenceEngine::Blob::Ptr constBlob;
@@ -100,6 +100,7 @@ void MKLDNNPermuteNode::createPrimitive() {
         THROW_IE_EXCEPTION << "Input memory didn't allocate.";
     if (getSelectedPrimitiveDescriptor() == nullptr)
         THROW_IE_EXCEPTION << "Preferable primitive descriptor does not set.";
+    prepareParams();
 }
 
 static void permute_to_0231(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
@@ -323,30 +324,41 @@ std::multimap<InferenceEngine::SizeVector, MKLDNNPermuteNode::PermuteImpl> MKLDN
         })},  // learning-to-see-in-the-dark-sony
 };
 
-void MKLDNNPermuteNode::execute(mkldnn::stream strm) {
+void MKLDNNPermuteNode::prepareParams() {
     auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
     auto &srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
-    auto src_data = reinterpret_cast<const float *>(srcMemPtr->GetData());
-    auto dst_data = reinterpret_cast<float *>(dstMemPtr->GetData());
 
+    optimizedImpl = nullptr;
     for (const auto &impl : OptimizedCases) {
         if (impl.first == order && impl.second.isValidParams(srcMemPtr, dstMemPtr)) {
-            impl.second.execute(batchToProcess(), srcMemPtr, dstMemPtr);
+            optimizedImpl = &impl.second;
             return;
         }
     }
 
     auto srcBlob = getParentEdgeAt(0)->getBlob();
-    TensorDesc srcDesc = srcBlob->getTensorDesc();
-
+    srcDesc = srcBlob->getTensorDesc();
     SizeVector& dims = srcDesc.getDims();
     InferenceEngine::SizeVector orderedDims;
     for (auto ord : order) {
         orderedDims.push_back(dims[ord]);
     }
-    TensorDesc dstDesc(InferenceEngine::Precision::FP32, dims, {orderedDims, order});
+    dstDesc = TensorDesc(InferenceEngine::Precision::FP32, dims, {orderedDims, order});
+    batchDataSize = srcBlob->size() / dims[0];
+}
+
+void MKLDNNPermuteNode::execute(mkldnn::stream strm) {
+    auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    auto &srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
+    auto src_data = reinterpret_cast<const float *>(srcMemPtr->GetData());
+    auto dst_data = reinterpret_cast<float *>(dstMemPtr->GetData());
+
+    if (optimizedImpl) {
+        optimizedImpl->execute(batchToProcess(), srcMemPtr, dstMemPtr);
+        return;
+    }
 
-    int dataSize = srcBlob->size() / srcDesc.getDims()[0] * batchToProcess();
+    int dataSize = batchDataSize * batchToProcess();
 
     parallel_for(dataSize, [&](int i) {
         dst_data[dstDesc.offset(i)] = src_data[srcDesc.offset(i)];
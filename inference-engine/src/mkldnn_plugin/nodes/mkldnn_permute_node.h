@@ -41,6 +41,13 @@ private:
     };
 
     static std::multimap<InferenceEngine::SizeVector, PermuteImpl> OptimizedCases;
+
+    // the implementation and the descriptors of the generic case are selected once at createPrimitive
+    const PermuteImpl* optimizedImpl = nullptr;
+    InferenceEngine::TensorDesc srcDesc;
+    InferenceEngine::TensorDesc dstDesc;
+    size_t batchDataSize = 0;
+    void prepareParams();
 };
 
 }  // namespace MKLDNNPlugin
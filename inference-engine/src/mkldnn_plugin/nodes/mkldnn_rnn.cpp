@@ -6,8 +6,11 @@
 #include "mkldnn_extension_utils.h"
 #include "desc_iterator.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <utility>
+#include <vector>
 
 using namespace mkldnn;
 using namespace InferenceEngine;
@@ -51,6 +54,15 @@ static algorithm ie2mkl(RNNCellBase::CellType cell_type) {
 
 MKLDNNRNN::MKLDNNRNN(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng) : MKLDNNNode(layer, eng) {
     is_cell = one_of(layer->type, "LSTMCell", "GRUCell", "RNNCell");
+
+    // Set by the int8 normalizer from the calibration statistics
+    auto qparams = layer->blobs.find("rnn-data-qparams");
+    if (qparams != layer->blobs.end() && qparams->second->size() == 2) {
+        auto data = qparams->second->buffer().as<const float*>();
+        dataScale = data[0];
+        dataShift = data[1];
+        quantized = true;
+    }
 }
 
 bool MKLDNNRNN::created() const {
@@ -78,6 +90,8 @@ void MKLDNNRNN::fillCellDesc() {
     if (cellLayer->clip != 0.0f)
         cell_desc.set_clipping(cellLayer->clip);
 
+    quantized = quantized && cell_type == vanilla_lstm;
+
     auto &ins = cellLayer->insData;
     auto &outs = cellLayer->outData;
 
@@ -184,6 +198,9 @@ void MKLDNNRNN::fillSeqDesc() {
         THROW_IE_EXCEPTION << "RNN layer supports only sequence axis 0 or 1";
     nativeOrder = rnnLayer->axis == 0;
 
+    // the data is quantized by the reorder which keeps the tnc layout
+    quantized = quantized && cell_type == vanilla_lstm && nativeOrder;
+
     if (!one_of(rnnLayer->direction, _RNN::FWD, _RNN::BWD))
         THROW_IE_EXCEPTION << "RNN layer supports only unidirectional RNN layer";
     direction = ie2mkl(rnnLayer->direction);
@@ -478,6 +495,10 @@ void MKLDNNRNN::createPrimitive() {
     workspace_mem->Create({}, memory::f32, memory::format_undef, nullptr);  // stub, not in use
     internalBlobMemory.push_back(workspace_mem);
 
+    if (quantized && createQuantizedPrimitive(src_data_mem, src_state_mem, w_data_mem, w_state_mem, w_bias_mem,
+                                              dst_data_mem, dst_state_mem, workspace_mem))
+        return;
+
     auto p = new rnn_forward(pd,
             /* In Data       */ src_data_mem ->GetPrimitive(),
             /* In State      */ src_state_mem->GetPrimitive(),
@@ -491,7 +512,95 @@ void MKLDNNRNN::createPrimitive() {
     prim.reset(p);
 }
 
+bool MKLDNNRNN::createQuantizedPrimitive(const MKLDNNMemoryPtr &src_data_mem, const MKLDNNMemoryPtr &src_state_mem,
+                                         const MKLDNNMemoryPtr &w_data_mem, const MKLDNNMemoryPtr &w_state_mem,
+                                         const MKLDNNMemoryPtr &w_bias_mem, const MKLDNNMemoryPtr &dst_data_mem,
+                                         const MKLDNNMemoryPtr &dst_state_mem, const MKLDNNMemoryPtr &workspace_mem) {
+    /* Weights are quantized per output channel, the scale is common for data and state parts.
+     * The output channels are the last two dimensions (gates, out_state_size) of ldigo.
+     */
+    const ptrdiff_t OC = G * SC;
+    std::vector<float> w_scales(OC, 1.f);
+    auto w_ptr = static_cast<const float*>(w_data_mem->GetData());
+    auto r_ptr = static_cast<const float*>(w_state_mem->GetData());
+    for (ptrdiff_t oc = 0; oc < OC; oc++) {
+        float abs_max = 0.f;
+        for (ptrdiff_t in_i = 0; in_i < DC; in_i++)
+            abs_max = std::max(abs_max, std::fabs(w_ptr[in_i * OC + oc]));
+        for (ptrdiff_t in_i = 0; in_i < SC; in_i++)
+            abs_max = std::max(abs_max, std::fabs(r_ptr[in_i * OC + oc]));
+        if (abs_max > 0.f)
+            w_scales[oc] = 127.f / abs_max;
+    }
+
+    try {
+        primitive_attr attr;
+        attr.set_int_output_round_mode(round_nearest);
+        attr.set_rnn_data_qparams(dataScale, dataShift);
+        attr.set_rnn_weights_qparams(0x3, w_scales);
+
+        // u8 input data and s8 weights in the layout selected by the implementation,
+        // states and output data stay in f32
+        MKLDNNMemoryDesc q_data_d {in_data_d.getDims(), memory::u8, memory::tnc};
+        memory::desc q_w_data_d {w_data_d.getDims(), memory::s8, memory::any};
+        memory::desc q_w_state_d {w_state_d.getDims(), memory::s8, memory::any};
+
+        rnn_forward::desc d(forward_scoring, cell_desc, direction,
+                q_data_d, in_state_d, q_w_data_d, q_w_state_d, w_bias_d, out_data_d, out_state_d);
+        rnn_forward::primitive_desc pd(d, attr, getEngine());
+
+        auto q_w_data_mem = std::make_shared<MKLDNNMemory>(getEngine());
+        q_w_data_mem->Create(pd.weights_layer_primitive_desc().desc());
+        auto q_w_state_mem = std::make_shared<MKLDNNMemory>(getEngine());
+        q_w_state_mem->Create(pd.weights_iter_primitive_desc().desc());
+
+        // Weights are quantized once, the data is quantized on every execution
+        mkldnn::reorder::primitive_desc w_data_rpd(w_data_mem->GetPrimitive().get_primitive_desc(),
+                                           q_w_data_mem->GetPrimitive().get_primitive_desc(), attr);
+        mkldnn::reorder::primitive_desc w_state_rpd(w_state_mem->GetPrimitive().get_primitive_desc(),
+                                            q_w_state_mem->GetPrimitive().get_primitive_desc(), attr);
+        mkldnn::stream(stream::kind::eager).submit({
+                mkldnn::reorder(w_data_rpd, w_data_mem->GetPrimitive(), q_w_data_mem->GetPrimitive()),
+                mkldnn::reorder(w_state_rpd, w_state_mem->GetPrimitive(), q_w_state_mem->GetPrimitive())}).wait();
+
+        // the input of cell is nc, which is the same memory as tnc with T = 1
+        auto src_view_mem = std::make_shared<MKLDNNMemory>(getEngine());
+        src_view_mem->Create(in_data_d, src_data_mem->GetData());
+        src_view = src_view_mem;
+        auto q_src_data_mem = std::make_shared<MKLDNNMemory>(getEngine());
+        q_src_data_mem->Create(q_data_d);
+        mkldnn::reorder::primitive_desc src_rpd(src_view_mem->GetPrimitive().get_primitive_desc(),
+                                        q_src_data_mem->GetPrimitive().get_primitive_desc(), attr);
+        mkldnn::reorder quantize_src(src_rpd, src_view_mem->GetPrimitive(), q_src_data_mem->GetPrimitive());
+
+        auto p = new rnn_forward(pd,
+                /* In Data       */ q_src_data_mem->GetPrimitive(),
+                /* In State      */ src_state_mem ->GetPrimitive(),
+                /* Weights data  */ q_w_data_mem  ->GetPrimitive(),
+                /* Weights state */ q_w_state_mem ->GetPrimitive(),
+                /* Bias          */ w_bias_mem    ->GetPrimitive(),
+                /* Out Data      */ dst_data_mem  ->GetPrimitive(),
+                /* Out State     */ dst_state_mem ->GetPrimitive(),
+                /* Workspace     */ workspace_mem ->GetPrimitive());
+        prim.reset(p);
+
+        internalBlobMemory.push_back(q_w_data_mem);
+        internalBlobMemory.push_back(q_w_state_mem);
+        internalBlobMemory.push_back(src_view_mem);
+        internalBlobMemory.push_back(q_src_data_mem);
+        exec_before.push_back(quantize_src);
+    } catch (const mkldnn::error &) {
+        // int8 implementation is not available, fall back to fp32
+        return false;
+    }
+    return true;
+}
+
 void MKLDNNRNN::execute(mkldnn::stream strm) {
+    // the input memory may be replaced by a blob of the user or an iteration of tensor iterator after creation
+    if (src_view)
+        src_view->GetPrimitivePtr()->set_data_handle(getParentEdgeAt(0)->getMemory().GetPrimitive().get_data_handle());
+
     if (!exec_before.empty())
         strm.submit({exec_before.begin(), exec_before.end()});
 
@@ -29,6 +29,10 @@ public:
 private:
     void fillCellDesc();
     void fillSeqDesc();
+    bool createQuantizedPrimitive(const MKLDNNMemoryPtr &src_data_mem, const MKLDNNMemoryPtr &src_state_mem,
+                                  const MKLDNNMemoryPtr &w_data_mem, const MKLDNNMemoryPtr &w_state_mem,
+                                  const MKLDNNMemoryPtr &w_bias_mem, const MKLDNNMemoryPtr &dst_data_mem,
+                                  const MKLDNNMemoryPtr &dst_state_mem, const MKLDNNMemoryPtr &workspace_mem);
 
 private:
     static Register<MKLDNNRNN> reg;
@@ -56,6 +60,14 @@ private:
     const ptrdiff_t L = 1;   /**< What is it??. Constant for mkldnn impl */
     const ptrdiff_t D = 1;   /**< Num of direction. 1 or 2 */
 
+    /** Quantized execution with u8 data and s8 weights, supported for LSTM cell only */
+    bool quantized = false;
+    /** Quantization of data and states: u8 = data * scale + shift */
+    float dataScale = 1.f;
+    float dataShift = 0.f;
+    /** View of the input data quantized before execution, it follows the data of the input edge */
+    MKLDNNMemoryPtr src_view;
+
     MKLDNNMemoryDesc in_data_d;
     MKLDNNMemoryDesc out_data_d;
 
@@ -0,0 +1,435 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_tensoriterator_node.h"
+#include <ie_layers.h>
+#include <ie_util_internal.hpp>
+#include <string>
+#include <vector>
+#include <unordered_set>
+#include <mkldnn_types.h>
+#include <mkldnn_extension_utils.h>
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+/**
+ * @brief Returns the number of iterations, -1 if the port maps iterate different numbers of times
+ */
+int getNumIterations(const InferenceEngine::TensorIterator& ti) {
+    int iterations = 1;
+    bool found = false;
+    auto check = [&](const TensorIterator::PortMap& rule, const DataPtr& data) {
+        if (rule.axis == -1)
+            return true;
+        if (!data || rule.stride == 0 || rule.axis < 0 || rule.axis >= data->getDims().size())
+            return false;
+        int size = static_cast<int>(data->getDims()[rule.axis]) / std::abs(rule.stride);
+        if (found && size != iterations)
+            return false;
+        iterations = size;
+        found = true;
+        return true;
+    };
+    for (const auto& rule : ti.input_port_map) {
+        if (rule.from < 0 || rule.from >= ti.insData.size() || !check(rule, ti.insData[rule.from].lock()))
+            return -1;
+    }
+    for (const auto& rule : ti.output_port_map) {
+        if (rule.from < 0 || rule.from >= ti.outData.size() || !check(rule, ti.outData[rule.from]))
+            return -1;
+    }
+    return iterations;
+}
+
+/**
+ * @brief Checks if the data of the port can be passed to the body data by the rule
+ */
+bool isRuleSupported(const TensorIterator::PortMap& rule, const DataPtr& data, const DataPtr& bodyData, int iterations) {
+    if (!data || !bodyData)
+        return false;
+    SizeVector dims = data->getDims();
+    if (rule.axis != -1) {
+        if (dims[rule.axis] != static_cast<size_t>(iterations * std::abs(rule.stride)))
+            return false;
+        size_t outer = 1;
+        for (int i = 0; i < rule.axis; i++)
+            outer *= dims[i];
+        dims[rule.axis] = std::abs(rule.stride);
+        // the slice which is not contiguous is copied with the strides of the whole data, so the dims must match
+        if (outer != 1)
+            return dims == bodyData->getDims();
+    }
+    return details::product(dims) == details::product(bodyData->getDims());
+}
+
+bool isDataSupported(const DataPtr& data) {
+    return data && data->getPrecision() == Precision::FP32 && !data->getDims().empty() && data->getDims().size() <= 5;
+}
+
+}  // namespace
+
+MKLDNNTensorIteratorNode::MKLDNNTensorIteratorNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng)
+        : MKLDNNNode(layer, eng) {}
+
+bool MKLDNNTensorIteratorNode::isSupported(const InferenceEngine::TensorIterator& ti) {
+    int iterations = getNumIterations(ti);
+    if (iterations < 1)
+        return false;
+
+    for (const auto& in : ti.insData) {
+        if (!isDataSupported(in.lock()))
+            return false;
+    }
+    for (const auto& out : ti.outData) {
+        if (!isDataSupported(out))
+            return false;
+    }
+    for (const auto& in : ti.body.inputs) {
+        if (!isDataSupported(in))
+            return false;
+    }
+    for (const auto& out : ti.body.outputs) {
+        // the outputs of the body must be computed by the body
+        if (!isDataSupported(out) || !out->getCreatorLayer().lock())
+            return false;
+    }
+
+    // every input of the body takes the data of one port of the node or of one back-edge
+    std::vector<int> inputRules(ti.body.inputs.size(), 0), inputBackEdges(ti.body.inputs.size(), 0);
+    for (const auto& edge : ti.back_edges) {
+        if (edge.from < 0 || edge.from >= ti.body.outputs.size() || edge.to < 0 || edge.to >= ti.body.inputs.size())
+            return false;
+        if (ti.body.outputs[edge.from]->getDims() != ti.body.inputs[edge.to]->getDims())
+            return false;
+        inputBackEdges[edge.to]++;
+    }
+    for (const auto& rule : ti.input_port_map) {
+        if (rule.to < 0 || rule.to >= ti.body.inputs.size())
+            return false;
+        if (!isRuleSupported(rule, ti.insData[rule.from].lock(), ti.body.inputs[rule.to], iterations))
+            return false;
+        if (rule.axis != -1 && inputBackEdges[rule.to])
+            return false;
+        inputRules[rule.to]++;
+    }
+    for (size_t i = 0; i < ti.body.inputs.size(); i++) {
+        if (inputRules[i] > 1 || inputBackEdges[i] > 1 || (!inputRules[i] && !inputBackEdges[i]))
+            return false;
+    }
+    for (const auto& rule : ti.output_port_map) {
+        if (rule.to < 0 || rule.to >= ti.body.outputs.size())
+            return false;
+        if (!isRuleSupported(rule, ti.outData[rule.from], ti.body.outputs[rule.to], iterations))
+            return false;
+    }
+    return true;
+}
+
+void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
+    auto * tiLayer = dynamic_cast<InferenceEngine::TensorIterator*>(getCnnLayer().get());
+
+    if (tiLayer == nullptr)
+        THROW_IE_EXCEPTION << "Cannot convert tensor iterator layer.";
+
+    if (!isSupported(*tiLayer))
+        THROW_IE_EXCEPTION << "TensorIterator " << getName() << " cannot be executed as a loop, it has to be unrolled";
+
+    if (getParentEdges().size() != tiLayer->insData.size())
+        THROW_IE_EXCEPTION << "Incorrect number of input edges for layer " << getName();
+    if (!getChildEdges().size())
+        THROW_IE_EXCEPTION << "Incorrect number of output edges for layer " << getName();
+
+    iterations = getNumIterations(*tiLayer);
+}
+
+void MKLDNNTensorIteratorNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    // the slices are taken from the plain data
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = false;
+    for (const auto& dims : inDims) {
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = MKLDNNMemoryDesc(dims, memory::f32, MKLDNNMemory::GetPlainFormat(dims));
+        config.inConfs.push_back(dataConfig);
+    }
+    for (const auto& dims : outDims) {
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = MKLDNNMemoryDesc(dims, memory::f32, MKLDNNMemory::GetPlainFormat(dims));
+        config.outConfs.push_back(dataConfig);
+    }
+    supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown});
+}
+
+void MKLDNNTensorIteratorNode::createPrimitive() {
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor does not set.";
+    for (size_t i = 0; i < inDims.size(); i++) {
+        auto& memPtr = getParentEdgesAtPort(i)[0]->getMemoryPtr();
+        if (!memPtr || !memPtr->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Input memory didn't allocate.";
+    }
+    for (size_t i = 0; i < outDims.size(); i++) {
+        auto children = getChildEdgesAtPort(i);
+        if (children.empty() || !children[0]->getMemoryPtr() || !children[0]->getMemoryPtr()->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Destination memory didn't allocate.";
+    }
+    if (body)
+        return;
+    createBody();
+}
+
+void MKLDNNTensorIteratorNode::createBody() {
+    auto * tiLayer = dynamic_cast<InferenceEngine::TensorIterator*>(getCnnLayer().get());
+    if (tiLayer == nullptr)
+        THROW_IE_EXCEPTION << "Cannot convert tensor iterator layer.";
+
+    // The body is everything the outputs of the body are computed from, including the constant layers.
+    // It is compiled once and shares the weights with the layer.
+    std::vector<CNNLayerPtr> layers;
+    std::unordered_set<CNNLayer *> visited;
+    std::vector<CNNLayerPtr> stack;
+    for (const auto& out : tiLayer->body.outputs)
+        stack.push_back(out->getCreatorLayer().lock());
+    while (!stack.empty()) {
+        CNNLayerPtr layer = stack.back();
+        stack.pop_back();
+        if (!layer || !visited.insert(layer.get()).second)
+            continue;
+        layers.push_back(layer);
+        for (const auto& in : layer->insData)
+            stack.push_back(in.lock()->getCreatorLayer().lock());
+    }
+    auto net = cloneNet(layers, nullptr);
+    // the outputs which are also consumed inside the body are not detected by the cloning
+    for (const auto& out : tiLayer->body.outputs)
+        net->addOutput(out->getName());
+
+    body = std::make_shared<MKLDNNGraph>();
+    body->CreateGraph(*net, extMgr);
+
+    backEdges.resize(tiLayer->back_edges.size());
+    std::vector<int> inputBackEdge(tiLayer->body.inputs.size(), -1);
+    for (size_t i = 0; i < tiLayer->back_edges.size(); i++)
+        inputBackEdge[tiLayer->back_edges[i].to] = static_cast<int>(i);
+
+    bodyInputs.resize(tiLayer->body.inputs.size());
+    for (size_t i = 0; i < tiLayer->body.inputs.size(); i++) {
+        auto node = body->inputNodes.find(tiLayer->body.inputs[i]->getName());
+        // the input is not used by the body
+        if (node == body->inputNodes.end())
+            continue;
+        auto& input = bodyInputs[i];
+        for (size_t j = 0; j < node->second->getChildEdges().size(); j++)
+            input.edges.push_back(node->second->getChildEdgeAt(j));
+        input.bound = MKLDNNGraph::CanRebindInput(node->second);
+
+        int e = inputBackEdge[i];
+        if (e < 0)
+            continue;
+        // the state keeps the format of the body input, so the input is always bound to it if it can be
+        const MKLDNNMemory& bodyMemory = input.edges[0]->getMemory();
+        auto& edge = backEdges[e];
+        for (auto& buffer : edge.buffers) {
+            buffer = std::make_shared<MKLDNNMemory>(getEngine());
+            buffer->Create(bodyMemory.GetDescriptor());
+        }
+        input.data.kind = PortData::BackEdge;
+        input.data.index = e;
+        input.data.view = std::make_shared<MKLDNNMemory>(getEngine());
+        input.data.view->Create(bodyMemory.GetDescriptor(), edge.buffers[0]->GetData());
+        if (!input.bound)
+            input.data.reorder = std::make_shared<mkldnn::reorder>(input.data.view->GetPrimitive(), bodyMemory.GetPrimitive());
+    }
+
+    for (const auto& rule : tiLayer->input_port_map) {
+        auto& input = bodyInputs[rule.to];
+        if (input.edges.empty())
+            continue;
+        const MKLDNNMemoryPtr& port = getParentEdgesAtPort(rule.from)[0]->getMemoryPtr();
+        int e = inputBackEdge[rule.to];
+        if (e >= 0) {
+            // the initial state of the back-edge
+            auto& edge = backEdges[e];
+            edge.hasInit = true;
+            edge.init.kind = PortData::Whole;
+            edge.init.index = rule.from;
+            initPortData(edge.init, port, rule, *edge.buffers[0]);
+            edge.init.reorder = std::make_shared<mkldnn::reorder>(edge.init.view->GetPrimitive(),
+                                                                  edge.buffers[0]->GetPrimitive());
+            continue;
+        }
+
+        const MKLDNNMemory& bodyMemory = input.edges[0]->getMemory();
+        input.data.kind = rule.axis == -1 ? PortData::Whole : PortData::Slice;
+        input.data.index = rule.from;
+        initPortData(input.data, port, rule, bodyMemory);
+        input.bound = input.bound && input.data.view->GetPrimitiveDescriptor() == bodyMemory.GetPrimitiveDescriptor();
+        if (!input.bound)
+            input.data.reorder = std::make_shared<mkldnn::reorder>(input.data.view->GetPrimitive(), bodyMemory.GetPrimitive());
+    }
+
+    bodyOutputs.resize(tiLayer->body.outputs.size());
+    for (size_t i = 0; i < tiLayer->body.outputs.size(); i++) {
+        MKLDNNNodePtr node;
+        for (auto& out : body->GetOutputNodes()) {
+            if (out->getName() == "out_" + tiLayer->body.outputs[i]->getName()) {
+                node = out;
+                break;
+            }
+        }
+        if (!node)
+            THROW_IE_EXCEPTION << "Cannot find the output " << tiLayer->body.outputs[i]->getName()
+                               << " of the body of " << getName();
+        auto& output = bodyOutputs[i];
+        output.edge = node->getParentEdgeAt(0);
+        const MKLDNNMemory& bodyMemory = output.edge->getMemory();
+
+        for (const auto& rule : tiLayer->output_port_map) {
+            if (rule.to != i)
+                continue;
+            PortData data;
+            data.kind = rule.axis == -1 ? PortData::Last : PortData::Slice;
+            data.index = rule.from;
+            initPortData(data, getChildEdgesAtPort(rule.from)[0]->getMemoryPtr(), rule, bodyMemory);
+            output.data.push_back(data);
+        }
+        for (size_t e = 0; e < tiLayer->back_edges.size(); e++) {
+            if (tiLayer->back_edges[e].from != i || !backEdges[e].buffers[0])
+                continue;
+            PortData data;
+            data.kind = PortData::BackEdge;
+            data.index = static_cast<int>(e);
+            data.view = std::make_shared<MKLDNNMemory>(getEngine());
+            data.view->Create(backEdges[e].buffers[0]->GetDescriptor(), backEdges[e].buffers[0]->GetData());
+            output.data.push_back(data);
+        }
+
+        // The output is bound to the state of the back-edge rather than to the port of the node:
+        // the state is needed by the next iteration, the port takes a copy then.
+        if (MKLDNNGraph::CanRebindOutput(node)) {
+            for (size_t k = 0; k < output.data.size() && output.bound < 0; k++) {
+                if (output.data[k].kind == PortData::BackEdge &&
+                        output.data[k].view->GetPrimitiveDescriptor() == bodyMemory.GetPrimitiveDescriptor())
+                    output.bound = static_cast<int>(k);
+            }
+            if (output.bound < 0 && output.data.size() == 1 &&
+                    output.data[0].view->GetPrimitiveDescriptor() == bodyMemory.GetPrimitiveDescriptor())
+                output.bound = 0;
+        }
+        for (size_t k = 0; k < output.data.size(); k++) {
+            if (static_cast<int>(k) != output.bound)
+                output.data[k].reorder = std::make_shared<mkldnn::reorder>(bodyMemory.GetPrimitive(), output.data[k].view->GetPrimitive());
+        }
+    }
+}
+
+void MKLDNNTensorIteratorNode::initPortData(PortData& data, const MKLDNNMemoryPtr& port,
+                                            const InferenceEngine::TensorIterator::PortMap& rule,
+                                            const MKLDNNMemory& bodyMemory) {
+    data.port = port;
+    MKLDNNDims dims(port->GetDescriptor().data.dims, port->GetDescriptor().data.ndims);
+    MKLDNNDims bodyDims(bodyMemory.GetDescriptor().data.dims, bodyMemory.GetDescriptor().data.ndims);
+    memory::desc desc = MKLDNNMemoryDesc(bodyDims, memory::f32, MKLDNNMemory::GetPlainFormat(bodyDims));
+
+    if (rule.axis != -1) {
+        size_t outer = static_cast<size_t>(dims.size(0) / dims.size(rule.axis));
+        size_t chunk = static_cast<size_t>(dims[rule.axis] / iterations);
+        data.stride = rule.stride < 0 ? -1 : 1;
+        data.sliceStep = chunk * static_cast<size_t>(dims.size(rule.axis + 1));
+        if (outer != 1) {
+            // the slice which is not contiguous is described by the strides of the whole data
+            MKLDNNDims sliceDims = dims;
+            sliceDims[rule.axis] = chunk;
+            desc = MKLDNNMemoryDesc(sliceDims, memory::f32, MKLDNNMemory::GetPlainFormat(sliceDims));
+            auto& blocking = desc.data.layout_desc.blocking;
+            ptrdiff_t stride = 1;
+            for (int i = dims.ndims() - 1; i >= 0; i--) {
+                blocking.strides[0][i] = stride;
+                stride *= dims[i];
+            }
+            desc.data.format = mkldnn_blocked;
+        }
+    }
+
+    data.view = std::make_shared<MKLDNNMemory>(getEngine());
+    data.view->Create(desc, port->GetData());
+}
+
+void* MKLDNNTensorIteratorNode::getDataPtr(const PortData& data, int iteration, bool isInput) const {
+    switch (data.kind) {
+        case PortData::Slice: {
+            int slice = data.stride < 0 ? iterations - 1 - iteration : iteration;
+            return static_cast<float *>(data.port->GetData()) + slice * data.sliceStep;
+        }
+        case PortData::BackEdge:
+            return backEdges[data.index].buffers[isInput ? iteration % 2 : (iteration + 1) % 2]->GetData();
+        default:
+            return data.port->GetData();
+    }
+}
+
+void MKLDNNTensorIteratorNode::execute(mkldnn::stream strm) {
+    for (auto& edge : backEdges) {
+        if (!edge.buffers[0])
+            continue;
+        if (edge.hasInit) {
+            edge.init.view->GetPrimitivePtr()->set_data_handle(getDataPtr(edge.init, 0, true));
+            strm.submit({*edge.init.reorder});
+        } else {
+            edge.buffers[0]->FillZero();
+        }
+    }
+
+    for (int i = 0; i < iterations; i++) {
+        for (auto& input : bodyInputs) {
+            if (input.edges.empty())
+                continue;
+            void *ptr = getDataPtr(input.data, i, true);
+            if (input.bound) {
+                for (auto& edge : input.edges)
+                    edge->getMemory().GetPrimitivePtr()->set_data_handle(ptr);
+            } else {
+                input.data.view->GetPrimitivePtr()->set_data_handle(ptr);
+                strm.submit({*input.data.reorder});
+            }
+        }
+        for (auto& output : bodyOutputs) {
+            if (output.bound >= 0)
+                output.edge->getMemory().GetPrimitivePtr()->set_data_handle(getDataPtr(output.data[output.bound], i, false));
+        }
+
+        body->Infer();
+
+        for (auto& output : bodyOutputs) {
+            for (size_t k = 0; k < output.data.size(); k++) {
+                auto& data = output.data[k];
+                if (static_cast<int>(k) == output.bound || (data.kind == PortData::Last && i != iterations - 1) ||
+                        (data.kind == PortData::BackEdge && i == iterations - 1))
+                    continue;
+                data.view->GetPrimitivePtr()->set_data_handle(getDataPtr(data, i, false));
+                strm.submit({*data.reorder});
+            }
+        }
+    }
+}
+
+bool MKLDNNTensorIteratorNode::created() const {
+    return getType() == MKLDNNPlugin::TensorIterator;
+}
+
+bool MKLDNNTensorIteratorNode::created(const MKLDNNExtensionManager::Ptr& extMgr) {
+    // the extensions are needed to create the layers of the body
+    this->extMgr = extMgr;
+    return created();
+}
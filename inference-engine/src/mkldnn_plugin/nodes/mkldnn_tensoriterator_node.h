@@ -0,0 +1,107 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <ie_layers.h>
+#include <mkldnn_node.h>
+#include <mkldnn_graph.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Executes the body of a TensorIterator as a loop. The body is compiled once into a separate graph,
+ * the slices of the inputs and outputs are bound to the body memory by pointer where it is possible,
+ * and the back-edges are passed between the iterations in two buffers swapped every iteration.
+ */
+class MKLDNNTensorIteratorNode : public MKLDNNNode {
+public:
+    MKLDNNTensorIteratorNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng);
+    ~MKLDNNTensorIteratorNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+    bool created(const MKLDNNExtensionManager::Ptr& extMgr) override;
+
+    /**
+     * @brief Checks if the node can execute the TensorIterator, otherwise the TensorIterator has to be unrolled
+     */
+    static bool isSupported(const InferenceEngine::TensorIterator& ti);
+
+private:
+    /**
+     * @brief Data passed to a body input or taken from a body output: the data of a port of the node,
+     * a slice of it taken by an iteration or the buffer of a back-edge
+     */
+    struct PortData {
+        enum Kind {
+            Slice,
+            Whole,
+            // the output of the last iteration only
+            Last,
+            BackEdge
+        };
+        Kind kind = Whole;
+        // index of the port of the node, or of the back-edge
+        int index = -1;
+        // memory of the port of the node
+        MKLDNNMemoryPtr port;
+        // -1 if the slices are taken from the end
+        int stride = 1;
+        // elements between the beginnings of the neighbouring slices
+        size_t sliceStep = 0;
+        // memory describing the data, the data handle is moved to the slice of the iteration
+        MKLDNNMemoryPtr view;
+        // copies the data to the body input or from the body output, if the body memory is not bound to the data
+        std::shared_ptr<mkldnn::reorder> reorder;
+    };
+
+    struct BodyInput {
+        // child edges of the input node of the body, they refer to the same memory
+        std::vector<MKLDNNEdgePtr> edges;
+        PortData data;
+        // the edges are bound to the data by pointer
+        bool bound = false;
+    };
+
+    struct BodyOutput {
+        // parent edge of the output node of the body
+        MKLDNNEdgePtr edge;
+        std::vector<PortData> data;
+        // index of the data the edge is bound to by pointer, -1 if all the data are copied
+        int bound = -1;
+    };
+
+    struct BackEdge {
+        // the buffers are swapped every iteration: the iteration i reads the buffer i % 2 and writes the other one
+        MKLDNNMemoryPtr buffers[2];
+        // the first iteration takes the state from the port of the node, it is zero if there is no such port
+        bool hasInit = false;
+        PortData init;
+    };
+
+    void createBody();
+    void initPortData(PortData& data, const MKLDNNMemoryPtr& port, const InferenceEngine::TensorIterator::PortMap& rule,
+                      const MKLDNNMemory& bodyMemory);
+    void* getDataPtr(const PortData& data, int iteration, bool isInput) const;
+
+    static Register<MKLDNNTensorIteratorNode> reg;
+    MKLDNNExtensionManager::Ptr extMgr;
+    MKLDNNGraph::Ptr body;
+    int iterations = 0;
+
+    std::vector<BodyInput> bodyInputs;
+    std::vector<BodyOutput> bodyOutputs;
+    std::vector<BackEdge> backEdges;
+};
+
+}  // namespace MKLDNNPlugin
+
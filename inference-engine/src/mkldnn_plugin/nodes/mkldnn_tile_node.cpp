@@ -79,45 +79,57 @@ void MKLDNNTileNode::createPrimitive() {
         THROW_IE_EXCEPTION << "Preferable primitive descriptor does not set.";
     if (getParentEdges().size() != 1)
         THROW_IE_EXCEPTION << "Incorrect number of input edges for layer " << getName();
+    prepareParams();
 }
 
-void MKLDNNTileNode::execute(mkldnn::stream strm) {
-    auto& srcMemory = getParentEdgeAt(0)->getMemory();
-
-    const float *src_ptr = reinterpret_cast<const float*>(srcMemory.GetData()) +
-            srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
-    float *dst_ptr = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemory().GetData()) +
-            getChildEdgeAt(0)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
+void MKLDNNTileNode::prepareParams() {
+    const int batch = batchToProcess();
+    if (batch == preparedBatch)
+        return;
 
-    int m_inner_dim = 1;
-    int m_outer_dim = 1;
-    memory::dims inDims = srcMemory.GetDims();
+    auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    auto& inDims = getParentEdgeAt(0)->getDims();
+    m_inner_dim = 1;
+    m_outer_dim = 1;
     for (int i=0; i < axis; i++ ) m_outer_dim *= inDims[i];
-    for (int i=axis; i < inDims.size(); i++ ) m_inner_dim *= inDims[i];
+    for (int i=axis; i < inDims.ndims(); i++ ) m_inner_dim *= inDims[i];
     if (axis > 0) {
         m_outer_dim /= inDims[0];
-        m_outer_dim *= batchToProcess();
+        m_outer_dim *= batch;
     } else {
         m_inner_dim /= inDims[0];
-        m_inner_dim *= batchToProcess();
+        m_inner_dim *= batch;
     }
 
-    if (m_inner_dim == 1 && m_outer_dim % 8 == 0 && ((inDims.size() == 4 && srcMemory.GetFormat() == memory::nChw8c) ||
-            (inDims.size() == 5 && srcMemory.GetFormat() == memory::nCdhw8c))) {
+    if (m_inner_dim == 1 && m_outer_dim % 8 == 0 && ((inDims.ndims() == 4 && srcMemory.GetFormat() == memory::nChw8c) ||
+            (inDims.ndims() == 5 && srcMemory.GetFormat() == memory::nCdhw8c))) {
         /*
          * We may enable tile processing directly to appropriate output format (nChw8c)
          */
         m_inner_dim *= 8;
         m_outer_dim /= 8;
     } else if (m_inner_dim == 1 && m_outer_dim % 16 == 0 &&
-            ((inDims.size() == 4 && srcMemory.GetFormat() == memory::nChw16c) ||
-            (inDims.size() == 5 && srcMemory.GetFormat() == memory::nCdhw16c))) {
+            ((inDims.ndims() == 4 && srcMemory.GetFormat() == memory::nChw16c) ||
+            (inDims.ndims() == 5 && srcMemory.GetFormat() == memory::nCdhw16c))) {
         /*
          * We may enable tile processing directly to appropriate output format (nChw16c)
          */
         m_inner_dim *= 16;
         m_outer_dim /= 16;
     }
+    preparedBatch = batch;
+}
+
+void MKLDNNTileNode::execute(mkldnn::stream strm) {
+    auto& srcMemory = getParentEdgeAt(0)->getMemory();
+
+    const float *src_ptr = reinterpret_cast<const float*>(srcMemory.GetData()) +
+            srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    float *dst_ptr = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemory().GetData()) +
+            getChildEdgeAt(0)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    // the dims are recomputed only if the dynamic batch is changed
+    prepareParams();
 
     for (int i = 0; i < m_outer_dim; ++i) {
         for (int t = 0; t < tiles; ++t) {
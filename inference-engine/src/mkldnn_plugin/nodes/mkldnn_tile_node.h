@@ -25,6 +25,12 @@ private:
     static Register<MKLDNNTileNode> reg;
     int axis = 0;
     int tiles = 0;
+
+    // sizes of the copied blocks, they are recomputed only if the batch to process is changed
+    int m_inner_dim = 1;
+    int m_outer_dim = 1;
+    int preparedBatch = -1;
+    void prepareParams();
 };
 
 }  // namespace MKLDNNPlugin
@@ -4,46 +4,104 @@
 
 #pragma once
 
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
+#include <limits>
+#include <details/ie_log_linear_buckets.hpp>
 
 namespace MKLDNNPlugin {
 
+/**
+ * @brief Execution times of a node measured in nanoseconds. Besides the average it keeps the minimum and
+ * a log-linear histogram for the 99th percentile (see InferenceEngine::details::LogLinearBuckets),
+ * the percentile has the relative error of 1/4 at most.
+ */
 class PerfCount {
+    static constexpr unsigned subBucketBits = 2;
+    static constexpr size_t bucketsCount = InferenceEngine::details::LogLinearBuckets::count(subBucketBits);
+
     uint64_t duration;
     uint32_t num;
+    uint64_t minDuration;
+    uint64_t maxDuration;
+    // theoretical cost of the node for the whole batch and the operations done by the measured executions
+    uint64_t flops;
+    int batch;
+    uint64_t work;
+    uint32_t histogram[bucketsCount];
 
     std::chrono::high_resolution_clock::time_point __start;
     std::chrono::high_resolution_clock::time_point __finish;
 
 public:
-    PerfCount(): duration(0), num(0) {}
+    PerfCount(): duration(0), num(0), minDuration(std::numeric_limits<uint64_t>::max()), maxDuration(0),
+                 flops(0), batch(1), work(0), histogram() {}
+
+    // the times are reported in microseconds
+    uint64_t avg() { return (num == 0) ? 0 : duration / num / 1000; }
+
+    uint64_t minimum() { return (num == 0) ? 0 : minDuration / 1000; }
+
+    uint64_t p99() {
+        if (num == 0)
+            return 0;
+        uint64_t rank = (static_cast<uint64_t>(num) * 99 + 99) / 100;
+        return InferenceEngine::details::LogLinearBuckets::valueAtRank(histogram, subBucketBits, rank, maxDuration) / 1000;
+    }
 
-    uint64_t avg() { return (num == 0) ? 0 : duration / num; }
+    uint32_t count() { return num; }
+
+    /**
+     * @brief Sets the number of floating point operations done by the node for the batch, 0 if it is not known
+     */
+    void setFlops(uint64_t batchFlops, int batchSize) {
+        flops = batchFlops;
+        batch = std::max(batchSize, 1);
+    }
+
+    uint64_t getFlops() { return flops; }
+
+    // achieved performance of the measured executions, floating point operations per nanosecond are GFLOP/s
+    double gflops() { return duration == 0 ? 0. : static_cast<double>(work) / duration; }
 
 private:
     void start_itr() {
         __start = std::chrono::high_resolution_clock::now();
     }
 
-    void finish_itr() {
+    void finish_itr(int batchLimit) {
         __finish = std::chrono::high_resolution_clock::now();
 
-        duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(__finish - __start).count();
+        duration += ns;
         num++;
+        minDuration = std::min(minDuration, ns);
+        maxDuration = std::max(maxDuration, ns);
+        histogram[InferenceEngine::details::LogLinearBuckets::index(ns, subBucketBits)]++;
+        // the dynamic batch limits the work of the node
+        work += batchLimit > 0 && batchLimit < batch ? flops / batch * batchLimit : flops;
     }
 
     friend class PerfHelper;
 };
 
+/**
+ * @brief Measures the execution of a node in its scope if the inference is profiled
+ */
 class PerfHelper {
-    PerfCount &counter;
+    PerfCount *counter;
+    int batchLimit;
 
 public:
-    explicit PerfHelper(PerfCount &count): counter(count) { counter.start_itr(); }
+    PerfHelper(PerfCount &count, bool enabled, int batchLimit = -1): counter(enabled ? &count : nullptr),
+                                                                     batchLimit(batchLimit) {
+        if (counter) counter->start_itr();
+    }
 
-    ~PerfHelper() { counter.finish_itr(); }
+    ~PerfHelper() { if (counter) counter->finish_itr(batchLimit); }
 };
 
 }  // namespace MKLDNNPlugin
 
-#define PERF(_counter) PerfHelper __helper##__counter (_counter->PerfCounter());
+#define PERF(_counter, _enabled, _batch) PerfHelper __helper##__counter (_counter->PerfCounter(), _enabled, _batch);
@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include <ie_iextension.h>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Creates the CPU extension implementation of the layer and initializes it with the first supported
+ * config accepted by isTested. The MKLDNN graph passes neither every precision nor forced layouts to the
+ * extension, so such cases run the implementation directly.
+ * @param config The config the implementation is initialized with, its descriptors describe the blobs to pass
+ * @return The initialized implementation or nullptr, in which case a failure is reported
+ */
+inline std::shared_ptr<InferenceEngine::ILayerExecImpl> createExtLayerImpl(
+        InferenceEngine::IExtension& cpuExt, InferenceEngine::CNNLayer& layer, InferenceEngine::LayerConfig& config,
+        const std::function<bool(const InferenceEngine::LayerConfig&)>& isTested = nullptr) {
+    InferenceEngine::ResponseDesc resp;
+    InferenceEngine::ILayerImplFactory* factoryPtr = nullptr;
+    EXPECT_EQ(InferenceEngine::OK, cpuExt.getFactoryFor(factoryPtr, &layer, &resp)) << resp.msg;
+    if (!factoryPtr)
+        return nullptr;
+    std::unique_ptr<InferenceEngine::ILayerImplFactory> factory(factoryPtr);
+
+    std::vector<InferenceEngine::ILayerImpl::Ptr> impls;
+    EXPECT_EQ(InferenceEngine::OK, factory->getImplementations(impls, &resp)) << resp.msg;
+    auto impl = impls.empty() ? nullptr : std::dynamic_pointer_cast<InferenceEngine::ILayerExecImpl>(impls[0]);
+    if (!impl) {
+        ADD_FAILURE() << "No executable implementation of " << layer.type;
+        return nullptr;
+    }
+
+    std::vector<InferenceEngine::LayerConfig> configs;
+    EXPECT_EQ(InferenceEngine::OK, impl->getSupportedConfigurations(configs, &resp)) << resp.msg;
+    auto tested = std::find_if(configs.begin(), configs.end(), [&](const InferenceEngine::LayerConfig& conf) {
+        return !isTested || isTested(conf);
+    });
+    if (tested == configs.end()) {
+        ADD_FAILURE() << "The tested config is not supported by " << layer.type;
+        return nullptr;
+    }
+    config = *tested;
+    if (impl->init(config, &resp) != InferenceEngine::OK) {
+        ADD_FAILURE() << resp.msg;
+        return nullptr;
+    }
+    return impl;
+}
+
+/**
+ * @brief Creates the implementation initialized with the first supported config
+ */
+inline std::shared_ptr<InferenceEngine::ILayerExecImpl> createExtLayerImpl(
+        InferenceEngine::IExtension& cpuExt, InferenceEngine::CNNLayer& layer) {
+    InferenceEngine::LayerConfig config;
+    return createExtLayerImpl(cpuExt, layer, config);
+}
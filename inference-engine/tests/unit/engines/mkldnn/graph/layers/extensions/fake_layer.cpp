@@ -132,6 +132,22 @@ public:
     }
 };
 
+class FakeLayerNSPCImpl: public Cpu::ExtLayerBase {
+public:
+    explicit FakeLayerNSPCImpl(const CNNLayer* layer) {
+        try {
+            addConfig(layer, {{ConfLayout::NSPC, false, 0}}, {{ConfLayout::NSPC, false, 0}});
+        } catch (InferenceEngine::details::InferenceEngineException &ex) {
+            errorMsg = ex.what();
+        }
+    }
+
+    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs,
+                       ResponseDesc *resp) noexcept override {
+        return OK;
+    }
+};
+
 template<typename Ext>
 class FakeRegisterBase {
  public:
@@ -148,6 +164,7 @@ static FakeRegisterBase<__prim> __reg__##__type(#__type)
 
 REG_FAKE_FACTORY_FOR(Cpu::ImplFactory<FakeLayerPLNImpl>, FakeLayerPLN);
 REG_FAKE_FACTORY_FOR(Cpu::ImplFactory<FakeLayerBLKImpl>, FakeLayerBLK);
+REG_FAKE_FACTORY_FOR(Cpu::ImplFactory<FakeLayerNSPCImpl>, FakeLayerNSPC);
 
 
 InferenceEngine::IExtensionPtr make_FakeExtensions() {
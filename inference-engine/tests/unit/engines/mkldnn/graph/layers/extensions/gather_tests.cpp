@@ -3,6 +3,7 @@
 //
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <gmock/gmock-spec-builders.h>
 #include "mkldnn_plugin/mkldnn_graph.h"
 
@@ -12,6 +13,7 @@
 #include <mkldnn_plugin/mkldnn_extension_utils.h>
 #include <extension/ext_list.hpp>
 #include "tests_common.hpp"
+#include "ext_layer_test_utils.hpp"
 
 
 using namespace ::testing;
@@ -317,7 +319,10 @@ INSTANTIATE_TEST_CASE_P(
                 gather_test_params{ "FP32", {1, 1, 12, 256}, {1, 1, 71, 16}, 1, {1, 71, 12, 256}, 1, MKLDNNPlugin::impl_desc_type::unknown },
                 gather_test_params{  "I32", {1, 1, 3, 4}, {1, 2, 5, 6}, 1, {2, 3, 4, 6}, 1, MKLDNNPlugin::impl_desc_type::unknown },
                 gather_test_params{  "I32", {1, 1, 3, 4}, {1, 2, 5, 6}, 2, {2, 5, 3, 4}, 1, MKLDNNPlugin::impl_desc_type::unknown },
-                gather_test_params{  "I32", {12, 4, 9, 8}, {6, 13, 10, 3}, 1, {6, 12, 4, 9, 8, 10, 3}, 1, MKLDNNPlugin::impl_desc_type::unknown }
+                gather_test_params{  "I32", {12, 4, 9, 8}, {6, 13, 10, 3}, 1, {6, 12, 4, 9, 8, 10, 3}, 1, MKLDNNPlugin::impl_desc_type::unknown },
+                // Gathering along the batch supports channels last and blocked layouts
+                gather_test_params{  "I32", {3}, {4, 16, 5, 6}, 0, {3, 16, 5, 6}, 4, MKLDNNPlugin::impl_desc_type::unknown },
+                gather_test_params{ "FP32", {3}, {4, 19, 5, 6}, 0, {3, 19, 5, 6}, 4, MKLDNNPlugin::impl_desc_type::unknown }
             ));
 
 
@@ -688,3 +693,91 @@ INSTANTIATE_TEST_CASE_P(
     ::testing::Values(
         gatherTF_test_params{ { 1, 5, 2, 2 }, in1,{ 1, 3, 2, 2 }, dict, 1,{ 2, 2, 2, 2 }, ref_in1_a0_d322 }));
 
+
+struct gather_layout_test_params {
+    InferenceEngine::SizeVector inDict;
+    std::vector<int32_t> indexes;
+    //  Layout of the dictionary and output in the config under test
+    InferenceEngine::Layout layout;
+    size_t blockSize;
+};
+
+//  The graph keeps its own layouts, so the NSPC and blocked configs are run by the extension directly
+class MKLDNNCPUExtGatherLayoutTests : public TestsCommon, public WithParamInterface<gather_layout_test_params> {
+protected:
+    static bool isTested(const InferenceEngine::TensorDesc& desc, const gather_layout_test_params& p) {
+        if (desc.getLayout() != p.layout)
+            return false;
+        const auto& blockDims = desc.getBlockingDesc().getBlockDims();
+        return p.layout != InferenceEngine::Layout::BLOCKED || blockDims.back() == p.blockSize;
+    }
+
+    virtual void SetUp() {
+        TestsCommon::SetUp();
+        gather_layout_test_params p = ::testing::WithParamInterface<gather_layout_test_params>::GetParam();
+
+        InferenceEngine::SizeVector idxDims = { p.indexes.size() };
+        InferenceEngine::SizeVector outDims = p.inDict;
+        outDims[0] = p.indexes.size();
+        auto dictionary = std::make_shared<InferenceEngine::Data>("dictionary",
+            InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, p.inDict, InferenceEngine::TensorDesc::getLayoutByDims(p.inDict)));
+        auto indexes = std::make_shared<InferenceEngine::Data>("indexes",
+            InferenceEngine::TensorDesc(InferenceEngine::Precision::I32, idxDims, InferenceEngine::Layout::C));
+        auto outData = std::make_shared<InferenceEngine::Data>("output",
+            InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, outDims, InferenceEngine::TensorDesc::getLayoutByDims(outDims)));
+        InferenceEngine::CNNLayer layer({"gather", "Gather", InferenceEngine::Precision::FP32});
+        layer.params["axis"] = "0";
+        layer.insData.push_back(dictionary);
+        layer.insData.push_back(indexes);
+        layer.outData.push_back(outData);
+
+        InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
+        InferenceEngine::LayerConfig config;
+        auto impl = createExtLayerImpl(cpuExt, layer, config, [&](const InferenceEngine::LayerConfig& conf) {
+            return isTested(conf.inConfs[0].desc, p) && isTested(conf.outConfs[0].desc, p);
+        });
+        ASSERT_NE(nullptr, impl);
+
+        //  Blobs of blocked layouts are larger than the logical size because of the channel padding
+        const InferenceEngine::TensorDesc& dictDesc = config.inConfs[0].desc;
+        const InferenceEngine::TensorDesc& outDesc = config.outConfs[0].desc;
+        std::vector<float> dictBuffer(dictDesc.getBlockingDesc().getStrides()[0] * p.inDict[0], -1.f);
+        std::vector<float> outBuffer(outDesc.getBlockingDesc().getStrides()[0] * outDims[0], -1.f);
+        auto src = InferenceEngine::make_shared_blob<float>(dictDesc, dictBuffer.data());
+        auto dst = InferenceEngine::make_shared_blob<float>(outDesc, outBuffer.data());
+        auto idx = InferenceEngine::make_shared_blob<int32_t>(config.inConfs[1].desc);
+        idx->allocate();
+        memcpy(idx->data(), &p.indexes[0], sizeof(int32_t) * p.indexes.size());
+
+        size_t sliceSize = src->size() / p.inDict[0];
+        for (size_t i = 0; i < src->size(); i++)
+            dictBuffer[dictDesc.offset(i)] = static_cast<float>(i);
+
+        std::vector<InferenceEngine::Blob::Ptr> inputs = { src, idx };
+        std::vector<InferenceEngine::Blob::Ptr> outputs = { dst };
+        InferenceEngine::ResponseDesc resp;
+        ASSERT_EQ(InferenceEngine::OK, impl->execute(inputs, outputs, &resp)) << resp.msg;
+
+        //  Logical element i of the output is taken from the same position of the gathered slice
+        for (size_t i = 0; i < dst->size(); i++) {
+            size_t slice = i / sliceSize;
+            float expected = p.indexes[slice] < static_cast<int32_t>(p.inDict[0]) ?
+                             static_cast<float>(p.indexes[slice] * sliceSize + i % sliceSize) : 0.f;
+            ASSERT_EQ(expected, outBuffer[outDesc.offset(i)]) << "at " << i;
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtGatherLayoutTests, TestsGather) {}
+
+INSTANTIATE_TEST_CASE_P(
+    TestsGather, MKLDNNCPUExtGatherLayoutTests,
+    ::testing::Values(
+// Params: inDict, indexes, layout, blockSize
+        gather_layout_test_params{ { 4, 3, 2, 5 }, { 3, 0, 3, 1, 2 }, InferenceEngine::Layout::NHWC, 0 },
+        gather_layout_test_params{ { 3, 4, 2, 2, 3 }, { 2, 0 }, InferenceEngine::Layout::NDHWC, 0 },
+        gather_layout_test_params{ { 4, 3, 2, 5 }, { 3, 0, 3, 1, 2 }, InferenceEngine::Layout::BLOCKED, 8 },
+        gather_layout_test_params{ { 4, 20, 2, 3 }, { 1, 3, 7 }, InferenceEngine::Layout::BLOCKED, 8 },
+        gather_layout_test_params{ { 4, 20, 2, 3 }, { 2, 2, 0 }, InferenceEngine::Layout::BLOCKED, 16 },
+        gather_layout_test_params{ { 2, 5, 2, 2, 3 }, { 1, 0, 1 }, InferenceEngine::Layout::BLOCKED, 16 }
+    ));
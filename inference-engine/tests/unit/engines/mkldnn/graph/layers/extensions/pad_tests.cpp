@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <extension/ext_list.hpp>
+#include <precision_utils.h>
+#include "tests_common.hpp"
+#include "ext_layer_test_utils.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace ::testing;
+
+struct pad_precision_test_params {
+    InferenceEngine::Precision data_precision;
+    InferenceEngine::SizeVector in_shape;
+    std::vector<size_t> pads_begin;
+    std::vector<size_t> pads_end;
+    std::string pad_mode;
+    float pad_value;
+};
+
+//  The MKLDNN graph does not take every precision as an input, so the extension is run directly.
+//  The reference takes the source element of the padded position, clamped to the edge for the 'edge' mode.
+class MKLDNNCPUExtPadPrecisionTests : public TestsCommon, public WithParamInterface<pad_precision_test_params> {
+protected:
+    template <typename data_t>
+    void runTest(const pad_precision_test_params& p, data_t padValue) {
+        InferenceEngine::SizeVector out_shape = p.in_shape;
+        for (size_t i = 0; i < out_shape.size(); i++)
+            out_shape[i] += p.pads_begin[i] + p.pads_end[i];
+        InferenceEngine::TensorDesc dataDesc(p.data_precision, p.in_shape, InferenceEngine::Layout::NCHW);
+        InferenceEngine::TensorDesc outDesc(p.data_precision, out_shape, InferenceEngine::Layout::NCHW);
+
+        InferenceEngine::CNNLayer layer({"output", "Pad", p.data_precision});
+        auto toString = [](const std::vector<size_t>& pads) {
+            std::string str;
+            for (size_t pad : pads)
+                str += (str.empty() ? "" : ",") + std::to_string(pad);
+            return str;
+        };
+        layer.params["pads_begin"] = toString(p.pads_begin);
+        layer.params["pads_end"] = toString(p.pads_end);
+        layer.params["pad_mode"] = p.pad_mode;
+        layer.params["pad_value"] = std::to_string(p.pad_value);
+        auto data = std::make_shared<InferenceEngine::Data>("input", dataDesc);
+        auto outData = std::make_shared<InferenceEngine::Data>("output", outDesc);
+        layer.insData.push_back(data);
+        layer.outData.push_back(outData);
+
+        InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
+        InferenceEngine::LayerConfig config;
+        auto impl = createExtLayerImpl(cpuExt, layer, config);
+        ASSERT_NE(nullptr, impl);
+
+        //  The blobs are described as the config asks, the values are compared by their logical positions
+        const InferenceEngine::TensorDesc& srcDesc = config.inConfs[0].desc;
+        const InferenceEngine::TensorDesc& dstDesc = config.outConfs[0].desc;
+        auto src = InferenceEngine::make_shared_blob<data_t>(srcDesc);
+        src->allocate();
+        for (size_t i = 0; i < src->size(); i++)
+            src->data()[srcDesc.offset(i)] = static_cast<data_t>(i * 7 + 3);
+        auto dst = InferenceEngine::make_shared_blob<data_t>(dstDesc);
+        dst->allocate();
+        std::vector<InferenceEngine::Blob::Ptr> inputs = { src };
+        std::vector<InferenceEngine::Blob::Ptr> outputs = { dst };
+        InferenceEngine::ResponseDesc resp;
+        ASSERT_EQ(InferenceEngine::OK, impl->execute(inputs, outputs, &resp)) << resp.msg;
+
+        for (size_t i = 0; i < dst->size(); i++) {
+            size_t srcIdx = 0, rest = i;
+            bool isPadding = false;
+            for (int d = static_cast<int>(out_shape.size()) - 1, stride = 1; d >= 0; d--) {
+                int coord = static_cast<int>(rest % out_shape[d]) - static_cast<int>(p.pads_begin[d]);
+                rest /= out_shape[d];
+                if (coord < 0 || coord >= static_cast<int>(p.in_shape[d])) {
+                    isPadding = true;
+                    coord = std::min(std::max(coord, 0), static_cast<int>(p.in_shape[d]) - 1);
+                }
+                srcIdx += coord * stride;
+                stride *= static_cast<int>(p.in_shape[d]);
+            }
+            data_t expected = isPadding && p.pad_mode == "constant" ? padValue : src->data()[srcDesc.offset(srcIdx)];
+            ASSERT_EQ(expected, dst->data()[dstDesc.offset(i)]) << "at " << i;
+        }
+    }
+
+    virtual void SetUp() {
+        TestsCommon::SetUp();
+        pad_precision_test_params p = ::testing::WithParamInterface<pad_precision_test_params>::GetParam();
+        switch (p.data_precision) {
+            case InferenceEngine::Precision::FP32: runTest<float>(p, p.pad_value); break;
+            //  FP16 blobs keep the bits in int16_t
+            case InferenceEngine::Precision::FP16:
+                runTest<int16_t>(p, InferenceEngine::PrecisionUtils::f32tof16(p.pad_value));
+                break;
+            case InferenceEngine::Precision::U8: runTest<uint8_t>(p, static_cast<uint8_t>(p.pad_value)); break;
+            case InferenceEngine::Precision::I8: runTest<int8_t>(p, static_cast<int8_t>(p.pad_value)); break;
+            default: FAIL() << "Unexpected precision " << p.data_precision.name();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtPadPrecisionTests, TestsPad) {}
+INSTANTIATE_TEST_CASE_P(
+    TestsPad, MKLDNNCPUExtPadPrecisionTests,
+            ::testing::Values(
+// Params: data_precision, in_shape, pads_begin, pads_end, pad_mode, pad_value
+                pad_precision_test_params{ InferenceEngine::Precision::FP32, { 1, 3, 4, 5 }, { 0, 1, 2, 1 }, { 1, 0, 1, 2 }, "constant", 2.5f },
+                pad_precision_test_params{ InferenceEngine::Precision::FP16, { 1, 3, 4, 5 }, { 0, 1, 2, 1 }, { 1, 0, 1, 2 }, "constant", 2.5f },
+                pad_precision_test_params{ InferenceEngine::Precision::U8, { 1, 3, 4, 5 }, { 0, 1, 2, 1 }, { 1, 0, 1, 2 }, "constant", 9.f },
+                pad_precision_test_params{ InferenceEngine::Precision::U8, { 2, 3, 4, 5 }, { 1, 2, 0, 1 }, { 0, 1, 2, 3 }, "edge", 0.f },
+                pad_precision_test_params{ InferenceEngine::Precision::I8, { 1, 4, 3, 3 }, { 0, 2, 1, 1 }, { 0, 1, 1, 0 }, "constant", -4.f }
+            ));
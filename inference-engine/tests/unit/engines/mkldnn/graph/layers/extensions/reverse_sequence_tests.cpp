@@ -12,6 +12,7 @@
 #include <mkldnn_plugin/mkldnn_extension_utils.h>
 #include <extension/ext_list.hpp>
 #include "tests_common.hpp"
+#include "ext_layer_test_utils.hpp"
 
 
 using namespace ::testing;
@@ -271,3 +272,100 @@ INSTANTIATE_TEST_CASE_P(
                 reverse_sequence_test_params{"FP32", { 3, 3, 3 },{ 1, 2, 3 },  1,-3, test7 },
                 reverse_sequence_test_params{"FP32", { 3, 3, 3 },{ 1, 2, 3 },  1, 2, test8 }
             ));
+
+struct reverse_sequence_precision_test_params {
+    InferenceEngine::Precision data_precision;
+    InferenceEngine::SizeVector in_out_shape;
+    std::vector<int32_t> seq_lengths;
+    int                  seq_axis;
+    int                  batch_axis;
+};
+
+//  The MKLDNN graph does not take every precision as an input, so the extension is run directly
+class MKLDNNCPUExtReverseSequencePrecisionTests : public TestsCommon,
+                                                   public WithParamInterface<reverse_sequence_precision_test_params> {
+protected:
+    template <typename data_t>
+    void runTest(const reverse_sequence_precision_test_params& p) {
+        InferenceEngine::TensorDesc dataDesc(p.data_precision, p.in_out_shape,
+                                             InferenceEngine::TensorDesc::getLayoutByDims(p.in_out_shape));
+        InferenceEngine::SizeVector seq_lengths_dim(1, p.seq_lengths.size());
+        InferenceEngine::TensorDesc lengthsDesc(InferenceEngine::Precision::I32, seq_lengths_dim, InferenceEngine::Layout::C);
+
+        auto data = std::make_shared<InferenceEngine::Data>("input", dataDesc);
+        auto lengths = std::make_shared<InferenceEngine::Data>("seq_lengths", lengthsDesc);
+        auto outData = std::make_shared<InferenceEngine::Data>("output", dataDesc);
+        InferenceEngine::CNNLayer layer({"output", "ReverseSequence", p.data_precision});
+        layer.params["seq_axis"] = std::to_string(p.seq_axis);
+        layer.params["batch_axis"] = std::to_string(p.batch_axis);
+        layer.insData.push_back(data);
+        layer.insData.push_back(lengths);
+        layer.outData.push_back(outData);
+
+        InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
+        InferenceEngine::LayerConfig config;
+        auto impl = createExtLayerImpl(cpuExt, layer, config);
+        ASSERT_NE(nullptr, impl);
+
+        // The layer only moves elements, so the reference permutation is taken from the FP32 reference run on indices
+        InferenceEngine::TBlob<float> src_ref(dataDesc.getPrecision() == InferenceEngine::Precision::FP32 ? dataDesc :
+            InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, p.in_out_shape, dataDesc.getLayout()));
+        src_ref.allocate();
+        for (size_t i = 0; i < src_ref.size(); i++)
+            src_ref.data()[i] = static_cast<float>(i);
+        InferenceEngine::TBlob<float> dst_ref(src_ref.getTensorDesc());
+        dst_ref.allocate();
+        InferenceEngine::TBlob<int32_t> seq_lengths(lengthsDesc);
+        seq_lengths.allocate();
+        memcpy(seq_lengths.data(), &p.seq_lengths[0], sizeof(int32_t) * p.seq_lengths.size());
+        ref_reverse_sequence(src_ref, seq_lengths, dst_ref, p.seq_axis, p.batch_axis);
+
+        //  The blobs are described as the config asks, the values are compared by their logical positions
+        const InferenceEngine::TensorDesc& srcDesc = config.inConfs[0].desc;
+        const InferenceEngine::TensorDesc& dstDesc = config.outConfs[0].desc;
+        auto src = InferenceEngine::make_shared_blob<data_t>(srcDesc);
+        src->allocate();
+        for (size_t i = 0; i < src->size(); i++)
+            src->data()[srcDesc.offset(i)] = static_cast<data_t>(i * 7 + 3);
+        auto dst = InferenceEngine::make_shared_blob<data_t>(dstDesc);
+        dst->allocate();
+        auto lengthsBlob = InferenceEngine::make_shared_blob<int32_t>(lengthsDesc);
+        lengthsBlob->allocate();
+        memcpy(lengthsBlob->data(), &p.seq_lengths[0], sizeof(int32_t) * p.seq_lengths.size());
+
+        std::vector<InferenceEngine::Blob::Ptr> inputs = { src, lengthsBlob };
+        std::vector<InferenceEngine::Blob::Ptr> outputs = { dst };
+        InferenceEngine::ResponseDesc resp;
+        ASSERT_EQ(InferenceEngine::OK, impl->execute(inputs, outputs, &resp)) << resp.msg;
+        for (size_t i = 0; i < dst->size(); i++)
+            ASSERT_EQ(src->data()[srcDesc.offset(static_cast<size_t>(dst_ref.data()[i]))], dst->data()[dstDesc.offset(i)])
+                << "at " << i;
+    }
+
+    virtual void SetUp() {
+        TestsCommon::SetUp();
+        reverse_sequence_precision_test_params p = ::testing::WithParamInterface<reverse_sequence_precision_test_params>::GetParam();
+        switch (p.data_precision) {
+            case InferenceEngine::Precision::FP32: runTest<float>(p); break;
+            case InferenceEngine::Precision::I32: runTest<int32_t>(p); break;
+            //  FP16 blobs keep the bits in int16_t
+            case InferenceEngine::Precision::FP16: runTest<int16_t>(p); break;
+            case InferenceEngine::Precision::U8: runTest<uint8_t>(p); break;
+            default: FAIL() << "Unexpected precision " << p.data_precision.name();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtReverseSequencePrecisionTests, TestsReverseSequence) {}
+INSTANTIATE_TEST_CASE_P(
+    TestsReverseSequence, MKLDNNCPUExtReverseSequencePrecisionTests,
+            ::testing::Values(
+// Params: data_precision, in_out_shape, seq_lengths, seq_axis, batch_axis
+                reverse_sequence_precision_test_params{ InferenceEngine::Precision::I32, { 3, 3, 3 },{ 2, 2, 2 }, 0, 0 },
+                reverse_sequence_precision_test_params{ InferenceEngine::Precision::I32, { 3, 3, 3 },{ 1, 2, 3 }, 1, 2 },
+                reverse_sequence_precision_test_params{ InferenceEngine::Precision::U8, { 3, 3, 3 },{ 2, 2, 2 }, 2, 1 },
+                reverse_sequence_precision_test_params{ InferenceEngine::Precision::U8, { 2, 3 },{ 3, 2 }, 1, 0 },
+                reverse_sequence_precision_test_params{ InferenceEngine::Precision::U8, { 2, 3, 4, 5 },{ 1, 3, 2, 4 }, 3, 2 },
+                reverse_sequence_precision_test_params{ InferenceEngine::Precision::FP16, { 3, 3, 3 },{ 1, 2, 3 }, 1, 0 },
+                reverse_sequence_precision_test_params{ InferenceEngine::Precision::FP16, { 2, 3, 4, 5 },{ 1, 3, 2, 4 }, 3, 2 }
+            ));
@@ -0,0 +1,270 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+#include "ext_layer_test_utils.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+struct roifeatureextractor_test_params {
+    size_t channels;
+    // Feature maps of the levels are image / pyramid_scale in size
+    size_t image;
+    std::vector<int> pyramid_scales;
+    int output_size;
+    int sampling_ratio;
+    // x0, y0, x1, y1 of every ROI and the level it is expected to be pooled from,
+    // the level equal to the number of levels means the ROI has no area and gives zeros
+    std::vector<float> rois;
+    std::vector<int> levels;
+    // 1 is the planar layout, 8 and 16 are nChw8c and nChw16c
+    size_t blk;
+};
+
+static float ref_bilinear(const float *data, int H, int W, float y, float x) {
+    if (y < -1.0f || y > H || x < -1.0f || x > W)
+        return 0.f;
+    y = std::max(y, 0.f);
+    x = std::max(x, 0.f);
+    int y_low = static_cast<int>(y), x_low = static_cast<int>(x);
+    int y_high = y_low + 1, x_high = x_low + 1;
+    if (y_low >= H - 1) {
+        y_high = y_low = H - 1;
+        y = static_cast<float>(y_low);
+    }
+    if (x_low >= W - 1) {
+        x_high = x_low = W - 1;
+        x = static_cast<float>(x_low);
+    }
+    float ly = y - y_low, lx = x - x_low;
+    float hy = 1.f - ly, hx = 1.f - lx;
+    return hy * hx * data[y_low * W + x_low] + hy * lx * data[y_low * W + x_high] +
+           ly * hx * data[y_high * W + x_low] + ly * lx * data[y_high * W + x_high];
+}
+
+// ROIAlign of one ROI from a planar feature map, computed channel by channel
+static void ref_roi_align(const float *features, int C, int H, int W, float scale, int pooled, int sampling_ratio,
+                          const float *roi, float *dst) {
+    float x0 = roi[0] * scale, y0 = roi[1] * scale;
+    float roi_w = std::max(roi[2] * scale - x0, 1.f);
+    float roi_h = std::max(roi[3] * scale - y0, 1.f);
+    float bin_w = roi_w / pooled, bin_h = roi_h / pooled;
+    int grid_h = sampling_ratio > 0 ? sampling_ratio : static_cast<int>(std::ceil(roi_h / pooled));
+    int grid_w = sampling_ratio > 0 ? sampling_ratio : static_cast<int>(std::ceil(roi_w / pooled));
+
+    for (int c = 0; c < C; c++) {
+        for (int ph = 0; ph < pooled; ph++) {
+            for (int pw = 0; pw < pooled; pw++) {
+                float sum = 0.f;
+                for (int iy = 0; iy < grid_h; iy++) {
+                    float y = y0 + ph * bin_h + (iy + .5f) * bin_h / grid_h;
+                    for (int ix = 0; ix < grid_w; ix++) {
+                        float x = x0 + pw * bin_w + (ix + .5f) * bin_w / grid_w;
+                        sum += ref_bilinear(features + c * H * W, H, W, y, x);
+                    }
+                }
+                dst[(c * pooled + ph) * pooled + pw] = sum / (grid_h * grid_w);
+            }
+        }
+    }
+}
+
+class MKLDNNCPUExtROIFeatureExtractorTests : public TestsCommon,
+                                              public WithParamInterface<roifeatureextractor_test_params> {
+protected:
+    virtual void SetUp() {
+        TestsCommon::SetUp();
+        roifeatureextractor_test_params p = ::testing::WithParamInterface<roifeatureextractor_test_params>::GetParam();
+        const size_t levels = p.pyramid_scales.size();
+        const size_t rois = p.levels.size();
+        const size_t C = p.channels;
+        const size_t pooled = static_cast<size_t>(p.output_size);
+
+        std::string scales;
+        for (auto scale : p.pyramid_scales)
+            scales += (scales.empty() ? "" : ",") + std::to_string(scale);
+        CNNLayer layer({"roi_features", "ExperimentalDetectronROIFeatureExtractor", Precision::FP32});
+        layer.params["output_size"] = std::to_string(p.output_size);
+        layer.params["pyramid_scales"] = scales;
+        layer.params["sampling_ratio"] = std::to_string(p.sampling_ratio);
+
+        // The layer refers to its input data weakly, so the data is kept here
+        std::vector<DataPtr> inData;
+        TensorDesc roisDesc(Precision::FP32, {rois, 4}, NC);
+        inData.push_back(std::make_shared<Data>("rois", roisDesc));
+        std::vector<TensorDesc> planarDescs;
+        for (size_t l = 0; l < levels; l++) {
+            size_t side = p.image / p.pyramid_scales[l];
+            planarDescs.emplace_back(Precision::FP32, SizeVector{1, C, side, side}, NCHW);
+            inData.push_back(std::make_shared<Data>("features" + std::to_string(l), planarDescs.back()));
+        }
+        layer.insData.assign(inData.begin(), inData.end());
+        TensorDesc dstDesc(Precision::FP32, {rois, C, pooled, pooled}, NCHW);
+        layer.outData.push_back(std::make_shared<Data>("roi_features", dstDesc));
+        layer.outData.push_back(std::make_shared<Data>("rois_out", roisDesc));
+
+        InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
+        auto impl = createExtLayerImpl(cpuExt, layer);
+        ASSERT_NE(nullptr, impl);
+
+        auto roisBlob = make_shared_blob<float>(roisDesc);
+        roisBlob->allocate();
+        std::copy(p.rois.begin(), p.rois.end(), roisBlob->buffer().as<float *>());
+        std::vector<Blob::Ptr> inputs = { roisBlob };
+        std::vector<TBlob<float>::Ptr> planarFeatures;
+        std::vector<std::vector<float>> blockedData;
+        for (size_t l = 0; l < levels; l++) {
+            auto planar = make_shared_blob<float>(planarDescs[l]);
+            planar->allocate();
+            float *data = planar->buffer().as<float *>();
+            for (size_t i = 0; i < planar->size(); i++)
+                data[i] = std::sin(0.37f * i + l);
+            planarFeatures.push_back(planar);
+
+            if (p.blk == 1) {
+                inputs.push_back(planar);
+                continue;
+            }
+            // The channels padded up to the block are filled with garbage, it must not get to the output
+            size_t side = planarDescs[l].getDims()[2];
+            size_t CB = (C + p.blk - 1) / p.blk;
+            TensorDesc blockedDesc(Precision::FP32, planarDescs[l].getDims(),
+                                   BlockingDesc({1, CB, side, side, p.blk}, {0, 1, 2, 3, 1}));
+            // The blob is allocated by its dims, so the padded channels are kept in a buffer of the test
+            blockedData.emplace_back(CB * side * side * p.blk, 1e6f);
+            float *blk_data = blockedData.back().data();
+            auto blocked = make_shared_blob<float>(blockedDesc, blk_data);
+            for (size_t c = 0; c < C; c++)
+                for (size_t hw = 0; hw < side * side; hw++)
+                    blk_data[((c / p.blk) * side * side + hw) * p.blk + c % p.blk] = data[c * side * side + hw];
+            inputs.push_back(blocked);
+        }
+
+        auto dst = make_shared_blob<float>(dstDesc);
+        dst->allocate();
+        std::fill_n(dst->buffer().as<float *>(), dst->size(), -1.f);
+        auto roisOut = make_shared_blob<float>(roisDesc);
+        roisOut->allocate();
+        std::vector<Blob::Ptr> outputs = { dst, roisOut };
+
+        ResponseDesc resp;
+        ASSERT_EQ(OK, impl->execute(inputs, outputs, &resp)) << resp.msg;
+
+        // Every ROI is pooled from the expected level and stored in its own place of the output
+        TBlob<float> dst_ref(dstDesc);
+        dst_ref.allocate();
+        for (size_t n = 0; n < rois; n++) {
+            float *roi_ref = dst_ref.buffer().as<float *>() + n * C * pooled * pooled;
+            size_t level = static_cast<size_t>(p.levels[n]);
+            if (level >= levels) {
+                std::fill_n(roi_ref, C * pooled * pooled, 0.f);
+                continue;
+            }
+            int side = static_cast<int>(planarDescs[level].getDims()[2]);
+            ref_roi_align(planarFeatures[level]->buffer().as<const float *>(), static_cast<int>(C), side, side, 1.f / p.pyramid_scales[level],
+                          p.output_size, p.sampling_ratio, &p.rois[4 * n], roi_ref);
+        }
+        compare(*dst, dst_ref, 0.00001f);
+        for (size_t i = 0; i < p.rois.size(); i++)
+            ASSERT_EQ(p.rois[i], roisOut->data()[i]);
+    }
+};
+
+TEST_P(MKLDNNCPUExtROIFeatureExtractorTests, TestsROIFeatureExtractor) {}
+
+// The level of a ROI is floor(2 + log2(sqrt(area) / 224)) clamped by the number of levels:
+// a 56x56 ROI is pooled from level 0, 112x112 from level 1, 224x224 from level 2 and 448x448 from level 3
+static const std::vector<float> multilevel_rois = {
+    -100.f, -100.f, 348.f, 348.f,
+       0.f,    0.f,  56.f,  56.f,
+      16.f,   16.f, 240.f, 240.f,
+      10.f,   20.f, 122.f, 132.f,
+       5.f,    5.f,  35.f, 205.f,
+       2.f,    3.f,   7.f,   9.f,
+      60.f,   40.f, 200.f, 220.f
+};
+static const std::vector<int> multilevel_levels = {3, 0, 2, 1, 0, 0, 1};
+
+// ROIs without area are not assigned to any level, their features are zeros
+static const std::vector<float> zero_area_rois = {
+     10.f, 10.f,  10.f, 50.f,
+      0.f,  0.f,  56.f, 56.f,
+     30.f, 30.f, 130.f, 30.f,
+     80.f, 20.f,  40.f, 90.f,
+     16.f, 16.f, 240.f, 240.f
+};
+static const std::vector<int> zero_area_levels = {4, 0, 4, 4, 2};
+
+INSTANTIATE_TEST_CASE_P(
+        TestsROIFeatureExtractor, MKLDNNCPUExtROIFeatureExtractorTests,
+        ::testing::Values(
+// Params: channels, image, pyramid_scales, output_size, sampling_ratio, rois, levels, blk
+                roifeatureextractor_test_params{ 16, 256, {4, 8, 16, 32}, 7, 2, multilevel_rois, multilevel_levels, 1 },
+                roifeatureextractor_test_params{ 16, 256, {4, 8, 16, 32}, 7, 2, multilevel_rois, multilevel_levels, 8 },
+                roifeatureextractor_test_params{ 16, 256, {4, 8, 16, 32}, 7, 2, multilevel_rois, multilevel_levels, 16 },
+                roifeatureextractor_test_params{ 19, 256, {4, 8, 16, 32}, 4, 0, multilevel_rois, multilevel_levels, 1 },
+                roifeatureextractor_test_params{ 19, 256, {4, 8, 16, 32}, 4, 0, multilevel_rois, multilevel_levels, 8 },
+                roifeatureextractor_test_params{ 19, 256, {4, 8, 16, 32}, 4, 0, multilevel_rois, multilevel_levels, 16 },
+                roifeatureextractor_test_params{ 8, 256, {4, 8, 16, 32}, 7, 2, zero_area_rois, zero_area_levels, 1 },
+                roifeatureextractor_test_params{ 8, 256, {4, 8, 16, 32}, 7, 2, zero_area_rois, zero_area_levels, 8 },
+                roifeatureextractor_test_params{ 8, 256, {4, 8, 16, 32}, 7, 2, zero_area_rois, zero_area_levels, 16 }
+        ));
+
+class MKLDNNCPUExtTopKROIsTests : public TestsCommon {};
+
+TEST_F(MKLDNNCPUExtTopKROIsTests, TestsTopKROIsBreaksTiesByIndex) {
+    const std::vector<float> probs = {0.5f, 0.9f, 0.5f, 0.9f, 0.1f, 0.5f};
+    const size_t rois = probs.size();
+    const size_t max_rois = 4;
+
+    TensorDesc roisDesc(Precision::FP32, {rois, 4}, NC);
+    TensorDesc probsDesc(Precision::FP32, {rois}, C);
+    TensorDesc dstDesc(Precision::FP32, {max_rois, 4}, NC);
+    CNNLayer layer({"top_rois", "ExperimentalDetectronTopKROIs", Precision::FP32});
+    layer.params["max_rois"] = std::to_string(max_rois);
+    auto roisData = std::make_shared<Data>("rois", roisDesc);
+    auto probsData = std::make_shared<Data>("probs", probsDesc);
+    layer.insData.push_back(roisData);
+    layer.insData.push_back(probsData);
+    layer.outData.push_back(std::make_shared<Data>("top_rois", dstDesc));
+
+    InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
+    auto impl = createExtLayerImpl(cpuExt, layer);
+    ASSERT_NE(nullptr, impl);
+
+    auto roisBlob = make_shared_blob<float>(roisDesc);
+    roisBlob->allocate();
+    for (size_t i = 0; i < roisBlob->size(); i++)
+        roisBlob->data()[i] = static_cast<float>(i);
+    auto probsBlob = make_shared_blob<float>(probsDesc);
+    probsBlob->allocate();
+    std::copy(probs.begin(), probs.end(), probsBlob->buffer().as<float *>());
+    auto dst = make_shared_blob<float>(dstDesc);
+    dst->allocate();
+
+    std::vector<Blob::Ptr> inputs = { roisBlob, probsBlob };
+    std::vector<Blob::Ptr> outputs = { dst };
+    ResponseDesc resp;
+    ASSERT_EQ(OK, impl->execute(inputs, outputs, &resp)) << resp.msg;
+
+    // ROIs of the same probability keep the order of their indices
+    const std::vector<size_t> expected = {1, 3, 0, 2};
+    for (size_t i = 0; i < max_rois; i++)
+        for (size_t j = 0; j < 4; j++)
+            ASSERT_EQ(roisBlob->data()[expected[i] * 4 + j], dst->data()[i * 4 + j]) << "at " << i;
+}
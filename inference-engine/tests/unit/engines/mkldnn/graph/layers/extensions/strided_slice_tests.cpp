@@ -12,6 +12,7 @@
 #include <mkldnn_plugin/mkldnn_extension_utils.h>
 #include <extension/ext_list.hpp>
 #include "tests_common.hpp"
+#include "ext_layer_test_utils.hpp"
 
 
 using namespace ::testing;
@@ -487,3 +488,100 @@ INSTANTIATE_TEST_CASE_P(
 /* 20 */        strided_slice_test_params{ { 1, 2, 2, 2 }, 4,{ 0,1,0,0 },{ 1,2,2,2 },{},{ 0,1,0,0 },{ 0,1,0,0 },{},{},{ 0,1,0,0 },{ 1,2,2 }, test20 },
                 strided_slice_test_params{ { 1, 2, 3 }, 3,{ 0, 0, 1 },{ 2, 2, 2 },{},{},{},{ 0, 1 },{ 1 },{ 0, 0, 1 },{ 1, 1, 2 }, test17 }
             ));
+
+struct strided_slice_precision_test_params {
+    InferenceEngine::Precision data_precision;
+    InferenceEngine::SizeVector in_shape;
+    std::vector<int32_t> begin;
+    std::vector<int32_t> end;
+    std::vector<int32_t> stride;
+    InferenceEngine::SizeVector out_shape;
+};
+
+//  The MKLDNN graph does not take every precision as an input, so the extension is run directly.
+//  The slices are 4D without masks, so the reference takes element begin + i * stride along every axis.
+class MKLDNNCPUExtStridedSlicePrecisionTests : public TestsCommon,
+                                                public WithParamInterface<strided_slice_precision_test_params> {
+protected:
+    template <typename data_t>
+    void runTest(const strided_slice_precision_test_params& p) {
+        InferenceEngine::TensorDesc dataDesc(p.data_precision, p.in_shape, InferenceEngine::Layout::NCHW);
+        InferenceEngine::TensorDesc boundsDesc(InferenceEngine::Precision::I32, { p.begin.size() }, InferenceEngine::Layout::C);
+        InferenceEngine::TensorDesc outDesc(p.data_precision, p.out_shape, InferenceEngine::Layout::NCHW);
+
+        //  The layer keeps weak pointers to its inputs
+        std::vector<InferenceEngine::DataPtr> inData = {
+            std::make_shared<InferenceEngine::Data>("input", dataDesc),
+            std::make_shared<InferenceEngine::Data>("begin", boundsDesc),
+            std::make_shared<InferenceEngine::Data>("end", boundsDesc),
+            std::make_shared<InferenceEngine::Data>("stride", boundsDesc)
+        };
+        InferenceEngine::CNNLayer layer({"output", "StridedSlice", p.data_precision});
+        layer.insData.assign(inData.begin(), inData.end());
+        layer.outData.push_back(std::make_shared<InferenceEngine::Data>("output", outDesc));
+
+        InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
+        InferenceEngine::LayerConfig config;
+        auto impl = createExtLayerImpl(cpuExt, layer, config);
+        ASSERT_NE(nullptr, impl);
+
+        //  The blobs are described as the config asks, the values are compared by their logical positions
+        const InferenceEngine::TensorDesc& srcDesc = config.inConfs[0].desc;
+        const InferenceEngine::TensorDesc& dstDesc = config.outConfs[0].desc;
+        auto src = InferenceEngine::make_shared_blob<data_t>(srcDesc);
+        src->allocate();
+        for (size_t i = 0; i < src->size(); i++)
+            src->data()[srcDesc.offset(i)] = static_cast<data_t>(i * 7 + 3);
+        auto dst = InferenceEngine::make_shared_blob<data_t>(dstDesc);
+        dst->allocate();
+        std::vector<InferenceEngine::Blob::Ptr> inputs = { src };
+        for (const auto* bounds : { &p.begin, &p.end, &p.stride }) {
+            auto blob = InferenceEngine::make_shared_blob<int32_t>(boundsDesc);
+            blob->allocate();
+            memcpy(blob->data(), bounds->data(), sizeof(int32_t) * bounds->size());
+            inputs.push_back(blob);
+        }
+        std::vector<InferenceEngine::Blob::Ptr> outputs = { dst };
+        InferenceEngine::ResponseDesc resp;
+        ASSERT_EQ(InferenceEngine::OK, impl->execute(inputs, outputs, &resp)) << resp.msg;
+
+        const InferenceEngine::SizeVector& in = p.in_shape;
+        const InferenceEngine::SizeVector& out = p.out_shape;
+        for (size_t n = 0; n < out[0]; n++)
+            for (size_t c = 0; c < out[1]; c++)
+                for (size_t h = 0; h < out[2]; h++)
+                    for (size_t w = 0; w < out[3]; w++) {
+                        size_t srcIdx = (((p.begin[0] + n * p.stride[0]) * in[1] + p.begin[1] + c * p.stride[1]) * in[2] +
+                                         p.begin[2] + h * p.stride[2]) * in[3] + p.begin[3] + w * p.stride[3];
+                        size_t dstIdx = ((n * out[1] + c) * out[2] + h) * out[3] + w;
+                        ASSERT_EQ(src->data()[srcDesc.offset(srcIdx)], dst->data()[dstDesc.offset(dstIdx)])
+                            << "at " << n << "," << c << "," << h << "," << w;
+                    }
+    }
+
+    virtual void SetUp() {
+        TestsCommon::SetUp();
+        strided_slice_precision_test_params p = ::testing::WithParamInterface<strided_slice_precision_test_params>::GetParam();
+        switch (p.data_precision) {
+            case InferenceEngine::Precision::FP32: runTest<float>(p); break;
+            case InferenceEngine::Precision::U8: runTest<uint8_t>(p); break;
+            case InferenceEngine::Precision::I8: runTest<int8_t>(p); break;
+            default: FAIL() << "Unexpected precision " << p.data_precision.name();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtStridedSlicePrecisionTests, TestsStridedSlice) {}
+INSTANTIATE_TEST_CASE_P(
+    TestsStridedSlice, MKLDNNCPUExtStridedSlicePrecisionTests,
+            ::testing::Values(
+// Params: data_precision, in_shape, begin, end, stride, out_shape
+                strided_slice_precision_test_params{ InferenceEngine::Precision::FP32, { 2, 3, 4, 5 },
+                                                     { 0, 1, 1, 0 }, { 2, 3, 4, 5 }, { 1, 1, 2, 2 }, { 2, 2, 2, 3 } },
+                strided_slice_precision_test_params{ InferenceEngine::Precision::U8, { 2, 3, 4, 5 },
+                                                     { 0, 1, 1, 0 }, { 2, 3, 4, 5 }, { 1, 1, 2, 2 }, { 2, 2, 2, 3 } },
+                strided_slice_precision_test_params{ InferenceEngine::Precision::U8, { 2, 3, 4, 5 },
+                                                     { 1, 0, 1, 1 }, { 2, 3, 3, 4 }, { 1, 1, 1, 1 }, { 1, 3, 2, 3 } },
+                strided_slice_precision_test_params{ InferenceEngine::Precision::I8, { 1, 4, 3, 3 },
+                                                     { 0, 0, 0, 0 }, { 1, 4, 3, 3 }, { 1, 2, 1, 2 }, { 1, 2, 3, 2 } }
+            ));
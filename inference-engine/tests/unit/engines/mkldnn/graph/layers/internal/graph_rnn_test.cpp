@@ -0,0 +1,374 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <inference_engine/cnn_network_impl.hpp>
+#include "tests_common.hpp"
+
+#include <cmath>
+#include <tuple>
+
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+
+struct lstm_int8_test_params {
+    // the length of the sequence for TensorIterator, its body is executed with batch 1
+    size_t batch;
+    size_t in_size;
+    size_t hidden_size;
+
+    // maximal absolute difference of the int8 outputs from the fp32 ones
+    float threshold;
+
+    // how the cell gets its input data
+    enum {
+        // the graph copies the data to its own input memory
+        Graph,
+        // the memory of the input is replaced by the blob set to the infer request
+        InferRequest,
+        // the cell is the body of TensorIterator, its input is bound to a slice of the sequence on every iteration
+        TensorIterator
+    } mode;
+};
+
+// Compares LSTMCell executed with u8 data and s8 weights (the layer has the rnn-data-qparams blob
+// added by the int8 normalizer) with the same layer executed in fp32.
+class MKLDNNGraphLSTMCellInt8Tests: public TestsCommon,
+                                    public WithParamInterface<lstm_int8_test_params> {
+    std::string model_t = R"V0G0N(
+<net name="LSTMCell_Only" version="5" precision="FP32" batch="1">
+    <layers>
+        <layer name="in_data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_N_</dim>
+                    <dim>_DC_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="in_h" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>_N_</dim>
+                    <dim>_SC_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="in_c" type="Input" precision="FP32" id="2">
+            <output>
+                <port id="0">
+                    <dim>_N_</dim>
+                    <dim>_SC_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="lstm" type="LSTMCell" precision="FP32" id="3">
+            <data hidden_size="_SC_"/>
+            <input>
+                <port id="0">
+                    <dim>_N_</dim>
+                    <dim>_DC_</dim>
+                </port>
+                <port id="1">
+                    <dim>_N_</dim>
+                    <dim>_SC_</dim>
+                </port>
+                <port id="2">
+                    <dim>_N_</dim>
+                    <dim>_SC_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>_N_</dim>
+                    <dim>_SC_</dim>
+                </port>
+                <port id="4">
+                    <dim>_N_</dim>
+                    <dim>_SC_</dim>
+                </port>
+            </output>
+            <blobs>
+                <weights offset="0" size="_WS_"/>
+                <biases offset="_WS_" size="_BS_"/>
+            </blobs>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="1"/>
+        <edge from-layer="2" from-port="0" to-layer="3" to-port="2"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::string ti_model_t = R"V0G0N(
+<net name="LSTMCell_TensorIterator" version="5" precision="FP32" batch="1">
+    <layers>
+        <layer name="in_data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_N_</dim>
+                    <dim>_DC_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="in_h" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>_SC_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="in_c" type="Input" precision="FP32" id="2">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>_SC_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="ti" type="TensorIterator" precision="FP32" id="3">
+            <input>
+                <port id="0">
+                    <dim>_N_</dim>
+                    <dim>_DC_</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>_SC_</dim>
+                </port>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>_SC_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>_N_</dim>
+                    <dim>_SC_</dim>
+                </port>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>_SC_</dim>
+                </port>
+            </output>
+            <port_map>
+                <input  external_port_id="0" internal_layer_id="0" internal_port_id="0" axis="0"/>
+                <input  external_port_id="1" internal_layer_id="0" internal_port_id="1"/>
+                <input  external_port_id="2" internal_layer_id="0" internal_port_id="2"/>
+                <output external_port_id="3" internal_layer_id="0" internal_port_id="3" axis="0"/>
+                <output external_port_id="4" internal_layer_id="0" internal_port_id="4"/>
+            </port_map>
+            <back_edges>
+                <edge from-layer="0" from-port="3" to-layer="0" to-port="1"/>
+                <edge from-layer="0" from-port="4" to-layer="0" to-port="2"/>
+            </back_edges>
+            <body>
+                <layers>
+                    <layer name="lstm" type="LSTMCell" precision="FP32" id="0">
+                        <data hidden_size="_SC_"/>
+                        <input>
+                            <port id="0">
+                                <dim>1</dim>
+                                <dim>_DC_</dim>
+                            </port>
+                            <port id="1">
+                                <dim>1</dim>
+                                <dim>_SC_</dim>
+                            </port>
+                            <port id="2">
+                                <dim>1</dim>
+                                <dim>_SC_</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="3">
+                                <dim>1</dim>
+                                <dim>_SC_</dim>
+                            </port>
+                            <port id="4">
+                                <dim>1</dim>
+                                <dim>_SC_</dim>
+                            </port>
+                        </output>
+                        <blobs>
+                            <weights offset="0" size="_WS_"/>
+                            <biases offset="_WS_" size="_BS_"/>
+                        </blobs>
+                    </layer>
+                </layers>
+            </body>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="1"/>
+        <edge from-layer="2" from-port="0" to-layer="3" to-port="2"/>
+    </edges>
+</net>
+)V0G0N";
+
+protected:
+    std::string getModel(lstm_int8_test_params p) {
+        std::string model = p.mode == lstm_int8_test_params::TensorIterator ? ti_model_t : model_t;
+
+        REPLACE_WITH_NUM(model, "_N_", p.batch);
+        REPLACE_WITH_NUM(model, "_DC_", p.in_size);
+        REPLACE_WITH_NUM(model, "_SC_", p.hidden_size);
+        REPLACE_WITH_NUM(model, "_WS_", 4 * p.hidden_size * (p.in_size + p.hidden_size) * sizeof(float));
+        REPLACE_WITH_NUM(model, "_BS_", 4 * p.hidden_size * sizeof(float));
+
+        return model;
+    }
+
+    static void fill(float *data, size_t size, float amplitude, float phase) {
+        for (size_t i = 0; i < size; i++)
+            data[i] = amplitude * sinf(0.37f * i + phase);
+    }
+
+    void infer(const lstm_int8_test_params &p, const InferenceEngine::TBlob<uint8_t>::Ptr &weights,
+               const InferenceEngine::BlobMap &srcs, bool quantized, InferenceEngine::BlobMap &outputBlobs) {
+        std::string model = getModel(p);
+
+        InferenceEngine::CNNNetReader net_reader;
+        ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+        net_reader.SetWeights(weights);
+
+        if (quantized) {
+            // the data lies in [-1, 1], so it is quantized to u8 as data * 127 + 128
+            InferenceEngine::CNNLayerPtr lstm;
+            if (p.mode == lstm_int8_test_params::TensorIterator) {
+                InferenceEngine::CNNLayerPtr ti;
+                ASSERT_NO_THROW(ti = net_reader.getNetwork().getLayerByName("ti"));
+                auto body = std::dynamic_pointer_cast<InferenceEngine::TensorIterator>(ti);
+                ASSERT_NE(nullptr, body);
+                ASSERT_EQ(1, body->body.inputs[0]->getInputTo().size());
+                lstm = body->body.inputs[0]->getInputTo().begin()->second;
+            } else {
+                ASSERT_NO_THROW(lstm = net_reader.getNetwork().getLayerByName("lstm"));
+            }
+            InferenceEngine::TBlob<float>::Ptr qparams = InferenceEngine::make_shared_blob<float>(
+                    {InferenceEngine::Precision::FP32, {2}, InferenceEngine::Layout::C});
+            qparams->allocate();
+            qparams->data()[0] = 127.f;
+            qparams->data()[1] = 128.f;
+            lstm->blobs["rnn-data-qparams"] = qparams;
+        }
+
+        InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+        ASSERT_EQ(2, out.size());
+        for (auto& item : out) {
+            InferenceEngine::TBlob<float>::Ptr blob = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            blob->allocate();
+            outputBlobs[item.first] = blob;
+        }
+
+        if (p.mode == lstm_int8_test_params::InferRequest) {
+            MKLDNNPlugin::MKLDNNExecNetwork::Ptr execNetwork(new MKLDNNPlugin::MKLDNNExecNetwork(net_reader.getNetwork(), {}, {}));
+            InferenceEngine::InputsDataMap _networkInputs = net_reader.getNetwork().getInputsInfo();
+            execNetwork->setNetworkInputs(_networkInputs);
+            execNetwork->setNetworkOutputs(out);
+            InferenceEngine::IInferRequest::Ptr inferRequest;
+            execNetwork->CreateInferRequest(inferRequest);
+
+            // the user blobs replace the memory of the graph the primitives were created with
+            InferenceEngine::ResponseDesc resp;
+            for (auto& item : srcs)
+                ASSERT_EQ(InferenceEngine::OK, inferRequest->SetBlob(item.first.c_str(), item.second, &resp)) << resp.msg;
+            for (auto& item : outputBlobs)
+                ASSERT_EQ(InferenceEngine::OK, inferRequest->SetBlob(item.first.c_str(), item.second, &resp)) << resp.msg;
+            ASSERT_EQ(InferenceEngine::OK, inferRequest->Infer(&resp)) << resp.msg;
+            return;
+        }
+
+        MKLDNNGraphTestClass graph;
+        graph.CreateGraph(net_reader.getNetwork());
+
+        auto cellType = p.mode == lstm_int8_test_params::TensorIterator ? MKLDNNPlugin::TensorIterator : MKLDNNPlugin::RNNCell;
+        size_t cellNodes = 0;
+        for (auto& node : graph.getNodes()) {
+            if (node->getType() == cellType) {
+                cellNodes++;
+                ASSERT_NE(nullptr, node->getSelectedPrimitiveDescriptor());
+            }
+        }
+        ASSERT_EQ(1, cellNodes);
+
+        graph.Infer(srcs, outputBlobs);
+    }
+
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            lstm_int8_test_params p = ::testing::WithParamInterface<lstm_int8_test_params>::GetParam();
+
+            size_t weights_size = 4 * p.hidden_size * (p.in_size + p.hidden_size + 1) * sizeof(float);
+            InferenceEngine::TBlob<uint8_t>::Ptr weights = InferenceEngine::make_shared_blob<uint8_t>(
+                    {InferenceEngine::Precision::U8, {weights_size}, InferenceEngine::Layout::C});
+            weights->allocate();
+            fill(weights->buffer().as<float *>(), weights_size / sizeof(float), 0.5f, 1.f);
+
+            InferenceEngine::BlobMap srcs;
+            // the states of TensorIterator are given for its body
+            size_t stateBatch = p.mode == lstm_int8_test_params::TensorIterator ? 1 : p.batch;
+            const std::vector<std::tuple<std::string, size_t, size_t>> inputs {
+                    std::make_tuple("in_data", p.batch, p.in_size),
+                    std::make_tuple("in_h", stateBatch, p.hidden_size),
+                    std::make_tuple("in_c", stateBatch, p.hidden_size)};
+            for (size_t i = 0; i < inputs.size(); i++) {
+                InferenceEngine::TBlob<float>::Ptr src = InferenceEngine::make_shared_blob<float>(
+                        {InferenceEngine::Precision::FP32, {std::get<1>(inputs[i]), std::get<2>(inputs[i])},
+                         InferenceEngine::Layout::NC});
+                src->allocate();
+                fill(src->data(), src->size(), 0.9f, static_cast<float>(i));
+                srcs[std::get<0>(inputs[i])] = src;
+            }
+
+            InferenceEngine::BlobMap ref, dst;
+            infer(p, weights, srcs, false, ref);
+            infer(p, weights, srcs, true, dst);
+
+            float max_diff = 0.f;
+            for (auto& item : ref) {
+                auto ref_data = item.second->buffer().as<const float *>();
+                auto dst_data = dst[item.first]->buffer().as<const float *>();
+                for (size_t i = 0; i < item.second->size(); i++) {
+                    ASSERT_NEAR(ref_data[i], dst_data[i], p.threshold) << item.first << "[" << i << "]";
+                    max_diff = std::max(max_diff, std::fabs(ref_data[i] - dst_data[i]));
+                }
+            }
+            // the outputs are not bitwise equal, so the int8 primitive was used instead of the fp32 fallback
+            ASSERT_LT(0.f, max_diff);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphLSTMCellInt8Tests, TestsLSTMCellInt8) {}
+
+
+INSTANTIATE_TEST_CASE_P(
+        TestsLSTMCellInt8, MKLDNNGraphLSTMCellInt8Tests,
+        ::testing::Values(
+                lstm_int8_test_params{1, 16, 16, 0.03f},
+                lstm_int8_test_params{4, 40, 24, 0.03f},
+                lstm_int8_test_params{16, 100, 100, 0.05f},
+                lstm_int8_test_params{4, 40, 24, 0.03f, lstm_int8_test_params::InferRequest},
+                lstm_int8_test_params{5, 40, 24, 0.05f, lstm_int8_test_params::TensorIterator}));
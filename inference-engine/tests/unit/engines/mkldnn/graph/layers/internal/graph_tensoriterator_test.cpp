@@ -0,0 +1,268 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <inference_engine/cnn_network_impl.hpp>
+#include "tests_common.hpp"
+
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+
+struct tensoriterator_test_params {
+    // sequence length and size of the state
+    size_t seq;
+    size_t channels;
+
+    // -1 if the sequence is iterated from the end
+    int stride;
+};
+
+
+// the body accumulates the items of the sequence into the state
+void ref_tensoriterator(const InferenceEngine::TBlob<float> &src, const InferenceEngine::TBlob<float> &init,
+                        InferenceEngine::TBlob<float> &dst, InferenceEngine::TBlob<float> &last, tensoriterator_test_params prm) {
+    const float *src_data = src.readOnly();
+    const float *init_data = init.readOnly();
+    float *dst_data = dst.data();
+    float *last_data = last.data();
+
+    std::vector<float> state(init_data, init_data + prm.channels);
+    for (size_t i = 0; i < prm.seq; i++) {
+        size_t t = prm.stride < 0 ? prm.seq - 1 - i : i;
+        for (size_t c = 0; c < prm.channels; c++) {
+            state[c] += src_data[t * prm.channels + c];
+            dst_data[t * prm.channels + c] = state[c];
+        }
+    }
+    for (size_t c = 0; c < prm.channels; c++)
+        last_data[c] = state[c];
+}
+
+class MKLDNNGraphTensorIteratorTests: public TestsCommon,
+                                      public WithParamInterface<tensoriterator_test_params> {
+    std::string model_t = R"V0G0N(
+<net name="TensorIterator_Only" version="4" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>_T_</dim>
+                    <dim>_C_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="in2" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>_C_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="ti" type="TensorIterator" precision="FP32" id="2">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>_T_</dim>
+                    <dim>_C_</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>_C_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>_T_</dim>
+                    <dim>_C_</dim>
+                </port>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>_C_</dim>
+                </port>
+            </output>
+            <port_map>
+                <input  external_port_id="0" internal_layer_id="0" internal_port_id="0" axis="1" stride="_S_"/>
+                <input  external_port_id="1" internal_layer_id="1" internal_port_id="1"/>
+                <output external_port_id="3" internal_layer_id="2" internal_port_id="1" axis="1" stride="_S_"/>
+                <output external_port_id="4" internal_layer_id="1" internal_port_id="2"/>
+            </port_map>
+            <back_edges>
+                <edge from-layer="1" from-port="2" to-layer="1" to-port="1"/>
+            </back_edges>
+            <body>
+                <layers>
+                    <layer id="0" name="ti_reshape_in" precision="FP32" type="Reshape">
+                        <data axis="0" dim="1,_C_" num_axes="-1"/>
+                        <input>
+                            <port id="0">
+                                <dim>1</dim>
+                                <dim>1</dim>
+                                <dim>_C_</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="1">
+                                <dim>1</dim>
+                                <dim>_C_</dim>
+                            </port>
+                        </output>
+                    </layer>
+                    <layer id="1" name="ti_sum" precision="FP32" type="Eltwise">
+                        <data operation="sum"/>
+                        <input>
+                            <port id="0">
+                                <dim>1</dim>
+                                <dim>_C_</dim>
+                            </port>
+                            <port id="1">
+                                <dim>1</dim>
+                                <dim>_C_</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="2">
+                                <dim>1</dim>
+                                <dim>_C_</dim>
+                            </port>
+                        </output>
+                    </layer>
+                    <layer id="2" name="ti_reshape_out" precision="FP32" type="Reshape">
+                        <data axis="0" dim="1,1,_C_" num_axes="-1"/>
+                        <input>
+                            <port id="0">
+                                <dim>1</dim>
+                                <dim>_C_</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="1">
+                                <dim>1</dim>
+                                <dim>1</dim>
+                                <dim>_C_</dim>
+                            </port>
+                        </output>
+                    </layer>
+                </layers>
+                <edges>
+                    <edge from-layer="0" from-port="1" to-layer="1" to-port="0"/>
+                    <edge from-layer="1" from-port="2" to-layer="2" to-port="0"/>
+                </edges>
+            </body>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+protected:
+    std::string getModel(tensoriterator_test_params p) {
+        std::string model = model_t;
+
+        REPLACE_WITH_NUM(model, "_T_", p.seq);
+        REPLACE_WITH_NUM(model, "_C_", p.channels);
+        REPLACE_WITH_NUM(model, "_S_", p.stride);
+
+        return model;
+    }
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            tensoriterator_test_params p = ::testing::WithParamInterface<tensoriterator_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork());
+
+            // the body is executed by a single node instead of being unrolled
+            size_t tiNodes = 0;
+            for (auto& node : graph.getNodes()) {
+                if (node->getType() == MKLDNNPlugin::TensorIterator) {
+                    tiNodes++;
+                    ASSERT_NE(nullptr, node->getSelectedPrimitiveDescriptor());
+                    ASSERT_EQ(MKLDNNPlugin::impl_desc_type::unknown, node->getSelectedPrimitiveDescriptor()->getImplementationType());
+                }
+            }
+            ASSERT_EQ(1, tiNodes);
+
+            InferenceEngine::TBlob<float>::Ptr src = InferenceEngine::make_shared_blob<float>(
+                    {InferenceEngine::Precision::FP32, {1, p.seq, p.channels}, InferenceEngine::Layout::CHW});
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            InferenceEngine::TBlob<float>::Ptr init = InferenceEngine::make_shared_blob<float>(
+                    {InferenceEngine::Precision::FP32, {1, p.channels}, InferenceEngine::Layout::NC});
+            init->allocate();
+            fill_data(init->buffer(), init->size());
+
+            InferenceEngine::BlobMap srcs;
+            srcs["in1"] = src;
+            srcs["in2"] = init;
+
+            InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+            ASSERT_EQ(2, out.size());
+
+            InferenceEngine::BlobMap outputBlobs;
+            InferenceEngine::TBlob<float>::Ptr output, lastOutput;
+            for (auto& item : out) {
+                InferenceEngine::TBlob<float>::Ptr blob = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+                blob->allocate();
+                outputBlobs[item.first] = blob;
+                if (item.second->getDims().size() == 3)
+                    output = blob;
+                else
+                    lastOutput = blob;
+            }
+            ASSERT_NE(nullptr, output);
+            ASSERT_NE(nullptr, lastOutput);
+
+            InferenceEngine::TBlob<float> dst_ref(output->getTensorDesc());
+            dst_ref.allocate();
+            InferenceEngine::TBlob<float> last_ref(lastOutput->getTensorDesc());
+            last_ref.allocate();
+            ref_tensoriterator(*src, *init, dst_ref, last_ref, p);
+
+            // the second inference starts from the initial state again
+            for (int i = 0; i < 2; i++) {
+                graph.Infer(srcs, outputBlobs);
+
+                compare(*output, dst_ref);
+                compare(*lastOutput, last_ref);
+            }
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphTensorIteratorTests, TestsTensorIterator) {}
+
+
+INSTANTIATE_TEST_CASE_P(
+        TestsTensorIterator, MKLDNNGraphTensorIteratorTests,
+        ::testing::Values(
+                tensoriterator_test_params{5, 16, 1},
+                tensoriterator_test_params{5, 16, -1},
+                tensoriterator_test_params{100, 8, 1}));
@@ -0,0 +1,327 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+
+using namespace InferenceEngine;
+using namespace ::testing;
+using namespace std;
+
+extern InferenceEngine::IExtensionPtr make_FakeExtensions();
+
+struct generic_fusing_test_params {
+    enum class layout { planar, nspc, blocked };
+
+    // Resample, MVN or Normalize
+    std::string genericType;
+    std::string genericData;
+    // ReLU, ScaleShift or PReLU
+    std::string simpleType;
+    std::string simpleData;
+
+    SizeVector in;
+    SizeVector out;
+    layout fl;
+};
+
+class MKLDNNGraphGenericFusingTests: public TestsCommon,
+                                     public WithParamInterface<generic_fusing_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="Generic_Fusing" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">__SRC_DIMS__
+                </port>
+            </output>
+        </layer>
+        <layer name="fakeLayer" id="1" type="_FL_" precision="FP32">
+            <input>
+                <port id="1">__SRC_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="2">__SRC_DIMS__
+                </port>
+            </output>
+        </layer>
+        <layer name="generic" id="2" type="_GT_" precision="FP32">
+            <data _GD_/>
+            _GW_
+            <input>
+                <port id="3">__SRC_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="4">__DST_DIMS__
+                </port>
+            </output>
+        </layer>
+        <layer name="simple" id="3" type="_ST_" precision="FP32">
+            <data _SD_/>
+            _SW_
+            <input>
+                <port id="5">__DST_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="6">__DST_DIMS__
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="5"/>
+    </edges>
+</Net>
+)V0G0N";
+
+    static std::string dimsToString(const SizeVector& dims) {
+        std::string s_dims;
+        for (auto& dim : dims) {
+            s_dims += "\n                    <dim>";
+            s_dims += std::to_string(dim) + "</dim>";
+        }
+        return s_dims;
+    }
+
+protected:
+    std::shared_ptr<InferenceEngine::Extension> cpuExt;
+
+    // The weights of the generic layer (Normalize scales) are followed by the weights of the simple one
+    size_t genericWeightsSize(const generic_fusing_test_params& p) const {
+        return p.genericType == "Normalize" ? p.out[1] : 0;
+    }
+
+    size_t simpleWeightsSize(const generic_fusing_test_params& p) const {
+        if (p.simpleType == "ScaleShift")
+            return 2 * p.out[1];
+        if (p.simpleType == "PReLU")
+            return p.out[1];
+        return 0;
+    }
+
+    std::string getModel(const generic_fusing_test_params& p) {
+        std::string model = model_t;
+        switch (p.fl) {
+            case generic_fusing_test_params::layout::planar:
+                REPLACE_WITH_STR(model, "_FL_", "FakeLayerPLN");
+                break;
+            case generic_fusing_test_params::layout::nspc:
+                REPLACE_WITH_STR(model, "_FL_", "FakeLayerNSPC");
+                break;
+            case generic_fusing_test_params::layout::blocked:
+                REPLACE_WITH_STR(model, "_FL_", "FakeLayerBLK");
+                break;
+        }
+        REPLACE_WITH_STR(model, "__SRC_DIMS__", dimsToString(p.in));
+        REPLACE_WITH_STR(model, "__DST_DIMS__", dimsToString(p.out));
+        REPLACE_WITH_STR(model, "_GT_", p.genericType);
+        REPLACE_WITH_STR(model, "_GD_", p.genericData);
+        REPLACE_WITH_STR(model, "_ST_", p.simpleType);
+        REPLACE_WITH_STR(model, "_SD_", p.simpleData);
+
+        size_t genericSize = genericWeightsSize(p) * sizeof(float);
+        std::string genericWeights;
+        if (genericSize)
+            genericWeights = "<weights offset=\"0\" size=\"" + std::to_string(genericSize) + "\"/>";
+        REPLACE_WITH_STR(model, "_GW_", genericWeights);
+
+        std::string simpleWeights;
+        size_t channels = p.out[1] * sizeof(float);
+        if (p.simpleType == "ScaleShift") {
+            simpleWeights = "<weights offset=\"" + std::to_string(genericSize) + "\" size=\"" + std::to_string(channels) + "\"/>" +
+                            "<biases offset=\"" + std::to_string(genericSize + channels) + "\" size=\"" + std::to_string(channels) + "\"/>";
+        } else if (p.simpleType == "PReLU") {
+            simpleWeights = "<weights offset=\"" + std::to_string(genericSize) + "\" size=\"" + std::to_string(channels) + "\"/>";
+        }
+        REPLACE_WITH_STR(model, "_SW_", simpleWeights);
+        return model;
+    }
+
+    void createGraph(MKLDNNGraphTestClass& graph, CNNNetReader& net_reader, const generic_fusing_test_params& p,
+                     bool isFused) {
+        std::string model = getModel(p);
+        ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+        size_t weightsSize = genericWeightsSize(p) + simpleWeightsSize(p);
+        if (weightsSize) {
+            TBlob<uint8_t> *weights = new TBlob<uint8_t>(Precision::U8, C, {weightsSize * sizeof(float)});
+            weights->allocate();
+            fill_data_sine(weights->buffer().as<float *>(), weightsSize, 0.5, 1.5, 0.3);
+            net_reader.SetWeights(TBlob<uint8_t>::Ptr(weights));
+        }
+        // The generic layer having one more consumer is not fused, it gives the reference output
+        if (!isFused)
+            net_reader.getNetwork().addOutput("generic");
+
+        // The library of the extension is kept loaded while the graphs of the test use its layers
+        if (!cpuExt)
+            cpuExt = std::make_shared<InferenceEngine::Extension>(make_so_name("cpu_extension"));
+        MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+        extMgr->AddExtension(InferenceEngine::IExtensionPtr(cpuExt.get(), [](InferenceEngine::IExtension*){}));
+        extMgr->AddExtension(make_FakeExtensions());
+
+        graph.CreateGraph(net_reader.getNetwork(), extMgr);
+    }
+
+    static size_t countNodes(MKLDNNGraphTestClass& graph, MKLDNNPlugin::Type type) {
+        auto& nodes = graph.getNodes();
+        return std::count_if(nodes.begin(), nodes.end(), [type](const MKLDNNPlugin::MKLDNNNodePtr& node) {
+            return node->getType() == type;
+        });
+    }
+
+    static Blob::Ptr infer(MKLDNNGraphTestClass& graph, CNNNetReader& net_reader, const Blob::Ptr& src) {
+        BlobMap srcs;
+        srcs["in1"] = src;
+
+        BlobMap outputBlobs;
+        for (auto& item : net_reader.getNetwork().getOutputsInfo()) {
+            TBlob<float>::Ptr output = make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+        }
+        graph.Infer(srcs, outputBlobs);
+        return outputBlobs["simple"];
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            generic_fusing_test_params p = ::testing::WithParamInterface<generic_fusing_test_params>::GetParam();
+
+            CNNNetReader fused_reader;
+            MKLDNNGraphTestClass fused;
+            createGraph(fused, fused_reader, p, true);
+
+            CNNNetReader unfused_reader;
+            MKLDNNGraphTestClass unfused;
+            createGraph(unfused, unfused_reader, p, false);
+
+            MKLDNNPlugin::Type simpleType = p.simpleType == "ReLU" ? MKLDNNPlugin::Activation : MKLDNNPlugin::Depthwise;
+            ASSERT_EQ(0, countNodes(fused, simpleType));
+            ASSERT_EQ(1, countNodes(unfused, simpleType));
+            for (auto& node : fused.getNodes()) {
+                if (node->getName() == "generic") {
+                    ASSERT_EQ(1, node->getFusedWith().size());
+                    ASSERT_EQ("simple", node->getFusedWith()[0]->getName());
+                }
+            }
+            // The simple node and the reorders around it are gone, and there is one Output node less
+            ASSERT_LT(fused.getNodes().size() + 1, unfused.getNodes().size());
+
+            Blob::Ptr src = make_shared_blob<float, const SizeVector>(Precision::FP32, NCHW, p.in);
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            Blob::Ptr dst = infer(fused, fused_reader, src);
+            Blob::Ptr dst_ref = infer(unfused, unfused_reader, src);
+            compare(*dst, *dst_ref, 0.0001f);
+        } catch (const details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphGenericFusingTests, TestsGenericFusing) {}
+
+#define resample_nearest "type=\"caffe.ResampleParameter.NEAREST\" antialias=\"0\" factor=\"2\""
+#define mvn_params "across_channels=\"0\" normalize_variance=\"1\" eps=\"0.00001\""
+#define normalize_params(across_spatial) "across_spatial=\"" #across_spatial "\" channel_shared=\"0\" eps=\"0.00001\""
+#define relu_params "negative_slope=\"0\""
+#define prelu_params "channel_shared=\"0\""
+
+INSTANTIATE_TEST_CASE_P(
+        TestsGenericFusing, MKLDNNGraphGenericFusingTests,
+        ::testing::Values(
+                generic_fusing_test_params{"Resample", resample_nearest, "ReLU", relu_params,
+                                           {2, 16, 5, 7}, {2, 16, 10, 14}, generic_fusing_test_params::layout::planar},
+                generic_fusing_test_params{"Resample", resample_nearest, "ReLU", relu_params,
+                                           {2, 16, 5, 7}, {2, 16, 10, 14}, generic_fusing_test_params::layout::nspc},
+                generic_fusing_test_params{"Resample", resample_nearest, "ReLU", relu_params,
+                                           {2, 19, 5, 7}, {2, 19, 10, 14}, generic_fusing_test_params::layout::blocked},
+                generic_fusing_test_params{"MVN", mvn_params, "ScaleShift", "",
+                                           {2, 16, 6, 6}, {2, 16, 6, 6}, generic_fusing_test_params::layout::planar},
+                generic_fusing_test_params{"MVN", mvn_params, "ScaleShift", "",
+                                           {2, 16, 6, 6}, {2, 16, 6, 6}, generic_fusing_test_params::layout::nspc},
+                generic_fusing_test_params{"MVN", mvn_params, "ScaleShift", "",
+                                           {2, 32, 6, 6}, {2, 32, 6, 6}, generic_fusing_test_params::layout::blocked},
+                // The channels of the blocked layout are not a multiple of the block, the weights and biases are padded
+                generic_fusing_test_params{"MVN", mvn_params, "ScaleShift", "",
+                                           {2, 19, 6, 6}, {2, 19, 6, 6}, generic_fusing_test_params::layout::blocked},
+                generic_fusing_test_params{"MVN", mvn_params, "ScaleShift", "",
+                                           {1, 5, 4, 3}, {1, 5, 4, 3}, generic_fusing_test_params::layout::blocked},
+                generic_fusing_test_params{"Normalize", normalize_params(0), "PReLU", prelu_params,
+                                           {2, 16, 6, 6}, {2, 16, 6, 6}, generic_fusing_test_params::layout::planar},
+                generic_fusing_test_params{"Normalize", normalize_params(1), "PReLU", prelu_params,
+                                           {2, 16, 6, 6}, {2, 16, 6, 6}, generic_fusing_test_params::layout::nspc},
+                generic_fusing_test_params{"Normalize", normalize_params(0), "PReLU", prelu_params,
+                                           {2, 19, 6, 6}, {2, 19, 6, 6}, generic_fusing_test_params::layout::blocked},
+                generic_fusing_test_params{"Normalize", normalize_params(1), "PReLU", prelu_params,
+                                           {2, 19, 6, 6}, {2, 19, 6, 6}, generic_fusing_test_params::layout::blocked},
+                generic_fusing_test_params{"Normalize", normalize_params(0), "PReLU", prelu_params,
+                                           {1, 5, 4, 3}, {1, 5, 4, 3}, generic_fusing_test_params::layout::blocked}
+        ));
+
+class MKLDNNGraphDynBatchGenericFusingTests: public MKLDNNGraphGenericFusingTests {
+protected:
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            generic_fusing_test_params p = ::testing::WithParamInterface<generic_fusing_test_params>::GetParam();
+            size_t MB = p.in[0];
+
+            CNNNetReader net_reader;
+            MKLDNNGraphTestClass graph;
+            graph.setProperty({{PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::YES}});
+            createGraph(graph, net_reader, p, true);
+
+            Blob::Ptr src = make_shared_blob<float, const SizeVector>(Precision::FP32, NCHW, p.in);
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            BlobMap srcs;
+            srcs["in1"] = src;
+
+            BlobMap outputBlobs;
+            for (auto& item : net_reader.getNetwork().getOutputsInfo()) {
+                TBlob<float>::Ptr output = make_shared_blob<float>(item.second->getTensorDesc());
+                output->allocate();
+                outputBlobs[item.first] = output;
+            }
+
+            // The fused operations must not touch the output of the batch items which are not processed
+            auto checkGeneric = [](const MKLDNNPlugin::MKLDNNNodePtr& node) {
+                return node->getName() == "generic";
+            };
+            graph.checkDynBatch(srcs, outputBlobs, MB, MB, checkGeneric, MKLDNNGraphTestClass::CheckDynBatchType::Child);
+            graph.checkDynBatch(srcs, outputBlobs, 1, MB, checkGeneric, MKLDNNGraphTestClass::CheckDynBatchType::Child);
+        } catch (const details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphDynBatchGenericFusingTests, TestsDynBatchGenericFusing) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsDynBatchGenericFusing, MKLDNNGraphDynBatchGenericFusingTests,
+        ::testing::Values(
+                generic_fusing_test_params{"Normalize", normalize_params(0), "PReLU", prelu_params,
+                                           {2, 16, 6, 6}, {2, 16, 6, 6}, generic_fusing_test_params::layout::planar},
+                generic_fusing_test_params{"Normalize", normalize_params(1), "PReLU", prelu_params,
+                                           {2, 19, 6, 6}, {2, 19, 6, 6}, generic_fusing_test_params::layout::blocked}
+        ));
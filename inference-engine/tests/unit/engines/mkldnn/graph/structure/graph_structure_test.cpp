@@ -5,6 +5,10 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
 #include "mkldnn_plugin/mkldnn_graph.h"
+#include "mkldnn_plugin/mkldnn_memory_state.h"
+#include "mkldnn_plugin/mkldnn_constant_folding.h"
+#include "mkldnn_plugin/nodes/mkldnn_input_node.h"
+#include "exec_graph_info.hpp"
 
 #include "single_layer_common.hpp"
 #include <mkldnn_plugin/mkldnn_extension_utils.h>
@@ -12,6 +16,7 @@
 #include "../test_graph.hpp"
 #include <ext_list.hpp>
 #include <ie_builders.hpp>
+#include <ie_util_internal.hpp>
 
 using namespace ::testing;
 using namespace std;
@@ -6736,4 +6741,698 @@ TEST_F(MKLDNNGraphStructureTests, TestCheckIncorrectScaleShift) {
 
     MKLDNNGraphTestClass graph;
     ASSERT_THROW(graph.CreateGraph(reader.getNetwork()), InferenceEngine::details::InferenceEngineException);
-}
\ No newline at end of file
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestMemoryStatesOfSequences) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="sum" type="Eltwise" precision="FP32" id="1">
+            <data operation="sum"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="memory_out" type="Memory" precision="FP32" id="2">
+            <data id="r_1" index="0" size="2"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+        </layer>
+        <layer name="memory_in" type="Memory" precision="FP32" id="3">
+            <data id="r_1" index="1" size="2"/>
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="3" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+    ASSERT_EQ(1, graph.GetMemoryStates().size());
+
+    MKLDNNPlugin::MKLDNNStatePool pool(graph);
+
+    InferenceEngine::SizeVector dims = {1, 4};
+    std::vector<float> inpData = {1, 2, 3, 4};
+    std::vector<float> outData(4);
+    InferenceEngine::BlobMap srcs;
+    srcs["data"] = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims, InferenceEngine::NC}, inpData.data());
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs["sum"] = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims, InferenceEngine::NC}, outData.data());
+
+    // Each sequence accumulates its own inputs
+    const std::vector<size_t> sequences = {7, 42, 7, 7, 42};
+    std::map<size_t, float> steps;
+    for (auto id : sequences) {
+        {
+            MKLDNNPlugin::MKLDNNStatePool::Binding states(pool, graph, {id}, -1);
+            graph.Infer(srcs, outputBlobs);
+        }
+        steps[id] += 1.f;
+        for (size_t i = 0; i < outData.size(); i++)
+            ASSERT_FLOAT_EQ(steps[id] * inpData[i], outData[i]) << "sequence " << id;
+    }
+
+    ASSERT_NO_THROW(pool.Release(7));
+    ASSERT_THROW(pool.Release(7), InferenceEngine::details::InferenceEngineException);
+    {
+        MKLDNNPlugin::MKLDNNStatePool::Binding states(pool, graph, {7}, -1);
+        graph.Infer(srcs, outputBlobs);
+    }
+    for (size_t i = 0; i < outData.size(); i++)
+        ASSERT_FLOAT_EQ(inpData[i], outData[i]);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestMemoryStatesOfSequencesInOneBatch) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="2">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>2</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="sum" type="Eltwise" precision="FP32" id="1">
+            <data operation="sum"/>
+            <input>
+                <port id="0">
+                    <dim>2</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="1">
+                    <dim>2</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>2</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="memory_out" type="Memory" precision="FP32" id="2">
+            <data id="r_1" index="0" size="2"/>
+            <input>
+                <port id="0">
+                    <dim>2</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+        </layer>
+        <layer name="memory_in" type="Memory" precision="FP32" id="3">
+            <data id="r_1" index="1" size="2"/>
+            <output>
+                <port id="0">
+                    <dim>2</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="3" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+    ASSERT_EQ(1, graph.GetMemoryStates().size());
+
+    MKLDNNPlugin::MKLDNNStatePool pool(graph);
+
+    const size_t itemSize = 4;
+    InferenceEngine::SizeVector dims = {2, itemSize};
+    std::vector<float> inpData = {1, 2, 3, 4, 10, 20, 30, 40};
+    std::vector<float> outData(2 * itemSize);
+    InferenceEngine::BlobMap srcs;
+    srcs["data"] = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims, InferenceEngine::NC}, inpData.data());
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs["sum"] = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims, InferenceEngine::NC}, outData.data());
+
+    // Every batch item accumulates the inputs of its own sequence, whichever item the sequence is bound to
+    const std::vector<std::vector<size_t>> batches = {{7, 42}, {42, 7}, {7}, {3, 42}, {7, 3}};
+    std::map<size_t, std::vector<float>> accumulated;
+    for (auto& ids : batches) {
+        {
+            MKLDNNPlugin::MKLDNNStatePool::Binding states(pool, graph, ids, -1);
+            graph.Infer(srcs, outputBlobs);
+        }
+        for (size_t n = 0; n < ids.size(); n++) {
+            auto& state = accumulated[ids[n]];
+            state.resize(itemSize, 0.f);
+            for (size_t i = 0; i < itemSize; i++) {
+                state[i] += inpData[n * itemSize + i];
+                ASSERT_FLOAT_EQ(state[i], outData[n * itemSize + i]) << "sequence " << ids[n] << " in item " << n;
+            }
+        }
+    }
+
+    ASSERT_THROW(MKLDNNPlugin::MKLDNNStatePool::Binding(pool, graph, {7, 42, 3}, -1),
+                 InferenceEngine::details::InferenceEngineException);
+    ASSERT_THROW(MKLDNNPlugin::MKLDNNStatePool::Binding(pool, graph, {7, 42}, 1),
+                 InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestU16InputIsConvertedWithoutAllocations) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="relu" type="ReLU" precision="FP32" id="1">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+    InferenceEngine::CNNNetwork network = net_reader.getNetwork();
+    network.getInputsInfo().begin()->second->setPrecision(InferenceEngine::Precision::U16);
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(network));
+
+    InferenceEngine::SizeVector dims = {1, 3, 2, 2};
+    std::vector<uint16_t> inpData(12);
+    for (size_t i = 0; i < inpData.size(); i++)
+        inpData[i] = static_cast<uint16_t>(1000 * i);
+    std::vector<float> outData(12);
+    InferenceEngine::BlobMap srcs;
+    srcs["data"] = InferenceEngine::make_shared_blob<uint16_t>({InferenceEngine::Precision::U16, dims, InferenceEngine::NCHW}, inpData.data());
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs["relu"] = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims, InferenceEngine::NCHW}, outData.data());
+
+    graph.Infer(srcs, outputBlobs);
+    size_t afterWarmUp = graph.getInferAllocations();
+    for (int i = 0; i < 4; i++)
+        graph.Infer(srcs, outputBlobs);
+    ASSERT_EQ(afterWarmUp, graph.getInferAllocations());
+
+    for (size_t i = 0; i < outData.size(); i++)
+        ASSERT_FLOAT_EQ(static_cast<float>(inpData[i]), outData[i]);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestNHWCInputAndOutputReordersAreCreatedOnLoad) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="relu" type="ReLU" precision="FP32" id="1">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+    InferenceEngine::CNNNetwork network = net_reader.getNetwork();
+    network.getInputsInfo().begin()->second->setLayout(InferenceEngine::NHWC);
+    network.getOutputsInfo().begin()->second->setLayout(InferenceEngine::NHWC);
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(network));
+
+    InferenceEngine::SizeVector dims = {1, 3, 2, 2};
+    std::vector<float> inpData(12);
+    for (size_t i = 0; i < inpData.size(); i++)
+        inpData[i] = static_cast<float>(i);
+    std::vector<float> outData(12);
+    InferenceEngine::BlobMap srcs;
+    srcs["data"] = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims, InferenceEngine::NHWC}, inpData.data());
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs["relu"] = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims, InferenceEngine::NHWC}, outData.data());
+
+    // the reorders of the blobs of the network layouts are not created on the inference path
+    for (int i = 0; i < 4; i++)
+        graph.Infer(srcs, outputBlobs);
+    ASSERT_EQ(0u, graph.getInferAllocations());
+
+    for (size_t i = 0; i < outData.size(); i++)
+        ASSERT_FLOAT_EQ(inpData[i], outData[i]);
+
+    // a blob of another layout gets its reorder once
+    std::vector<float> nchwData(12);
+    for (size_t c = 0; c < 3; c++)
+        for (size_t hw = 0; hw < 4; hw++)
+            nchwData[c * 4 + hw] = inpData[hw * 3 + c];
+    srcs["data"] = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims, InferenceEngine::NCHW}, nchwData.data());
+    graph.Infer(srcs, outputBlobs);
+    size_t afterWarmUp = graph.getInferAllocations();
+    for (int i = 0; i < 4; i++)
+        graph.Infer(srcs, outputBlobs);
+    ASSERT_EQ(afterWarmUp, graph.getInferAllocations());
+
+    for (size_t i = 0; i < outData.size(); i++)
+        ASSERT_FLOAT_EQ(inpData[i], outData[i]);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestConstantSubgraphIsFoldedOnLoad) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="const" type="Const" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+            <blobs>
+                <custom offset="0" size="48"/>
+            </blobs>
+        </layer>
+        <layer name="power" type="Power" precision="FP32" id="2">
+            <data power="1" scale="3" shift="1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="sum" type="Eltwise" precision="FP32" id="3">
+            <data operation="sum"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="0"/>
+        <edge from-layer="2" from-port="1" to-layer="3" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {48});
+    weights->allocate();
+    float *constData = (float *) weights->buffer();
+    for (size_t i = 0; i < 12; i++)
+        constData[i] = static_cast<float>(i);
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+    net_reader.SetWeights(weights_ptr);
+
+    auto network = InferenceEngine::cloneNet(net_reader.getNetwork());
+    MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+    auto folding = MKLDNNPlugin::MKLDNNConstantFolding::FoldConstants(*network, extMgr);
+    ASSERT_EQ(1, folding.layers);
+    ASSERT_EQ(48, folding.bytes);
+
+    // the power is replaced by a Const layer keeping its result
+    InferenceEngine::CNNLayerPtr power;
+    ASSERT_EQ(InferenceEngine::OK, network->getLayerByName("power", power, nullptr));
+    ASSERT_EQ("Const", power->type);
+    InferenceEngine::CNNLayerPtr constLayer;
+    ASSERT_NE(InferenceEngine::OK, network->getLayerByName("const", constLayer, nullptr));
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(*network));
+
+    // the graph uses the data of the Const layer without a copy
+    for (auto &node : graph.getNodes()) {
+        if (node->getName() != "power")
+            continue;
+        auto *input = dynamic_cast<MKLDNNPlugin::MKLDNNInputNode *>(node.get());
+        ASSERT_NE(nullptr, input);
+        ASSERT_EQ(input->getConstBlob()->cbuffer().as<const void *>(), node->getChildEdgeAt(0)->getMemory().GetData());
+    }
+
+    InferenceEngine::SizeVector dims = {1, 3, 2, 2};
+    std::vector<float> inpData(12);
+    for (size_t i = 0; i < inpData.size(); i++)
+        inpData[i] = static_cast<float>(10 * i);
+    std::vector<float> outData(12);
+    InferenceEngine::BlobMap srcs;
+    srcs["data"] = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims, InferenceEngine::NCHW}, inpData.data());
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs["sum"] = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims, InferenceEngine::NCHW}, outData.data());
+
+    for (int i = 0; i < 2; i++) {
+        graph.Infer(srcs, outputBlobs);
+        for (size_t j = 0; j < outData.size(); j++)
+            ASSERT_FLOAT_EQ(inpData[j] + 3.0f * constData[j] + 1.0f, outData[j]);
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestSampledPerfCountersAttributeFusedNodes) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="4" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+            <weights offset="0" size="48"/>
+            <biases offset="48" size="16"/>
+        </layer>
+        <layer name="relu" type="ReLU" precision="FP32" id="2">
+            <data negative_slope="0"/>
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+    </edges>
+</net>
+)V0G0N";
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {64});
+    weights->allocate();
+    fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+    net_reader.SetWeights(weights_ptr);
+
+    MKLDNNGraphTestClass graph;
+    graph.setProperty({{InferenceEngine::PluginConfigParams::KEY_PERF_COUNT, InferenceEngine::PluginConfigParams::YES},
+                       {InferenceEngine::PluginConfigParams::KEY_CPU_PERF_COUNT_SAMPLING, "4"}});
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    InferenceEngine::SizeVector dims = {1, 3, 4, 4};
+    std::vector<float> inpData(48);
+    fill_data(inpData.data(), inpData.size());
+    std::vector<float> outData(64);
+    InferenceEngine::BlobMap srcs;
+    srcs["data"] = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims, InferenceEngine::NCHW}, inpData.data());
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs["relu"] = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {1, 4, 4, 4}, InferenceEngine::NCHW}, outData.data());
+
+    const int inferences = 400;
+    for (int i = 0; i < inferences; i++)
+        graph.Infer(srcs, outputBlobs);
+
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> perfMap;
+    graph.GetPerfData(perfMap);
+    ASSERT_EQ(InferenceEngine::InferenceEngineProfileInfo::EXECUTED, perfMap["conv"].status);
+    // the ReLU is fused into the convolution, so its time is counted by the convolution
+    ASSERT_EQ(InferenceEngine::InferenceEngineProfileInfo::OPTIMIZED_OUT, perfMap["relu"].status);
+    ASSERT_EQ(0, perfMap["relu"].realTime_uSec);
+    ASSERT_STREQ(perfMap["conv"].exec_type, perfMap["relu"].exec_type);
+
+    auto execGraph = graph.dump();
+    InferenceEngine::CNNLayerPtr conv;
+    ASSERT_EQ(InferenceEngine::OK, execGraph->getLayerByName("conv", conv, nullptr));
+    // two operations per multiply-add of the 4x4x4 outputs over 3 input channels
+    ASSERT_EQ("384", conv->params[ExecGraphInfoSerialization::FLOPS]);
+    ASSERT_NE(conv->params.end(), conv->params.find(ExecGraphInfoSerialization::ACHIEVED_GFLOPS));
+    // one of 4 inferences is measured on average
+    int samples = std::stoi(conv->params[ExecGraphInfoSerialization::PERF_COUNTER_SAMPLES]);
+    ASSERT_GT(samples, inferences / 8);
+    ASSERT_LT(samples, inferences / 2);
+    ASSERT_LE(std::stoi(conv->params[ExecGraphInfoSerialization::PERF_COUNTER_MIN]),
+              std::stoi(conv->params[ExecGraphInfoSerialization::PERF_COUNTER]));
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestSmallNodesAreRunByFewerThreads) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power" type="Power" precision="FP32" id="1">
+            <power_data power="1" scale="2" shift="1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv" type="Convolution" precision="FP32" id="2">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="64" group="1"/>
+            <input>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+            <weights offset="0" size="6912"/>
+            <biases offset="6912" size="256"/>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="2"/>
+    </edges>
+</net>
+)V0G0N";
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {7168});
+    weights->allocate();
+    fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+    net_reader.SetWeights(weights_ptr);
+
+    auto getExecThreads = [](MKLDNNGraphTestClass& graph, const std::string& name) {
+        for (auto& node : graph.getNodes()) {
+            if (node->getName() == name)
+                return node->getExecThreads();
+        }
+        return -1;
+    };
+
+    // the policy is disabled by default, every node uses all threads of the stream
+    MKLDNNGraphTestClass defaultGraph;
+    ASSERT_NO_THROW(defaultGraph.CreateGraph(net_reader.getNetwork()));
+    for (auto& node : defaultGraph.getNodes())
+        ASSERT_EQ(0, node->getExecThreads()) << node->getName();
+
+    // the power processes 48 elements, which is less than the grain, while the convolution
+    // does 64 * 4 * 4 * 3 * 3 * 3 = 27648 multiply-adds, which is enough for every thread
+    MKLDNNGraphTestClass graph;
+    graph.setProperty({{InferenceEngine::PluginConfigParams::KEY_CPU_PARALLEL_GRAIN, "64"}});
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+    ASSERT_EQ(parallel_get_max_threads() > 1 ? 1 : 0, getExecThreads(graph, "power"));
+    ASSERT_EQ(0, getExecThreads(graph, "conv"));
+
+    InferenceEngine::SizeVector dims = {1, 3, 4, 4};
+    std::vector<float> inpData(48);
+    fill_data(inpData.data(), inpData.size());
+    InferenceEngine::BlobMap srcs;
+    srcs["data"] = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims, InferenceEngine::NCHW}, inpData.data());
+
+    // the limited nodes compute the same results
+    std::vector<float> refData(1024), outData(1024);
+    InferenceEngine::BlobMap refBlobs, outputBlobs;
+    refBlobs["conv"] = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {1, 64, 4, 4}, InferenceEngine::NCHW}, refData.data());
+    outputBlobs["conv"] = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {1, 64, 4, 4}, InferenceEngine::NCHW}, outData.data());
+    defaultGraph.Infer(srcs, refBlobs);
+    graph.Infer(srcs, outputBlobs);
+    for (size_t i = 0; i < refData.size(); i++)
+        ASSERT_EQ(refData[i], outData[i]) << i;
+}
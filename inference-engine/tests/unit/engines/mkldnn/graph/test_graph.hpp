@@ -184,6 +184,11 @@ public:
         return graphNodes;
     }
 
+    // the heap allocations on the inference path, they are expected to stop after the warm-up
+    size_t getInferAllocations() const {
+        return inferAllocations;
+    }
+
     void CreateGraph(InferenceEngine::ICNNNetwork &network, const MKLDNNPlugin::MKLDNNExtensionManager::Ptr& extMgr) {
         MKLDNNGraph::CreateGraph(network, extMgr);
     }
@@ -0,0 +1,44 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include "mkldnn_plugin/mkldnn_allocator.h"
+
+using namespace MKLDNNPlugin;
+
+class MKLDNNAllocatorTest : public ::testing::Test {};
+
+TEST_F(MKLDNNAllocatorTest, PoolReusesReleasedBlocksOfTheSameSizeClass) {
+    auto allocator = std::make_shared<MKLDNNAllocator>(-1, false, true);
+    void *first = allocator->alloc(100);
+    ASSERT_NE(nullptr, first);
+    std::memset(first, 0, 100);
+    ASSERT_TRUE(allocator->free(first));
+
+    void *second = allocator->alloc(120);
+    ASSERT_EQ(first, second);
+    ASSERT_TRUE(allocator->free(second));
+    ASSERT_FALSE(allocator->free(second));
+
+    auto stats = allocator->getStatistics();
+    ASSERT_EQ(2, stats.allocations);
+    ASSERT_EQ(1, stats.systemAllocations);
+    ASSERT_EQ(1, stats.poolHits);
+    ASSERT_EQ(0, stats.bytesInUse);
+}
+
+TEST_F(MKLDNNAllocatorTest, LargeBlocksAreAlignedToHugePages) {
+    auto allocator = std::make_shared<MKLDNNAllocator>(-1, true, false);
+    const size_t size = 3 * MKLDNNAllocator::hugePageSize + 1;
+    void *ptr = allocator->alloc(size);
+    ASSERT_NE(nullptr, ptr);
+    std::memset(ptr, 1, size);
+#if defined(__linux__)
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(ptr) % MKLDNNAllocator::hugePageSize);
+#endif
+    ASSERT_TRUE(allocator->free(ptr));
+    ASSERT_EQ(0, allocator->getStatistics().bytesPooled);
+}
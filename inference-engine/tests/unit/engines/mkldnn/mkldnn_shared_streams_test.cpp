@@ -0,0 +1,156 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "mkldnn_plugin/mkldnn_graph.h"
+#include "mkldnn_plugin/mkldnn_shared_streams.h"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+class MKLDNNSharedStreamsTest : public ::testing::Test {
+protected:
+    std::vector<std::shared_ptr<MKLDNNGraph>> createGraphs(size_t count) {
+        std::vector<std::shared_ptr<MKLDNNGraph>> graphs;
+        for (size_t i = 0; i < count; i++)
+            graphs.push_back(std::make_shared<MKLDNNGraph>());
+        return graphs;
+    }
+
+    static bool waitFor(const std::atomic<int>& counter, int value) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (counter < value && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::yield();
+        return counter >= value;
+    }
+};
+
+TEST_F(MKLDNNSharedStreamsTest, networksShareStreamInProportionToWeights) {
+    auto pool = std::make_shared<SharedStreamsPool>(1, 1, false);
+    auto light = std::make_shared<SharedStreamsExecutor>(pool, "light", 1, createGraphs(1));
+    auto heavy = std::make_shared<SharedStreamsExecutor>(pool, "heavy", 3, createGraphs(1));
+
+    // the stream is kept busy until the requests of both networks are queued
+    std::atomic<int> isReleased(0);
+    auto gate = std::make_shared<Task>([&] { waitFor(isReleased, 1); });
+    ASSERT_TRUE(light->startTask(gate));
+
+    std::mutex mutex;
+    std::vector<std::string> order;
+    std::vector<Task::Ptr> tasks;
+    for (int i = 0; i < 40; i++) {
+        for (auto& named : {std::make_pair(light, "light"), std::make_pair(heavy, "heavy")}) {
+            auto& executor = named.first;
+            std::string network = named.second;
+            auto task = std::make_shared<Task>([&, network] {
+                ASSERT_NE(nullptr, MultiWorkerTaskExecutor::ptrContext.ptrGraph);
+                std::lock_guard<std::mutex> lock(mutex);
+                order.push_back(network);
+            });
+            ASSERT_TRUE(executor->startTask(task));
+            tasks.push_back(task);
+        }
+    }
+    isReleased = 1;
+    for (auto& task : tasks)
+        task->wait(IInferRequest::WaitMode::RESULT_READY);
+
+    // the light network is served by a quarter of the requests while both of them are busy
+    int heavyServed = 0;
+    for (size_t i = 0; i < 40; i++)
+        heavyServed += order[i] == "heavy";
+    ASSERT_GE(heavyServed, 28);
+    ASSERT_LE(heavyServed, 32);
+    ASSERT_EQ(80, order.size());
+}
+
+TEST_F(MKLDNNSharedStreamsTest, streamBecomingIdleRunsRequestOfAnotherNetwork) {
+    auto pool = std::make_shared<SharedStreamsPool>(2, 1, false);
+    auto first = std::make_shared<SharedStreamsExecutor>(pool, "first", 1, createGraphs(2));
+    auto second = std::make_shared<SharedStreamsExecutor>(pool, "second", 1, createGraphs(1));
+
+    // both streams are kept busy by the requests of the first network
+    std::atomic<int> started(0);
+    std::atomic<int> isReleased[2] = {{0}, {0}};
+    std::thread::id streams[2];
+    std::vector<Task::Ptr> tasks;
+    for (int i = 0; i < 2; i++) {
+        auto task = std::make_shared<Task>([&, i] {
+            streams[i] = std::this_thread::get_id();
+            started++;
+            waitFor(isReleased[i], 1);
+        });
+        ASSERT_TRUE(first->startTask(task));
+        tasks.push_back(task);
+    }
+    ASSERT_TRUE(waitFor(started, 2));
+
+    // the request of the second network is taken by the stream released by the first network
+    std::thread::id stream;
+    auto task = std::make_shared<Task>([&] { stream = std::this_thread::get_id(); });
+    ASSERT_TRUE(second->startTask(task));
+    isReleased[0] = 1;
+    ASSERT_EQ(Task::TS_DONE, task->wait(10000));
+    ASSERT_EQ(streams[0], stream);
+    ASSERT_NE(streams[1], stream);
+
+    isReleased[1] = 1;
+    for (auto& task : tasks)
+        task->wait(IInferRequest::WaitMode::RESULT_READY);
+}
+
+TEST_F(MKLDNNSharedStreamsTest, decisionsArePrintedForNetworkWithDebugLog) {
+    auto pool = std::make_shared<SharedStreamsPool>(1, 1, false);
+    auto logged = std::make_shared<SharedStreamsExecutor>(pool, "logged", 2, createGraphs(1), true);
+    auto quiet = std::make_shared<SharedStreamsExecutor>(pool, "quiet", 1, createGraphs(1));
+
+    testing::internal::CaptureStdout();
+    for (auto& executor : {logged, quiet, logged}) {
+        auto task = std::make_shared<Task>([] {});
+        ASSERT_TRUE(executor->startTask(task));
+        task->wait(IInferRequest::WaitMode::RESULT_READY);
+    }
+    std::string log = testing::internal::GetCapturedStdout();
+
+    ASSERT_NE(std::string::npos, log.find("network logged: shared stream=0/1 cpus=any weight=2 queued=0 dispatched=1\n"));
+    ASSERT_NE(std::string::npos, log.find("network logged: shared stream=0/1 cpus=any weight=2 queued=0 dispatched=2\n"));
+    ASSERT_EQ(std::string::npos, log.find("quiet"));
+}
+
+TEST_F(MKLDNNSharedStreamsTest, graphsLimitRequestsOfNetworkRunAtOnce) {
+    auto pool = std::make_shared<SharedStreamsPool>(2, 1, false);
+    auto executor = std::make_shared<SharedStreamsExecutor>(pool, "network", 1, createGraphs(1));
+
+    std::atomic<int> running(0);
+    std::atomic<int> maxRunning(0);
+    std::vector<Task::Ptr> tasks;
+    for (int i = 0; i < 20; i++) {
+        auto task = std::make_shared<Task>([&] {
+            int now = ++running;
+            if (now > maxRunning)
+                maxRunning = now;
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            running--;
+        });
+        ASSERT_TRUE(executor->startTask(task));
+        tasks.push_back(task);
+    }
+    for (auto& task : tasks)
+        task->wait(IInferRequest::WaitMode::RESULT_READY);
+    ASSERT_EQ(1, maxRunning);
+}
+
+TEST_F(MKLDNNSharedStreamsTest, processPoolIsKeptWhileNetworksUseIt) {
+    auto pool = SharedStreamsPool::get(2, 1, false);
+    ASSERT_EQ(pool, SharedStreamsPool::get(4, 2, false));
+    ASSERT_EQ(2, pool->getStreamsCount());
+    ASSERT_EQ(1, pool->getThreadsPerStream());
+}
@@ -0,0 +1,130 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "mkldnn_plugin/mkldnn_topology.h"
+
+#if defined(__linux__)
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace MKLDNNPlugin;
+
+class MKLDNNTopologyTest : public ::testing::Test {
+protected:
+#if defined(__linux__)
+    std::string root;
+
+    void writeFile(const std::string& path, const std::string& content) {
+        size_t pos = 0;
+        // create the parent directories
+        while ((pos = path.find('/', pos + 1)) != std::string::npos) {
+            mkdir((root + path.substr(0, pos)).c_str(), 0755);
+        }
+        std::ofstream file(root + path);
+        file << content << std::endl;
+    }
+
+    // two sockets with a NUMA node, two cores and two threads per core each
+    void SetUp() override {
+        char templ[] = "/tmp/mkldnn_topology_XXXXXX";
+        ASSERT_NE(nullptr, mkdtemp(templ));
+        root = templ;
+        writeFile("/node/online", "0-1");
+        writeFile("/node/node0/cpulist", "0-3");
+        writeFile("/node/node1/cpulist", "4-7");
+        for (int cpu = 0; cpu < 8; cpu++) {
+            std::string path = "/cpu/cpu" + std::to_string(cpu);
+            int socket = cpu / 4;
+            int core = cpu % 2;
+            int first = socket * 4 + core;
+            writeFile(path + "/topology/physical_package_id", std::to_string(socket));
+            writeFile(path + "/topology/core_id", std::to_string(core));
+            writeFile(path + "/topology/thread_siblings_list", std::to_string(first) + "," + std::to_string(first + 2));
+            writeFile(path + "/cache/index0/level", "1");
+            writeFile(path + "/cache/index0/type", "Data");
+            writeFile(path + "/cache/index0/size", "32K");
+            writeFile(path + "/cache/index0/shared_cpu_list", std::to_string(first) + "," + std::to_string(first + 2));
+            writeFile(path + "/cache/index1/level", "1");
+            writeFile(path + "/cache/index1/type", "Instruction");
+            writeFile(path + "/cache/index1/size", "64K");
+            writeFile(path + "/cache/index1/shared_cpu_list", std::to_string(first) + "," + std::to_string(first + 2));
+            writeFile(path + "/cache/index2/level", "2");
+            writeFile(path + "/cache/index2/type", "Unified");
+            writeFile(path + "/cache/index2/size", "1024K");
+            writeFile(path + "/cache/index2/shared_cpu_list", std::to_string(first) + "," + std::to_string(first + 2));
+            writeFile(path + "/cache/index3/level", "3");
+            writeFile(path + "/cache/index3/type", "Unified");
+            writeFile(path + "/cache/index3/size", "8192K");
+            writeFile(path + "/cache/index3/shared_cpu_list", socket ? "4-7" : "0-3");
+        }
+    }
+
+    void TearDown() override {
+        std::string command = "rm -rf " + root;
+        ASSERT_EQ(0, std::system(command.c_str()));
+    }
+#endif
+};
+
+TEST_F(MKLDNNTopologyTest, ProcessorsListIsParsedAndFormatted) {
+    std::vector<int> expected = {0, 1, 2, 3, 8, 10, 11};
+    ASSERT_EQ(expected, parse_processors_list("0-3,8,10-11"));
+    ASSERT_EQ("0-3,8,10-11", format_processors_list({11, 0, 1, 2, 3, 8, 10}));
+    ASSERT_EQ("", format_processors_list({}));
+}
+
+#if defined(__linux__)
+TEST_F(MKLDNNTopologyTest, SocketsCoresNodesAndCachesAreRead) {
+    CpuTopology topology({0, 1, 2, 3, 4, 5, 6, 7}, root);
+    ASSERT_EQ(2, topology.getSocketsCount());
+    ASSERT_EQ(4, topology.getCoresCount());
+    ASSERT_EQ(2, topology.getNodesCount());
+    ASSERT_EQ(32 * 1024, topology.getCacheSize(2, 1));
+    ASSERT_EQ(1024 * 1024, topology.getCacheSize(0, 2));
+    ASSERT_EQ(8192 * 1024, topology.getCacheSize(5, 3));
+    // one L1 data, one L2 per core and one L3 per socket
+    ASSERT_EQ(4 + 4 + 2, topology.getCaches().size());
+}
+
+TEST_F(MKLDNNTopologyTest, StreamsAreConfinedToNodesAndPopulatePhysicalCoresFirst) {
+    CpuTopology topology({0, 1, 2, 3, 4, 5, 6, 7}, root);
+    auto placements = topology.placeStreams(4, 2);
+    ASSERT_EQ(4, placements.size());
+    ASSERT_EQ(0, placements[0].node);
+    ASSERT_EQ(std::vector<int>({0, 1}), placements[0].processors);
+    ASSERT_EQ(0, placements[1].node);
+    ASSERT_EQ(std::vector<int>({2, 3}), placements[1].processors);
+    ASSERT_EQ(1, placements[2].node);
+    ASSERT_EQ(std::vector<int>({4, 5}), placements[2].processors);
+    ASSERT_EQ(1, placements[3].node);
+    ASSERT_EQ(std::vector<int>({6, 7}), placements[3].processors);
+    ASSERT_EQ("node=0 cpus=0-1 l2=1024K l3=8192K", topology.toString(placements[0]));
+}
+
+TEST_F(MKLDNNTopologyTest, OddNumberOfStreamsIsBalancedOverNodes) {
+    CpuTopology topology({0, 1, 2, 3, 4, 5, 6, 7}, root);
+    auto placements = topology.placeStreams(3, 2);
+    ASSERT_EQ(3, placements.size());
+    ASSERT_EQ(0, placements[0].node);
+    ASSERT_EQ(0, placements[1].node);
+    ASSERT_EQ(1, placements[2].node);
+    ASSERT_EQ(std::vector<int>({4, 5}), placements[2].processors);
+}
+
+TEST_F(MKLDNNTopologyTest, ProcessorsOutsideOfTheMaskAreNotUsed) {
+    CpuTopology topology({4, 5, 6, 7}, root);
+    auto placements = topology.placeStreams(2, 4);
+    ASSERT_EQ(2, placements.size());
+    for (auto& placement : placements) {
+        ASSERT_EQ(1, placement.node);
+        ASSERT_EQ(std::vector<int>({4, 5, 6, 7}), placement.processors);
+    }
+}
+#endif
@@ -216,3 +216,38 @@ TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailed
     testRequest->StartAsync();
     EXPECT_THROW(testRequest->Wait(IInferRequest::WaitMode::RESULT_READY), std::exception);
 }
+
+// back-to-back requests are taken by the executors either after a wakeup (no spinning) or while they spin
+TEST_F(InferRequestThreadSafeDefaultTests, backToBackRequestsCompleteWithAndWithoutSpinning) {
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).WillRepeatedly(Return());
+    for (auto spinTime : {std::chrono::microseconds(0), std::chrono::microseconds(TaskExecutor::defaultSpinTimeUs)}) {
+        auto taskExecutor = std::make_shared<TaskExecutor>("Request", spinTime);
+        auto callbackExecutor = std::make_shared<TaskExecutor>("Callback", spinTime);
+        testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                          make_shared<TaskSynchronizer>(),
+                                                                          callbackExecutor);
+        IInferRequest::Ptr asyncRequest;
+        asyncRequest.reset(new InferRequestBase<TestAsyncInferRequestThreadSafeDefault>(
+                testRequest), [](IInferRequest *p) { p->Release(); });
+        testRequest->SetPointerToPublicInterface(asyncRequest);
+
+        static std::atomic<size_t> callbacks;
+        callbacks = 0;
+        testRequest->SetCompletionCallback([](InferenceEngine::IInferRequest::Ptr request, StatusCode status) {
+            if (status == OK)
+                callbacks++;
+        });
+
+        const size_t iterations = 500;
+        for (size_t i = 0; i < iterations; i++) {
+            testRequest->StartAsync();
+            ASSERT_EQ(OK, testRequest->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY))
+                << "spin " << spinTime.count() << " us, request " << i;
+        }
+        testRequest = nullptr;
+        asyncRequest = nullptr;
+        taskExecutor = nullptr;
+        callbackExecutor = nullptr;
+        ASSERT_EQ(iterations, callbacks) << "spin " << spinTime.count() << " us";
+    }
+}
@@ -0,0 +1,163 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include <thread>
+#include <set>
+#include <future>
+#include <atomic>
+#include <inference_engine.hpp>
+#include <cpp_interfaces/impl/mock_infer_request_internal.hpp>
+#include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+#include <cpp_interfaces/base/ie_infer_async_request_base.hpp>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+class CompletionQueueTests : public ::testing::Test {
+protected:
+    ITaskExecutor::Ptr taskExecutor;
+    ITaskExecutor::Ptr callbackExecutor;
+    vector<shared_ptr<MockInferRequestInternal>> syncRequests;
+
+    virtual void SetUp() {
+        taskExecutor = make_shared<TaskExecutor>("Request");
+        callbackExecutor = make_shared<TaskExecutor>("Callback");
+    }
+
+    InferRequest createRequest(bool fails = false) {
+        return createRequest([fails] {
+            if (fails)
+                throw std::exception();
+        });
+    }
+
+    InferRequest createRequest(const function<void()> &infer) {
+        auto syncRequest = make_shared<MockInferRequestInternal>(InputsDataMap(), OutputsDataMap());
+        EXPECT_CALL(*syncRequest, InferImpl()).WillRepeatedly(Invoke(infer));
+        syncRequests.push_back(syncRequest);
+
+        auto asyncRequest = make_shared<AsyncInferRequestThreadSafeDefault>(syncRequest, taskExecutor,
+                                                                            make_shared<TaskSynchronizer>(),
+                                                                            callbackExecutor);
+        IInferRequest::Ptr request;
+        request.reset(new InferRequestBase<AsyncInferRequestThreadSafeDefault>(asyncRequest),
+                      [](IInferRequest *p) { p->Release(); });
+        asyncRequest->SetPointerToPublicInterface(request);
+        return InferRequest(request);
+    }
+};
+
+TEST_F(CompletionQueueTests, deliversCompletionsOfAllRequestsWithTags) {
+    CompletionQueue queue;
+    vector<int> tags(8);
+    vector<InferRequest> requests;
+    for (size_t i = 0; i < tags.size(); i++) {
+        requests.push_back(createRequest());
+        queue.StartAsync(requests.back(), &tags[i]);
+    }
+
+    // every request is restarted from the thread taking the completions
+    set<void *> seen;
+    CompletionQueue::Completion completion;
+    for (size_t i = 0; i < 2 * tags.size(); i++) {
+        ASSERT_TRUE(queue.Next(completion));
+        ASSERT_EQ(OK, completion.status);
+        if (i < tags.size())
+            queue.StartAsync(completion.request, completion.tag);
+        seen.insert(completion.tag);
+    }
+    ASSERT_EQ(tags.size(), seen.size());
+    ASSERT_EQ(0, queue.Pending());
+    ASSERT_FALSE(queue.TryNext(completion));
+}
+
+TEST_F(CompletionQueueTests, requestsDoNotHaveToBeKeptByApplication) {
+    CompletionQueue queue;
+    int tag = 0;
+    {
+        InferRequest request = createRequest();
+        queue.StartAsync(request, &tag);
+    }
+    CompletionQueue::Completion completion;
+    ASSERT_TRUE(queue.Next(completion));
+    ASSERT_EQ(&tag, completion.tag);
+    queue.StartAsync(completion.request, &tag);
+    ASSERT_TRUE(queue.Next(completion));
+    ASSERT_EQ(&tag, completion.tag);
+}
+
+TEST_F(CompletionQueueTests, deliversFailedRequests) {
+    CompletionQueue queue;
+    InferRequest request = createRequest(true);
+    queue.StartAsync(request);
+
+    CompletionQueue::Completion completion;
+    ASSERT_TRUE(queue.Next(completion));
+    ASSERT_EQ(GENERAL_ERROR, completion.status);
+}
+
+TEST_F(CompletionQueueTests, nextReturnsFalseOnTimeout) {
+    CompletionQueue queue;
+    CompletionQueue::Completion completion;
+    ASSERT_FALSE(queue.TryNext(completion));
+    ASSERT_FALSE(queue.Next(completion, 10));
+}
+
+TEST_F(CompletionQueueTests, shutdownWakesWaitingThreads) {
+    CompletionQueue queue;
+    std::thread waiting([&queue] {
+        CompletionQueue::Completion completion;
+        ASSERT_FALSE(queue.Next(completion));
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    queue.Shutdown();
+    waiting.join();
+}
+
+TEST_F(CompletionQueueTests, destructionWaitsForInferencesInFlight) {
+    promise<void> release;
+    shared_future<void> released = release.get_future().share();
+    InferRequest request = createRequest([released] { released.wait(); });
+
+    unique_ptr<CompletionQueue> queue(new CompletionQueue());
+    queue->StartAsync(request);
+    atomic<bool> destroyed(false);
+    std::thread destroying([&] {
+        queue.reset();
+        destroyed = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_FALSE(destroyed);
+
+    release.set_value();
+    destroying.join();
+    ASSERT_TRUE(destroyed);
+
+    // the callback of the queue is left set to the request, it does nothing once the queue is destroyed
+    request.StartAsync();
+    ASSERT_EQ(OK, request.Wait(IInferRequest::WaitMode::RESULT_READY));
+}
+
+TEST_F(CompletionQueueTests, destructionRightAfterLastNextReleasesRequestsOnTheCallingThread) {
+    for (int i = 0; i < 200; i++) {
+        weak_ptr<IInferRequest> released;
+        {
+            CompletionQueue queue;
+            {
+                InferRequest request = createRequest();
+                IInferRequest::Ptr &actual = request;
+                released = actual;
+                queue.StartAsync(request);
+            }
+            CompletionQueue::Completion completion;
+            ASSERT_TRUE(queue.Next(completion));
+        }
+        // the queue kept the only reference, it is released by the destructor rather than by a late callback
+        ASSERT_TRUE(released.expired()) << "iteration " << i;
+    }
+}
@@ -87,3 +87,19 @@ TEST_F(ExecutableNetworkBaseTests, canCatchUnknownErrorInGetMappedTopology) {
     std::map<std::string, std::vector<PrimitiveInfo::Ptr>> deployedTopology;
     ASSERT_EQ(UNEXPECTED, exeNetwork->GetMappedTopology(deployedTopology, nullptr));
 }
+
+// GetMetrics
+TEST_F(ExecutableNetworkBaseTests, canForwardGetMetricsThroughQueriedInterface) {
+    auto metrics = dynamic_cast<IMetricsExecutableNetwork *>(exeNetwork.get());
+    ASSERT_NE(nullptr, metrics);
+    ExecutableNetworkMetrics result;
+    EXPECT_CALL(*mock_impl.get(), GetMetrics(Ref(result), true)).Times(1);
+    ASSERT_EQ(OK, metrics->GetMetrics(result, true, &dsc));
+}
+
+TEST_F(ExecutableNetworkBaseTests, canReportErrorInGetMetrics) {
+    EXPECT_CALL(*mock_impl.get(), GetMetrics(_, _)).WillOnce(Throw(std::runtime_error("compare")));
+    ExecutableNetworkMetrics result;
+    ASSERT_NE(OK, dynamic_cast<IMetricsExecutableNetwork &>(*exeNetwork).GetMetrics(result, false, &dsc));
+    ASSERT_STREQ(dsc.msg, "compare");
+}
@@ -16,6 +16,11 @@ using namespace std;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+class MockIMetricsExecutableNetwork : public MockIExecutableNetwork, public IMetricsExecutableNetwork {
+public:
+    MOCK_QUALIFIED_METHOD3(GetMetrics, noexcept, StatusCode(ExecutableNetworkMetrics &, bool, ResponseDesc*));
+};
+
 class ExecutableNetworkTests : public ::testing::Test {
 protected:
     std::shared_ptr<MockIExecutableNetwork> mock_exe_network;
@@ -60,3 +65,25 @@ TEST_F(ExecutableNetworkTests, throwsIfCreateInferRequestPtrReturnNotOK) {
     EXPECT_CALL(*mock_exe_network.get(), CreateInferRequest(_, _)).WillOnce(Return(GENERAL_ERROR));
     ASSERT_THROW(exeNetworkWrapper.CreateInferRequest(), InferenceEngineException);
 }
+
+// GetMetrics
+TEST_F(ExecutableNetworkTests, throwsNotImplementedIfGetMetricsIsNotSupported) {
+    ASSERT_THROW(exeNetworkWrapper.GetMetrics(), NotImplemented);
+}
+
+TEST_F(ExecutableNetworkTests, canForwardGetMetrics) {
+    auto mock_metrics_network = make_shared<MockIMetricsExecutableNetwork>();
+    ExecutableNetworkMetrics expected;
+    expected.requests = 3;
+    EXPECT_CALL(*mock_metrics_network.get(), GetMetrics(_, true, _))
+            .WillOnce(DoAll(SetArgReferee<0>(expected), Return(OK)));
+    ExecutableNetwork wrapper(mock_metrics_network);
+    ASSERT_EQ(3u, wrapper.GetMetrics(true).requests);
+}
+
+TEST_F(ExecutableNetworkTests, throwsIfGetMetricsReturnNotOK) {
+    auto mock_metrics_network = make_shared<MockIMetricsExecutableNetwork>();
+    EXPECT_CALL(*mock_metrics_network.get(), GetMetrics(_, _, _)).WillOnce(Return(GENERAL_ERROR));
+    ExecutableNetwork wrapper(mock_metrics_network);
+    ASSERT_THROW(wrapper.GetMetrics(), InferenceEngineException);
+}
@@ -6,6 +6,7 @@
 #include <cpp_interfaces/impl/mock_executable_thread_safe_default.hpp>
 #include <cpp_interfaces/impl/mock_infer_request_internal.hpp>
 #include <cpp_interfaces/base/ie_executable_network_base.hpp>
+#include <cpp_interfaces/ie_executor_manager.hpp>
 
 using namespace ::testing;
 using namespace std;
@@ -62,3 +63,18 @@ TEST_F(ExecutableNetworkThreadSafeTests, returnErrorIfStartAsyncThrowsException)
     EXPECT_NO_THROW(sts = req->Wait(IInferRequest::WaitMode::RESULT_READY, &dsc));
     ASSERT_EQ(StatusCode::GENERAL_ERROR, sts) << dsc.msg;
 }
+
+TEST_F(ExecutableNetworkThreadSafeTests, executorsSpinForTheTimeOfExecutorManager) {
+    struct TestExecutableNetwork : public MockExecutableNetworkThreadSafe {
+        using MockExecutableNetworkThreadSafe::_taskExecutor;
+        using MockExecutableNetworkThreadSafe::_callbackExecutor;
+    };
+    auto manager = ExecutorManager::getInstance();
+    auto spinTime = manager->getSpinTime();
+    manager->setSpinTime(std::chrono::microseconds(7));
+    TestExecutableNetwork network;
+    manager->setSpinTime(spinTime);
+
+    ASSERT_EQ(7, dynamic_pointer_cast<TaskExecutor>(network._taskExecutor)->getSpinTime().count());
+    ASSERT_EQ(7, dynamic_pointer_cast<TaskExecutor>(network._callbackExecutor)->getSpinTime().count());
+}
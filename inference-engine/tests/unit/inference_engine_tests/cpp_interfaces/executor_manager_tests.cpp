@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 #include <cpp_interfaces/ie_executor_manager.hpp>
+#include <cpp_interfaces/ie_task_executor.hpp>
 #include <ie_device.hpp>
 
 using namespace ::testing;
@@ -46,3 +47,20 @@ TEST_F(ExecutorManagerTests, returnTheSameExecutorForTheSameDevice) {
     ASSERT_EQ(executor, executor2);
     ASSERT_EQ(2, _manager.getExecutorsNumber());
 }
+
+TEST_F(ExecutorManagerTests, executorsSpinForTheDefaultTime) {
+    auto executor = dynamic_pointer_cast<TaskExecutor>(_manager.getExecutor(TargetDeviceInfo::name(TargetDevice::eCPU)));
+
+    ASSERT_NE(nullptr, executor);
+    ASSERT_EQ(TaskExecutor::defaultSpinTimeUs, executor->getSpinTime().count());
+}
+
+TEST_F(ExecutorManagerTests, executorsCreatedAfterSetSpinTimeSpinForIt) {
+    auto before = dynamic_pointer_cast<TaskExecutor>(_manager.getExecutor(TargetDeviceInfo::name(TargetDevice::eCPU)));
+    _manager.setSpinTime(std::chrono::microseconds(0));
+    auto after = dynamic_pointer_cast<TaskExecutor>(_manager.getExecutor(TargetDeviceInfo::name(TargetDevice::eGPU)));
+
+    ASSERT_EQ(0, _manager.getSpinTime().count());
+    ASSERT_EQ(TaskExecutor::defaultSpinTimeUs, before->getSpinTime().count());
+    ASSERT_EQ(0, after->getSpinTime().count());
+}
@@ -0,0 +1,252 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <inference_engine.hpp>
+#include <cpp_interfaces/impl/ie_infer_request_coalescer.hpp>
+#include <cpp_interfaces/interface/mock_iasync_infer_request_internal.hpp>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+class InferRequestCoalescerTests : public ::testing::Test {
+protected:
+    static constexpr size_t itemSize = 4;
+    static constexpr std::chrono::microseconds noTimeout = std::chrono::hours(1);
+
+    shared_ptr<NiceMock<MockIAsyncInferRequestInternal>> batchedRequest;
+    Blob::Ptr batchedInput;
+    Blob::Ptr batchedOutput;
+    int batch = 0;
+
+    // the batched request multiplies the items of the batch by 10
+    void SetUpBatchedRequest(size_t batchLimit) {
+        batchedRequest = make_shared<NiceMock<MockIAsyncInferRequestInternal>>();
+        batchedInput = make_shared_blob<float>(TensorDesc(Precision::FP32, {batchLimit, itemSize}, Layout::NC));
+        batchedInput->allocate();
+        batchedOutput = make_shared_blob<float>(TensorDesc(Precision::FP32, {batchLimit, itemSize}, Layout::NC));
+        batchedOutput->allocate();
+        ON_CALL(*batchedRequest, GetBlob(StrEq("in"), _)).WillByDefault(SetArgReferee<1>(batchedInput));
+        ON_CALL(*batchedRequest, GetBlob(StrEq("out"), _)).WillByDefault(SetArgReferee<1>(batchedOutput));
+        ON_CALL(*batchedRequest, SetBatch(_)).WillByDefault(Invoke([this](int b) { batch = b; }));
+        ON_CALL(*batchedRequest, StartAsync()).WillByDefault(Invoke([this]() {
+            auto src = batchedInput->buffer().as<float *>();
+            auto dst = batchedOutput->buffer().as<float *>();
+            for (size_t i = 0; i < batch * itemSize; i++)
+                dst[i] = src[i] * 10;
+        }));
+        ON_CALL(*batchedRequest, Wait(_)).WillByDefault(Return(OK));
+    }
+
+    InferRequestCoalescer::Ptr createCoalescer(size_t batchLimit, std::chrono::microseconds timeout) {
+        SetUpBatchedRequest(batchLimit);
+        return make_shared<InferRequestCoalescer>(std::vector<IAsyncInferRequestInternal::Ptr>{batchedRequest},
+                                                  batchLimit, timeout);
+    }
+
+    static Blob::Ptr createItemBlob(float value, Precision precision = Precision::FP32, Layout layout = Layout::NC) {
+        Blob::Ptr blob = make_blob_with_precision(TensorDesc(precision, {1, itemSize}, layout));
+        blob->allocate();
+        auto data = blob->buffer().as<float *>();
+        for (size_t i = 0; i < itemSize; i++)
+            data[i] = value + i;
+        return blob;
+    }
+
+    static void checkItemOutput(const BlobMap &outputs, float inputValue) {
+        auto data = outputs.at("out")->cbuffer().as<const float *>();
+        for (size_t i = 0; i < itemSize; i++)
+            ASSERT_FLOAT_EQ((inputValue + i) * 10, data[i]);
+    }
+};
+
+constexpr size_t InferRequestCoalescerTests::itemSize;
+constexpr std::chrono::microseconds InferRequestCoalescerTests::noTimeout;
+
+TEST_F(InferRequestCoalescerTests, throwsOnNoRequests) {
+    ASSERT_THROW(InferRequestCoalescer({}, 2, std::chrono::microseconds(100)), InferenceEngineException);
+}
+
+TEST_F(InferRequestCoalescerTests, flushesIncompleteBatchOnTimeout) {
+    auto coalescer = createCoalescer(4, std::chrono::milliseconds(1));
+    EXPECT_CALL(*batchedRequest, SetBatch(1)).Times(1);
+
+    BlobMap inputs = {{"in", createItemBlob(1)}};
+    BlobMap outputs = {{"out", createItemBlob(0)}};
+    ASSERT_NO_THROW(coalescer->Infer(inputs, outputs));
+    checkItemOutput(outputs, 1);
+}
+
+TEST_F(InferRequestCoalescerTests, flushesFullBatchWithoutTimeout) {
+    auto coalescer = createCoalescer(2, noTimeout);
+    EXPECT_CALL(*batchedRequest, SetBatch(2)).Times(1);
+
+    BlobMap inputs[] = {{{"in", createItemBlob(1)}}, {{"in", createItemBlob(2)}}};
+    BlobMap outputs[] = {{{"out", createItemBlob(0)}}, {{"out", createItemBlob(0)}}};
+    auto first = std::async(std::launch::async, [&] { coalescer->Infer(inputs[0], outputs[0]); });
+    ASSERT_NO_THROW(coalescer->Infer(inputs[1], outputs[1]));
+    ASSERT_NO_THROW(first.get());
+}
+
+TEST_F(InferRequestCoalescerTests, scattersOutputsToTheirCallers) {
+    const size_t items = 3;
+    auto coalescer = createCoalescer(items, noTimeout);
+    EXPECT_CALL(*batchedRequest, SetBatch(items)).Times(1);
+
+    std::vector<BlobMap> inputs, outputs;
+    for (size_t n = 0; n < items; n++) {
+        inputs.push_back({{"in", createItemBlob(100.f * (n + 1))}});
+        outputs.push_back({{"out", createItemBlob(0)}});
+    }
+    std::vector<std::future<void>> callers;
+    for (size_t n = 0; n < items; n++)
+        callers.push_back(std::async(std::launch::async, [&, n] { coalescer->Infer(inputs[n], outputs[n]); }));
+    for (size_t n = 0; n < items; n++) {
+        ASSERT_NO_THROW(callers[n].get());
+        checkItemOutput(outputs[n], 100.f * (n + 1));
+    }
+}
+
+TEST_F(InferRequestCoalescerTests, propagatesErrorToAllCallersOfBatch) {
+    auto coalescer = createCoalescer(2, noTimeout);
+    EXPECT_CALL(*batchedRequest, Wait(_)).WillOnce(Return(GENERAL_ERROR));
+
+    BlobMap inputs[] = {{{"in", createItemBlob(1)}}, {{"in", createItemBlob(2)}}};
+    BlobMap outputs[] = {{{"out", createItemBlob(0)}}, {{"out", createItemBlob(0)}}};
+    auto first = std::async(std::launch::async, [&] { coalescer->Infer(inputs[0], outputs[0]); });
+    ASSERT_THROW(coalescer->Infer(inputs[1], outputs[1]), InferenceEngineException);
+    ASSERT_THROW(first.get(), InferenceEngineException);
+}
+
+TEST_F(InferRequestCoalescerTests, propagatesExceptionOfBatchedRequest) {
+    auto coalescer = createCoalescer(1, noTimeout);
+    EXPECT_CALL(*batchedRequest, StartAsync())
+            .WillOnce(Throw(InferenceEngineException(__FILE__, __LINE__)))
+            .WillRepeatedly(DoDefault());
+
+    BlobMap inputs = {{"in", createItemBlob(1)}};
+    BlobMap outputs = {{"out", createItemBlob(0)}};
+    ASSERT_THROW(coalescer->Infer(inputs, outputs), InferenceEngineException);
+    // the worker is not broken by the failed batch
+    ASSERT_NO_THROW(coalescer->Infer(inputs, outputs));
+    checkItemOutput(outputs, 1);
+}
+
+TEST_F(InferRequestCoalescerTests, throwsOnItemOfOtherPrecision) {
+    auto coalescer = createCoalescer(1, noTimeout);
+    EXPECT_CALL(*batchedRequest, StartAsync()).Times(0);
+
+    // I32 item has the same size as FP32 slot, it must not be copied as is
+    BlobMap inputs = {{"in", createItemBlob(1, Precision::I32)}};
+    BlobMap outputs = {{"out", createItemBlob(0)}};
+    ASSERT_THROW(coalescer->Infer(inputs, outputs), InferenceEngineException);
+}
+
+TEST_F(InferRequestCoalescerTests, throwsOnItemOfOtherLayout) {
+    auto coalescer = createCoalescer(1, noTimeout);
+    EXPECT_CALL(*batchedRequest, StartAsync()).Times(0);
+
+    BlobMap inputs = {{"in", createItemBlob(1, Precision::FP32, Layout::CN)}};
+    BlobMap outputs = {{"out", createItemBlob(0)}};
+    ASSERT_THROW(coalescer->Infer(inputs, outputs), InferenceEngineException);
+}
+
+TEST_F(InferRequestCoalescerTests, completesItemsQueuedAsync) {
+    auto coalescer = createCoalescer(2, noTimeout);
+    EXPECT_CALL(*batchedRequest, SetBatch(2)).Times(1);
+
+    BlobMap inputs[] = {{{"in", createItemBlob(1)}}, {{"in", createItemBlob(2)}}};
+    BlobMap outputs[] = {{{"out", createItemBlob(0)}}, {{"out", createItemBlob(0)}}};
+    std::promise<std::exception_ptr> completions[2];
+    // the callers do not wait for the batch, both items are completed by the worker
+    for (int n = 0; n < 2; n++)
+        coalescer->StartAsync(inputs[n], outputs[n], [&completions, n](std::exception_ptr error) {
+            completions[n].set_value(error);
+        });
+    for (int n = 0; n < 2; n++) {
+        ASSERT_EQ(nullptr, completions[n].get_future().get());
+        checkItemOutput(outputs[n], n + 1);
+    }
+}
+
+class CoalescedAsyncInferRequestTests : public InferRequestCoalescerTests {
+protected:
+    DataPtr inputData = make_shared<Data>("in", TensorDesc(Precision::FP32, {1, itemSize}, Layout::NC));
+    DataPtr outputData = make_shared<Data>("out", TensorDesc(Precision::FP32, {1, itemSize}, Layout::NC));
+    InputsDataMap networkInputs;
+    OutputsDataMap networkOutputs;
+
+    void SetUp() override {
+        auto inputInfo = make_shared<InputInfo>();
+        inputInfo->setInputData(inputData);
+        networkInputs["in"] = inputInfo;
+        networkOutputs["out"] = outputData;
+    }
+
+    CoalescedAsyncInferRequest::Ptr createRequest(const InferRequestCoalescer::Ptr &coalescer) {
+        auto request = make_shared<CoalescedInferRequest>(networkInputs, networkOutputs, coalescer);
+        return make_shared<CoalescedAsyncInferRequest>(request, make_shared<TaskExecutor>());
+    }
+
+    static void fillInput(const CoalescedAsyncInferRequest::Ptr &request, float value) {
+        Blob::Ptr input;
+        request->GetBlob("in", input);
+        auto data = input->buffer().as<float *>();
+        for (size_t i = 0; i < itemSize; i++)
+            data[i] = value + i;
+    }
+
+    static void checkOutput(const CoalescedAsyncInferRequest::Ptr &request, float inputValue) {
+        Blob::Ptr output;
+        request->GetBlob("out", output);
+        checkItemOutput({{"out", output}}, inputValue);
+    }
+};
+
+TEST_F(CoalescedAsyncInferRequestTests, asyncRequestsAreBatched) {
+    auto coalescer = createCoalescer(2, noTimeout);
+    EXPECT_CALL(*batchedRequest, SetBatch(2)).Times(1);
+
+    CoalescedAsyncInferRequest::Ptr requests[] = {createRequest(coalescer), createRequest(coalescer)};
+    for (int n = 0; n < 2; n++) {
+        fillInput(requests[n], n + 1);
+        requests[n]->StartAsync();
+    }
+    for (int n = 0; n < 2; n++) {
+        ASSERT_EQ(OK, requests[n]->Wait(IInferRequest::WaitMode::RESULT_READY));
+        checkOutput(requests[n], n + 1);
+    }
+}
+
+TEST_F(CoalescedAsyncInferRequestTests, asyncRequestGetsErrorOfBatch) {
+    auto coalescer = createCoalescer(1, noTimeout);
+    EXPECT_CALL(*batchedRequest, Wait(_)).WillOnce(Return(GENERAL_ERROR)).WillRepeatedly(Return(OK));
+
+    auto request = createRequest(coalescer);
+    fillInput(request, 1);
+    request->StartAsync();
+    ASSERT_THROW(request->Wait(IInferRequest::WaitMode::RESULT_READY), InferenceEngineException);
+    // the request is reusable after the failure
+    request->StartAsync();
+    ASSERT_EQ(OK, request->Wait(IInferRequest::WaitMode::RESULT_READY));
+    checkOutput(request, 1);
+}
+
+TEST_F(CoalescedAsyncInferRequestTests, syncInferIsBatched) {
+    auto coalescer = createCoalescer(1, noTimeout);
+    EXPECT_CALL(*batchedRequest, SetBatch(1)).Times(1);
+
+    auto request = createRequest(coalescer);
+    fillInput(request, 3);
+    ASSERT_NO_THROW(request->Infer());
+    checkOutput(request, 3);
+}
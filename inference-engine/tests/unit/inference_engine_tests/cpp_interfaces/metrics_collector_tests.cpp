@@ -0,0 +1,108 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <cpp_interfaces/ie_metrics_collector.hpp>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+class MetricsCollectorTests : public ::testing::Test {};
+
+TEST_F(MetricsCollectorTests, smallDurationsAreCountedExactly) {
+    DurationCollector collector;
+    for (uint64_t us = 1; us <= 10; us++)
+        collector.add(us);
+
+    DurationMetric metric;
+    collector.get(metric, false);
+    ASSERT_EQ(10, metric.count);
+    ASSERT_EQ(55, metric.totalUs);
+    ASSERT_EQ(10, metric.maxUs);
+    ASSERT_EQ(5, metric.p50Us);
+    ASSERT_EQ(9, metric.p90Us);
+    ASSERT_EQ(10, metric.p99Us);
+}
+
+TEST_F(MetricsCollectorTests, logLinearBucketsKeepValuesWithBoundedRelativeError) {
+    using details::LogLinearBuckets;
+    for (unsigned bits : {2u, 3u, 7u}) {
+        size_t previous = 0;
+        for (uint64_t value : {uint64_t(0), uint64_t(1), uint64_t(15), uint64_t(16), uint64_t(1000), uint64_t(123456789),
+                               uint64_t(1) << 40, ~uint64_t(0)}) {
+            size_t index = LogLinearBuckets::index(value, bits);
+            ASSERT_LT(index, LogLinearBuckets::count(bits));
+            ASSERT_LE(previous, index);
+            previous = index;
+            uint64_t highest = LogLinearBuckets::highestEquivalent(index, bits);
+            ASSERT_GE(highest, value) << value << " with " << bits << " bits";
+            ASSERT_LE(highest - value, value >> bits) << value << " with " << bits << " bits";
+        }
+    }
+}
+
+TEST_F(MetricsCollectorTests, percentilesHaveBoundedRelativeError) {
+    DurationCollector collector;
+    for (uint64_t us = 1; us <= 100000; us++)
+        collector.add(us);
+
+    DurationMetric metric;
+    collector.get(metric, false);
+    ASSERT_EQ(100000, metric.maxUs);
+    // the reported value is never less than the exact one and exceeds it by 1/8 at most
+    ASSERT_GE(metric.p50Us, 50000);
+    ASSERT_LE(metric.p50Us, 50000 + 50000 / 8);
+    ASSERT_GE(metric.p99Us, 99000);
+    ASSERT_LE(metric.p99Us, 100000);
+}
+
+TEST_F(MetricsCollectorTests, resetStartsNewInterval) {
+    MetricsCollector collector(2);
+    collector.requests++;
+    collector.execution.add(100);
+    collector.inputCopyBytes += 64;
+    collector.addStreamBusy(1, 100);
+    // the streams that don't exist are ignored
+    collector.addStreamBusy(2, 100);
+
+    ExecutableNetworkMetrics metrics;
+    collector.get(metrics, true);
+    ASSERT_EQ(1, metrics.requests);
+    ASSERT_EQ(1, metrics.execution.count);
+    ASSERT_EQ(64, metrics.inputCopyBytes);
+    ASSERT_EQ(2, metrics.streamBusyUs.size());
+    ASSERT_EQ(0, metrics.streamBusyUs[0]);
+    ASSERT_EQ(100, metrics.streamBusyUs[1]);
+
+    collector.get(metrics, false);
+    ASSERT_EQ(0, metrics.requests);
+    ASSERT_EQ(0, metrics.execution.count);
+    ASSERT_EQ(0, metrics.execution.maxUs);
+    ASSERT_EQ(0, metrics.inputCopyBytes);
+    ASSERT_EQ(0, metrics.streamBusyUs[1]);
+}
+
+TEST_F(MetricsCollectorTests, concurrentUpdatesAreNotLost) {
+    MetricsCollector collector;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&collector, t] {
+            for (uint64_t i = 0; i < 10000; i++) {
+                collector.requests++;
+                collector.queueWait.add(i + t);
+            }
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    ExecutableNetworkMetrics metrics;
+    collector.get(metrics, false);
+    ASSERT_EQ(40000, metrics.requests);
+    ASSERT_EQ(40000, metrics.queueWait.count);
+    ASSERT_EQ(9999 + 3, metrics.queueWait.maxUs);
+}
@@ -223,3 +223,41 @@ TEST_F(TaskExecutorTests, callWaitOnTaskDtorIfProcessed) {
     isBlocked = false;
     cv_block_emulation.notify_all();
 }
+
+TEST_F(TaskExecutorTests, canRunMoreTasksThanQueueCapacityInOrder) {
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    std::vector<Task::Ptr> tasks;
+    std::vector<int> order;
+    for (int i = 0; i < 3000; i++) {
+        tasks.push_back(std::make_shared<Task>([&order, i]() { order.push_back(i); }));
+    }
+    for (auto &task : tasks) {
+        ASSERT_TRUE(taskExecutor->startTask(task));
+    }
+    for (auto &task : tasks) {
+        ASSERT_EQ(Task::Status::TS_DONE, task->wait(-1));
+    }
+    ASSERT_EQ(tasks.size(), order.size());
+    for (int i = 0; i < order.size(); i++) {
+        ASSERT_EQ(i, order[i]);
+    }
+}
+
+TEST_F(TaskExecutorTests, canRunTasksFromMultipleThreadsWithoutSpinning) {
+    auto taskExecutor = std::make_shared<TaskExecutor>("NoSpin", std::chrono::microseconds(0));
+    std::atomic<int> sharedVar(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < 1000; i++) {
+                auto task = std::make_shared<Task>([&sharedVar]() { sharedVar++; });
+                ASSERT_TRUE(taskExecutor->startTask(task));
+                // the executor parks between the tasks sometimes, so the wakeups are checked as well
+                if (i % 100 == 0) task->wait(-1);
+            }
+        });
+    }
+    for (auto &thread : threads) thread.join();
+    taskExecutor.reset();
+    ASSERT_EQ(4000, sharedVar);
+}
@@ -0,0 +1,468 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+
+#include <cnn_network_int8_normalizer.hpp>
+#include "tests_common.hpp"
+#include "ir_gen_helper.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <random>
+
+using namespace ::testing;
+using namespace single_layer_tests;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+struct asymmetric_input_params {
+    // Convolution or FullyConnected
+    std::string type;
+    // Formats: NC for FullyConnected, NCHW for Convolution
+    std::vector<size_t> in;
+    size_t out_c;
+    size_t group;
+    size_t kernel;
+};
+
+class NormalizationAsymmetricInputTests: public TestsCommon {
+protected:
+    // the steps of the normalizer are checked one by one
+    class Int8Normalizer : public CNNNetworkInt8Normalizer {
+    public:
+        using CNNNetworkInt8Normalizer::QuantizeConvolutionOrFullyConnected;
+        using CNNNetworkInt8Normalizer::isAsymmetricInputAllowed;
+        using CNNNetworkInt8Normalizer::AddScaleShiftBetween;
+        using CNNNetworkInt8Normalizer::PropagateScaleFactors;
+    };
+
+    std::string conv_t = R"V0G0N(
+        <layer id="1" name="layer" precision="FP32" type="Convolution">
+            <data group="_GC_" kernel="_K_,_K_" output="_OC_" pads_begin="_P_,_P_" pads_end="_P_,_P_" strides="1,1"/>
+            <input>
+                <port id="0">__INP_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="1">__OUT_DIMS__
+                </port>
+            </output>
+            <blobs>
+                <weights offset="0" size="_WS_"/>__BIASES__
+            </blobs>
+        </layer>
+)V0G0N";
+
+    std::string fc_t = R"V0G0N(
+        <layer id="1" name="layer" precision="FP32" type="FullyConnected">
+            <data out-size="_OC_"/>
+            <input>
+                <port id="0">__INP_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="1">__OUT_DIMS__
+                </port>
+            </output>
+            <blobs>
+                <weights offset="0" size="_WS_"/>__BIASES__
+            </blobs>
+        </layer>
+)V0G0N";
+
+    std::string edges_t = R"V0G0N(
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+)V0G0N";
+
+    static std::string dimsToString(const std::vector<size_t>& dims) {
+        std::string s_dims;
+        for (auto& dim : dims) {
+            s_dims += "\n                    <dim>";
+            s_dims += std::to_string(dim) + "</dim>";
+        }
+        return s_dims;
+    }
+
+    static std::vector<size_t> outDims(const asymmetric_input_params& p, size_t pad) {
+        std::vector<size_t> dims = {p.in[0], p.out_c};
+        for (size_t i = 2; i < p.in.size(); i++)
+            dims.push_back(p.in[i] + 2 * pad - p.kernel + 1);
+        return dims;
+    }
+
+    static size_t weightsSize(const asymmetric_input_params& p) {
+        return p.out_c * p.in[1] / p.group * p.kernel * p.kernel;
+    }
+
+    std::string getModel(const asymmetric_input_params& p, size_t pad = 0, bool withBiases = true) {
+        std::string model = p.type == "Convolution" ? conv_t : fc_t;
+        REPLACE_WITH_STR(model, "__INP_DIMS__", dimsToString(p.in));
+        REPLACE_WITH_STR(model, "__OUT_DIMS__", dimsToString(outDims(p, pad)));
+        REPLACE_WITH_NUM(model, "_GC_", p.group);
+        REPLACE_WITH_NUM(model, "_K_", p.kernel);
+        REPLACE_WITH_NUM(model, "_P_", pad);
+        REPLACE_WITH_NUM(model, "_OC_", p.out_c);
+        REPLACE_WITH_NUM(model, "_WS_", weightsSize(p) * sizeof(float));
+        std::string biases = "\n                <biases offset=\"" + std::to_string(weightsSize(p) * sizeof(float)) +
+                             "\" size=\"" + std::to_string(p.out_c * sizeof(float)) + "\"/>";
+        REPLACE_WITH_STR(model, "__BIASES__", withBiases ? biases : "");
+
+        return IRTemplateGenerator::getIRTemplate("Asymmetric_Input", p.in, "FP32", model, edges_t);
+    }
+
+    // the weights are followed by the biases
+    static TBlob<uint8_t>::Ptr makeWeights(const std::vector<float>& values) {
+        auto weights = make_shared_blob<uint8_t>({Precision::U8, {values.size() * sizeof(float)}, Layout::C});
+        weights->allocate();
+        std::copy(values.begin(), values.end(), weights->buffer().as<float *>());
+        return weights;
+    }
+
+    static NetworkNodeStatsPtr makeStats(const std::vector<float>& mins, const std::vector<float>& maxs) {
+        auto stats = std::make_shared<NetworkNodeStats>();
+        stats->_minOutputs = mins;
+        stats->_maxOutputs = maxs;
+        return stats;
+    }
+
+    static std::vector<float> blobValues(const Blob::Ptr& blob) {
+        const float *data = blob->buffer().as<const float *>();
+        return std::vector<float>(data, data + blob->size());
+    }
+};
+
+TEST_F(NormalizationAsymmetricInputTests, ScaleAndZeroPointMapChannelRangeToU8) {
+    asymmetric_input_params p = {"FullyConnected", {1, 4}, 3, 1, 1};
+    std::string model = getModel(p);
+    CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+    net_reader.SetWeights(makeWeights(std::vector<float>(weightsSize(p) + p.out_c, 0.5f)));
+    auto network = net_reader.getNetwork();
+
+    // the range is extended to zero, the channel of zeros keeps the scale 1
+    NetworkStatsMap stats;
+    stats["in1"] = makeStats({-1.f, -2.f, 0.5f, 0.f}, {3.f, 0.f, 2.f, 0.f});
+    stats["layer"] = makeStats({-1.f, -1.f, -1.f}, {1.f, 1.f, 1.f});
+    CNNStatisticHelper statHelper(network, stats, 127, 255);
+
+    Blob::Ptr zeroPoint;
+    Blob::Ptr scale = statHelper.getAsymmetricInputScale(network.getLayerByName("layer"), zeroPoint);
+    ASSERT_NE(nullptr, scale);
+    ASSERT_NE(nullptr, zeroPoint);
+
+    std::vector<float> refScale = {4.f / 255, 2.f / 255, 2.f / 255, 1.f};
+    std::vector<float> refZeroPoint = {64.f, 255.f, 0.f, 0.f};
+    ASSERT_EQ(refScale.size(), scale->size());
+    ASSERT_EQ(refZeroPoint.size(), zeroPoint->size());
+    for (size_t c = 0; c < refScale.size(); c++) {
+        ASSERT_FLOAT_EQ(refScale[c], blobValues(scale)[c]) << "channel " << c;
+        ASSERT_FLOAT_EQ(refZeroPoint[c], blobValues(zeroPoint)[c]) << "channel " << c;
+    }
+}
+
+TEST_F(NormalizationAsymmetricInputTests, ScaleOfConvolutionInputIsTensorWide) {
+    asymmetric_input_params p = {"Convolution", {1, 4, 3, 3}, 2, 1, 1};
+    std::string model = getModel(p);
+    CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+    net_reader.SetWeights(makeWeights(std::vector<float>(weightsSize(p) + p.out_c, 0.5f)));
+    auto network = net_reader.getNetwork();
+
+    // the statistic of the input of a regular convolution is merged over channels: [-2, 3]
+    NetworkStatsMap stats;
+    stats["in1"] = makeStats({-1.f, -2.f, 0.5f, 0.f}, {3.f, 0.f, 2.f, 0.f});
+    stats["layer"] = makeStats({-1.f, -1.f}, {1.f, 1.f});
+    CNNStatisticHelper statHelper(network, stats, 127, 255);
+
+    Blob::Ptr zeroPoint;
+    Blob::Ptr scale = statHelper.getAsymmetricInputScale(network.getLayerByName("layer"), zeroPoint);
+    for (size_t c = 0; c < 4; c++) {
+        ASSERT_FLOAT_EQ(5.f / 255, blobValues(scale)[c]) << "channel " << c;
+        ASSERT_FLOAT_EQ(102.f, blobValues(zeroPoint)[c]) << "channel " << c;
+    }
+}
+
+TEST_F(NormalizationAsymmetricInputTests, ScaleThrowsOnStatisticOfWrongSize) {
+    asymmetric_input_params p = {"FullyConnected", {1, 4}, 3, 1, 1};
+    std::string model = getModel(p);
+    CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+    net_reader.SetWeights(makeWeights(std::vector<float>(weightsSize(p) + p.out_c, 0.5f)));
+    auto network = net_reader.getNetwork();
+
+    NetworkStatsMap stats;
+    stats["in1"] = makeStats({-1.f, -2.f, 0.5f}, {3.f, 0.f, 2.f});
+    stats["layer"] = makeStats({-1.f, -1.f, -1.f}, {1.f, 1.f, 1.f});
+    CNNStatisticHelper statHelper(network, stats, 127, 255);
+
+    Blob::Ptr zeroPoint;
+    ASSERT_THROW(statHelper.getAsymmetricInputScale(network.getLayerByName("layer"), zeroPoint),
+                 InferenceEngineException);
+}
+
+TEST_F(NormalizationAsymmetricInputTests, AsymmetricInputIsAllowedForFP32InputWithNegativeValues) {
+    struct Case {
+        asymmetric_input_params p;
+        size_t pad;
+        bool withBiases;
+        Precision inputPrecision;
+        float inputMin;
+        bool allowed;
+    };
+    std::vector<Case> cases = {
+        {{"FullyConnected", {1, 4}, 3, 1, 1}, 0, true, Precision::FP32, -1.f, true},
+        {{"Convolution", {1, 4, 5, 5}, 6, 2, 3}, 0, true, Precision::FP32, -1.f, true},
+        // u8 data of the non-negative input needs no zero-points
+        {{"FullyConnected", {1, 4}, 3, 1, 1}, 0, true, Precision::FP32, 0.f, false},
+        // the compensation of zero-points is added to the biases
+        {{"FullyConnected", {1, 4}, 3, 1, 1}, 0, false, Precision::FP32, -1.f, false},
+        // the padded values would be zero-points after the shift
+        {{"Convolution", {1, 4, 5, 5}, 6, 2, 3}, 1, true, Precision::FP32, -1.f, false},
+        // only FP32 data is quantized by the inserted ScaleShift
+        {{"FullyConnected", {1, 4}, 3, 1, 1}, 0, true, Precision::I8, -1.f, false},
+    };
+
+    for (size_t i = 0; i < cases.size(); i++) {
+        const Case& test = cases[i];
+        std::string model = getModel(test.p, test.pad, test.withBiases);
+        CNNNetReader net_reader;
+        ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+        net_reader.SetWeights(makeWeights(std::vector<float>(weightsSize(test.p) + test.p.out_c, 0.5f)));
+        auto network = net_reader.getNetwork();
+        network.getLayerByName("in1")->precision = test.inputPrecision;
+
+        NetworkStatsMap stats;
+        stats["in1"] = makeStats(std::vector<float>(test.p.in[1], test.inputMin), std::vector<float>(test.p.in[1], 1.f));
+        stats["layer"] = makeStats(std::vector<float>(test.p.out_c, -1.f), std::vector<float>(test.p.out_c, 1.f));
+        CNNStatisticHelper statHelper(network, stats, 127, 255);
+
+        ASSERT_EQ(test.allowed, Int8Normalizer::isAsymmetricInputAllowed(network.getLayerByName("layer"), statHelper))
+            << "case " << i;
+    }
+}
+
+TEST_F(NormalizationAsymmetricInputTests, FullyConnectedPassesInt8DataToFullyConnected) {
+    std::string layers = R"V0G0N(
+        <layer id="1" name="fc_1" precision="FP32" type="FullyConnected">
+            <data out-size="6"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>6</dim>
+                </port>
+            </output>
+            <blobs>
+                <weights offset="0" size="96"/>
+                <biases offset="96" size="24"/>
+            </blobs>
+        </layer>
+        <layer id="2" name="fc_2" precision="FP32" type="FullyConnected">
+            <data out-size="3"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>6</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+            <blobs>
+                <weights offset="120" size="72"/>
+                <biases offset="192" size="12"/>
+            </blobs>
+        </layer>
+)V0G0N";
+    std::string edges = R"V0G0N(
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="0"/>
+)V0G0N";
+    std::string model = IRTemplateGenerator::getIRTemplate("FC_FC", {1, 4}, "FP32", layers, edges);
+    CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+    net_reader.SetWeights(makeWeights(std::vector<float>(51, 0.5f)));
+    auto network = net_reader.getNetwork();
+
+    NetworkStatsMap stats;
+    stats["in1"] = makeStats(std::vector<float>(4, -1.f), std::vector<float>(4, 1.f));
+    stats["fc_1"] = makeStats(std::vector<float>(6, 0.f), std::vector<float>(6, 2.f));
+    stats["fc_2"] = makeStats(std::vector<float>(3, -1.f), std::vector<float>(3, 1.f));
+    CNNStatisticHelper statHelper(network, stats, 127, 255);
+
+    auto fc1 = network.getLayerByName("fc_1");
+    auto fc2 = network.getLayerByName("fc_2");
+    fc1->precision = Precision::I8;
+    fc2->precision = Precision::I8;
+    fc1->outData[0]->setPrecision(Precision::U8);
+    Int8Normalizer::QuantizeConvolutionOrFullyConnected(fc1, statHelper);
+    Int8Normalizer::QuantizeConvolutionOrFullyConnected(fc2, statHelper);
+    ASSERT_EQ(1, fc1->blobs.count("o-scale"));
+    ASSERT_EQ(1, fc2->blobs.count("i-scale"));
+
+    Int8Normalizer::PropagateScaleFactors(network, statHelper);
+
+    // the output of the first layer is requantized by the layer itself rather than by a ScaleShift
+    ASSERT_EQ(0, fc2->blobs.count("i-scale"));
+    ASSERT_EQ(1, fc1->blobs.count("oi-scale"));
+    ASSERT_EQ(0, fc1->blobs.count("o-scale"));
+    ASSERT_EQ(Precision::U8, fc1->outData[0]->getPrecision());
+}
+
+// The u8 input of the quantized layer is shifted by zero-points, the result must agree with FP32
+class NormalizationAsymmetricInputNumericTests: public NormalizationAsymmetricInputTests,
+                                                public WithParamInterface<asymmetric_input_params> {
+protected:
+    // the reference: convolution without paddings with stride 1, fully connected is the case of 1x1 input
+    static std::vector<float> reference(const asymmetric_input_params& p, const std::vector<float>& src,
+                                        const std::vector<float>& weights, const std::vector<float>& biases,
+                                        const std::vector<int>& zeroPoints = {}) {
+        size_t IC = p.in[1], OC = p.out_c, G = p.group, K = p.kernel;
+        size_t IH = p.in.size() == 4 ? p.in[2] : 1, IW = p.in.size() == 4 ? p.in[3] : 1;
+        size_t OH = IH - K + 1, OW = IW - K + 1;
+        std::vector<float> dst(OC * OH * OW);
+        for (size_t g = 0; g < G; g++) {
+            for (size_t oc = 0; oc < OC / G; oc++) {
+                for (size_t oh = 0; oh < OH; oh++) {
+                    for (size_t ow = 0; ow < OW; ow++) {
+                        float sum = biases[g * OC / G + oc];
+                        for (size_t ic = 0; ic < IC / G; ic++) {
+                            size_t c = g * IC / G + ic;
+                            for (size_t kh = 0; kh < K; kh++) {
+                                for (size_t kw = 0; kw < K; kw++) {
+                                    float w = weights[((g * OC / G + oc) * IC / G + ic) * K * K + kh * K + kw];
+                                    sum += w * src[(c * IH + oh + kh) * IW + ow + kw];
+                                }
+                            }
+                        }
+                        dst[((g * OC / G + oc) * OH + oh) * OW + ow] = sum;
+                    }
+                }
+            }
+        }
+        return dst;
+    }
+};
+
+TEST_P(NormalizationAsymmetricInputNumericTests, TestsAsymmetricInput) {
+    asymmetric_input_params p = GetParam();
+    size_t IC = p.in[1], OC = p.out_c;
+    size_t spatial = p.in.size() == 4 ? p.in[2] * p.in[3] : 1;
+
+    // every channel has its own range, all of them contain negative values
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<float> dist(0.f, 1.f);
+    std::vector<float> src(IC * spatial);
+    for (size_t c = 0; c < IC; c++)
+        for (size_t i = 0; i < spatial; i++)
+            src[c * spatial + i] = -0.5f - 0.25f * c + (1.5f + 0.75f * c) * dist(gen);
+    std::vector<float> weights(weightsSize(p)), biases(OC);
+    for (auto& w : weights) w = 2.f * dist(gen) - 1.f;
+    for (auto& b : biases) b = 2.f * dist(gen) - 1.f;
+    std::vector<float> ref = reference(p, src, weights, biases);
+    size_t outSpatial = ref.size() / OC;
+
+    std::string model = getModel(p);
+    CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+    std::vector<float> weightsAndBiases = weights;
+    weightsAndBiases.insert(weightsAndBiases.end(), biases.begin(), biases.end());
+    net_reader.SetWeights(makeWeights(weightsAndBiases));
+    auto network = net_reader.getNetwork();
+
+    NetworkStatsMap stats;
+    stats["in1"] = makeStats(std::vector<float>(IC, FLT_MAX), std::vector<float>(IC, -FLT_MAX));
+    for (size_t c = 0; c < IC; c++) {
+        for (size_t i = 0; i < spatial; i++) {
+            stats["in1"]->_minOutputs[c] = std::min(stats["in1"]->_minOutputs[c], src[c * spatial + i]);
+            stats["in1"]->_maxOutputs[c] = std::max(stats["in1"]->_maxOutputs[c], src[c * spatial + i]);
+        }
+    }
+    stats["layer"] = makeStats(std::vector<float>(OC, FLT_MAX), std::vector<float>(OC, -FLT_MAX));
+    for (size_t oc = 0; oc < OC; oc++) {
+        for (size_t i = 0; i < outSpatial; i++) {
+            stats["layer"]->_minOutputs[oc] = std::min(stats["layer"]->_minOutputs[oc], ref[oc * outSpatial + i]);
+            stats["layer"]->_maxOutputs[oc] = std::max(stats["layer"]->_maxOutputs[oc], ref[oc * outSpatial + i]);
+        }
+    }
+    CNNStatisticHelper statHelper(network, stats, 127, 255);
+
+    auto in = network.getLayerByName("in1");
+    auto layer = network.getLayerByName("layer");
+    layer->precision = Precision::I8;
+    ASSERT_TRUE(Int8Normalizer::isAsymmetricInputAllowed(layer, statHelper));
+    Int8Normalizer::QuantizeConvolutionOrFullyConnected(layer, statHelper);
+
+    ASSERT_EQ(1, layer->blobs.count("i-zero-point"));
+    ASSERT_EQ(Precision::I8, layer->blobs["weights"]->getTensorDesc().getPrecision());
+    ASSERT_EQ(Precision::I32, layer->blobs["biases"]->getTensorDesc().getPrecision());
+    std::vector<float> iScale = blobValues(layer->blobs["i-scale"]);
+    std::vector<float> zeroPoint = blobValues(layer->blobs["i-zero-point"]);
+    std::vector<float> wScale = blobValues(layer->blobs["w-scale"]);
+    ASSERT_EQ(IC, zeroPoint.size());
+    const int8_t *int8weights = layer->blobs["weights"]->buffer().as<const int8_t *>();
+    const int32_t *int32biases = layer->blobs["biases"]->buffer().as<const int32_t *>();
+
+    // the ScaleShift before the layer converts FP32 data to u8 shifted by zero-points
+    Int8Normalizer::AddScaleShiftBetween(network, in, layer, statHelper);
+    auto scaleShift = std::dynamic_pointer_cast<ScaleShiftLayer>(layer->insData[0].lock()->creatorLayer.lock());
+    ASSERT_NE(nullptr, scaleShift);
+    ASSERT_EQ(Precision::U8, scaleShift->outData[0]->getPrecision());
+    std::vector<float> ssWeights = blobValues(scaleShift->_weights);
+    std::vector<float> ssBiases = blobValues(scaleShift->_biases);
+    for (size_t c = 0; c < IC; c++) {
+        ASSERT_FLOAT_EQ(1.f / iScale[c], ssWeights[c]) << "channel " << c;
+        ASSERT_FLOAT_EQ(zeroPoint[c], ssBiases[c]) << "channel " << c;
+    }
+
+    std::vector<float> u8src(src.size());
+    for (size_t c = 0; c < IC; c++) {
+        for (size_t i = 0; i < spatial; i++) {
+            float value = std::round(src[c * spatial + i] * ssWeights[c] + ssBiases[c]);
+            u8src[c * spatial + i] = std::min(std::max(value, 0.f), 255.f);
+        }
+    }
+
+    // the int32 biases compensate the shift of zero-points through the int8 weights
+    std::vector<float> int8WeightValues(int8weights, int8weights + weights.size());
+    std::vector<float> zeroPointData(src.size());
+    for (size_t c = 0; c < IC; c++)
+        std::fill(zeroPointData.begin() + c * spatial, zeroPointData.begin() + (c + 1) * spatial, zeroPoint[c]);
+    std::vector<float> shift = reference(p, zeroPointData, int8WeightValues, std::vector<float>(OC, 0.f));
+    for (size_t oc = 0; oc < OC; oc++) {
+        float restored = (int32biases[oc] + shift[oc * outSpatial]) * wScale[oc];
+        ASSERT_NEAR(biases[oc], restored, wScale[oc]) << "output channel " << oc;
+    }
+
+    std::vector<float> int32BiasValues(int32biases, int32biases + OC);
+    std::vector<float> acc = reference(p, u8src, int8WeightValues, int32BiasValues);
+    float maxAbs = 0.f;
+    for (auto value : ref) maxAbs = std::max(maxAbs, std::fabs(value));
+    for (size_t oc = 0; oc < OC; oc++) {
+        for (size_t i = 0; i < outSpatial; i++) {
+            ASSERT_NEAR(ref[oc * outSpatial + i], acc[oc * outSpatial + i] * wScale[oc], 0.03f * maxAbs)
+                << "output channel " << oc << " point " << i;
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsAsymmetricInput, NormalizationAsymmetricInputNumericTests,
+        ::testing::Values(
+                asymmetric_input_params{"Convolution", {1, 4, 6, 6}, 8, 1, 3},
+                asymmetric_input_params{"Convolution", {1, 8, 5, 5}, 6, 2, 3},
+                asymmetric_input_params{"Convolution", {1, 6, 4, 4}, 6, 6, 1},
+                asymmetric_input_params{"FullyConnected", {1, 16}, 5, 1, 1}
+        ));
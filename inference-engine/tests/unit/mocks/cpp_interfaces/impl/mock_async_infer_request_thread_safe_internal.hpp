@@ -50,4 +50,6 @@ public:
 
 	MOCK_METHOD1(SetBatch, void(int));
 	MOCK_METHOD1(SetBatch_ThreadUnsafe, void(int));
+	MOCK_METHOD1(SetSequences, void(const std::vector<size_t>&));
+	MOCK_METHOD1(SetSequences_ThreadUnsafe, void(const std::vector<size_t>&));
 };
@@ -28,5 +28,7 @@ public:
     MOCK_METHOD1(Export, void(const std::string &));
     MOCK_METHOD1(GetMappedTopology, void(std::map<std::string, std::vector<PrimitiveInfo::Ptr>> &));
     MOCK_METHOD0(QueryState, std::vector<IMemoryStateInternal::Ptr>());
+    MOCK_METHOD1(ReleaseSequence, void(size_t));
+    MOCK_METHOD2(GetMetrics, void(ExecutableNetworkMetrics &, bool));
     MOCK_METHOD1(GetExecGraphInfo, void(ICNNNetwork::Ptr &));
 };
@@ -19,7 +19,6 @@
 #include "c_types_map.hpp"
 #include "type_helpers.hpp"
 #include "utils.hpp"
-#include "cpu/gemm/os_blas.hpp"
 
 using namespace mkldnn::impl;
 using namespace mkldnn::impl::status;
@@ -122,7 +121,6 @@ status_t check_data_type_consistency_fwd(const rnn_cell_desc_t *rnn_cell_desc,
                           dst_iter_desc->data_type == f32)
             && IMPLICATION(!is_zero_md(bias_desc), bias_desc->data_type == f32);
 
-#if USE_MKL_PACKED_GEMM
     bool is_u8u8u8 = src_layer_dt == u8
             && IMPLICATION(!is_zero_md(src_iter_desc),
                              src_iter_desc->data_type == u8)
@@ -147,9 +145,6 @@ status_t check_data_type_consistency_fwd(const rnn_cell_desc_t *rnn_cell_desc,
     return (is_f32 || ((is_u8u8u8 || is_f32u8f32) && is_lstm && is_inference))
             ? success
             : unimplemented;
-#else
-    return is_f32 ? success : unimplemented;
-#endif
 }
 
 status_t check_dim_consistency(const rnn_cell_desc_t *rnn_cell_desc,
@@ -113,19 +113,13 @@ rnn_gemm_sig((ref_rnn_fwd_u8s8_t::packed_gemm)) {
             CblasNoTrans, CblasFixOffset, m, n, k, alpha, a_, ldA, offseta, b_,
             ldB, offsetb, beta, c_, ldC, &offsetc);
 #else
-    UNUSED(transA);
-    UNUSED(transB);
-    UNUSED(m);
-    UNUSED(n);
-    UNUSED(k);
-    UNUSED(alpha);
+    /* The part is stored as plain column major s8 matrix of m x k */
     UNUSED(ldA);
-    UNUSED(b_);
-    UNUSED(ldB);
-    UNUSED(beta);
-    UNUSED(c_);
-    UNUSED(ldC);
-    assert(!"packed gemm is disabled");
+    int8_t offseta = 0, offsetb = 0;
+    int32_t offsetc = 0;
+    int lda = m;
+    mkldnn_gemm_s8u8s32(&transA, &transB, "F", &m, &n, &k, &alpha, a_,
+            &lda, &offseta, b_, &ldB, &offsetb, &beta, c_, &ldC, &offsetc);
 #endif
 }
 
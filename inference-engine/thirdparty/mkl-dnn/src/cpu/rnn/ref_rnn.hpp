@@ -93,6 +93,9 @@ struct _ref_rnn_common_t : public cpu_primitive_t {
                     && IMPLICATION(aprop == backward,
                                one_of(this->desc()->prop_kind, backward))
                     && src_layer_dt == src_type
+                    /* the int8 post gemm is implemented for lstm only */
+                    && IMPLICATION(src_type == data_type::u8,
+                               cell_kind == alg_kind::vanilla_lstm)
                     && everyone_is(
                                weights_type, weights_iter_dt, weights_layer_dt)
                     && this->set_default_params() == status::success
@@ -104,9 +104,6 @@ struct rnn_weights_reorder_t : public cpu_primitive_t {
         static status_t create(reorder_pd_t **reorder_pd,
                 const memory_pd_t *input_pd, const memory_pd_t *output_pd,
                 const primitive_attr_t *attr) {
-#if !USE_MKL_PACKED_GEMM
-            return status::unimplemented;
-#endif
             using namespace memory_format;
             assert(input_pd->engine()->kind() == engine_kind::cpu);
             assert(output_pd->engine()->kind() == engine_kind::cpu);
@@ -117,6 +114,10 @@ struct rnn_weights_reorder_t : public cpu_primitive_t {
                     && id.data_type() == type_i
                     && od.data_type() == type_o
                     && utils::one_of(id.format(), ldigo, ldgoi)
+#if !USE_MKL_PACKED_GEMM
+                    /* plain s8 parts keep the ldigo order of the input */
+                    && id.format() == ldigo
+#endif
                     && od.format() == rnn_packed
                     && od.rnn_packed_desc().format
                             == mkldnn_ldigo_p
@@ -171,7 +172,6 @@ private:
         : cpu_primitive_t(apd, inputs, outputs) {}
 
     virtual void execute(event_t *e) const {
-#if USE_MKL_PACKED_GEMM
         auto input = reinterpret_cast<const in_data_t *>(input_memory(0));
         auto output = reinterpret_cast<char *>(memory());
         const memory_desc_wrapper &input_d = pd()->input_pd();
@@ -251,6 +251,7 @@ private:
             });
         }
 
+#if USE_MKL_PACKED_GEMM
         /* Pack */
         auto off_igo = [&](int l, int d, int i, int g, int o) {
             return l * D * I * G * O + d * I * G * O + i * G * O + g * O + o;
@@ -279,6 +280,14 @@ private:
                 }
             }
         }
+#else
+        /* The only part of every layer and direction is the plain m x k
+         * matrix, so the quantized ldigo data is copied as is */
+        const size_t part_size = output_d.rnn_packed_desc().part_pack_size[0];
+        parallel_nd(L * D, [&](int ld) {
+            utils::array_copy((int8_t *)(output + ld * part_size),
+                    &quantized[ld * I * G * O], I * G * O);
+        });
 #endif
         e->set_state(event_t::ready);
     }
@@ -123,8 +123,11 @@ void rnn_utils::init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
                                        && rnn.dic > 760 && is_inference)
             || is_int8;
 #else
-    rnn.use_layer_packed_gemm = false;
-    rnn.use_iter_packed_gemm = false;
+    /* Without Intel(R) MKL packed gemm the int8 weights are kept in the
+     * packed container as plain s8 ldigo followed by the compensation and
+     * multiplied by the igemm */
+    rnn.use_layer_packed_gemm = is_int8;
+    rnn.use_iter_packed_gemm = is_int8;
 #endif
 
     /* Set packed gemm sizes */
@@ -148,10 +151,9 @@ void rnn_utils::init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
                         = cblas_gemm_s8u8s32_pack_get_size(
                                 CblasAMatrix, m_p, n_p, k_p);
 #else
-            UNUSED(m_p);
-            UNUSED(k_p);
             UNUSED(n_p);
-            rnn.part_weights_layer_pack_size[p] = 0;
+            rnn.part_weights_layer_pack_size[p] = utils::rnd_up(
+                    (size_t)m_p * k_p * sizeof(int8_t), sizeof(float));
 #endif
             rnn.weights_layer_pack_size += rnn.n_layer * rnn.n_dir
                     * rnn.part_weights_layer_pack_size[p];
@@ -179,10 +181,9 @@ void rnn_utils::init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
                         = cblas_gemm_s8u8s32_pack_get_size(
                                 CblasAMatrix, m_p, n_p, k_p);
 #else
-            UNUSED(m_p);
-            UNUSED(k_p);
             UNUSED(n_p);
-            rnn.part_weights_iter_pack_size[p] = 0;
+            rnn.part_weights_iter_pack_size[p] = utils::rnd_up(
+                    (size_t)m_p * k_p * sizeof(int8_t), sizeof(float));
 #endif
             rnn.weights_iter_pack_size += rnn.n_layer * rnn.n_dir
                     * rnn.part_weights_iter_pack_size[p];
@@ -16,6 +16,8 @@
 
 #include <utility>
 #include <numeric>
+#include <cmath>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "mkldnn_test_common.hpp"
@@ -210,6 +212,127 @@ protected:
     }
 };
 
+// Runs the int8 configuration (u8 data, s8 weights, f32 states) on the data
+// quantized from the f32 one and compares the outputs with the f32 primitive.
+// The difference is bounded by the quantization errors of the data and weights.
+class rnn_forward_test_u8s8
+    : public ::testing::TestWithParam<test_rnn_params_t> {
+protected:
+    virtual void SetUp() {
+        auto p = ::testing::TestWithParam<test_rnn_params_t>::GetParam();
+        catch_expected_failures([=](){Test();}, p.expect_to_fail,
+                p.expected_status, false);
+    }
+
+    void Test() {
+        auto p = ::testing::TestWithParam<test_rnn_params_t>::GetParam();
+        ASSERT_TRUE(p.engine_kind == engine::kind::cpu);
+        auto eng = engine(p.engine_kind, 0);
+
+        auto dims = p.sizes;
+        auto t = dims.t, mb = dims.mb, l = dims.l, d = dims.d;
+        auto slc = dims.slc, sic = dims.sic, dlc = dims.dlc, dic = dims.dic;
+        int g = p.aalgorithm == vanilla_lstm ? 4 : 3;
+        int s = p.aalgorithm == vanilla_lstm ? 2 : 1;
+
+        const auto f32 = memory::data_type::f32;
+        auto weights_layer_md = memory::desc({l, d, slc, g, dic}, f32, p.fmts.weights_layer_fmt);
+        auto weights_iter_md = memory::desc({l, d, sic, g, dic}, f32, p.fmts.weights_iter_fmt);
+        auto bias_md = memory::desc({l, d, g, dic}, f32, p.fmts.bias_fmt);
+        auto src_layer_md = memory::desc({t, mb, slc}, f32, p.fmts.src_layer_fmt);
+        auto src_iter_md = memory::desc({l, d, s, mb, sic}, f32, p.fmts.src_iter_fmt);
+        auto dst_layer_md = memory::desc({t, mb, dlc}, f32, p.fmts.dst_layer_fmt);
+        auto dst_iter_md = memory::desc({l, d, s, mb, dic}, f32, p.fmts.dst_iter_fmt);
+
+        auto weights_layer = memory({weights_layer_md, eng});
+        auto weights_iter = memory({weights_iter_md, eng});
+        auto bias = memory({bias_md, eng});
+        auto src_layer = memory({src_layer_md, eng});
+        auto src_iter = memory({src_iter_md, eng});
+
+        auto fill = [](memory m, float amplitude, float phase) {
+            auto ptr = static_cast<float *>(m.get_data_handle());
+            size_t n_elems = m.get_primitive_desc().get_size() / sizeof(float);
+            for (size_t i = 0; i < n_elems; i++)
+                ptr[i] = amplitude * sinf(0.37f * i + phase);
+        };
+        // the data and the states lie in [-1, 1] as the hidden state does
+        fill(src_layer, 1.f, 0.f);
+        fill(src_iter, 0.9f, 0.5f);
+        fill(weights_layer, 0.5f, 1.f);
+        fill(weights_iter, 0.3f, 2.f);
+        fill(bias, 0.2f, 3.f);
+
+        // u8 = data * scale + shift, the weights are quantized per output channel
+        const float data_scale = 127.f, data_shift = 128.f;
+        const int oc = g * dic;
+        std::vector<float> weights_scales(oc, 0.f);
+        auto w_layer = static_cast<const float *>(weights_layer.get_data_handle());
+        auto w_iter = static_cast<const float *>(weights_iter.get_data_handle());
+        for (int i = 0; i < l * d * slc; i++)
+            for (int o = 0; o < oc; o++)
+                weights_scales[o] = std::max(weights_scales[o], std::fabs(w_layer[i * oc + o]));
+        for (int i = 0; i < l * d * sic; i++)
+            for (int o = 0; o < oc; o++)
+                weights_scales[o] = std::max(weights_scales[o], std::fabs(w_iter[i * oc + o]));
+        for (auto &scale : weights_scales)
+            scale = 127.f / scale;
+
+        primitive_attr attr;
+        attr.set_int_output_round_mode(round_mode::round_nearest);
+        attr.set_rnn_data_qparams(data_scale, data_shift);
+        attr.set_rnn_weights_qparams(0x3, weights_scales);
+
+        rnn_cell::desc cell(p.aalgorithm, p.activation);
+
+        rnn_forward::desc ref_desc(prop_kind::forward_inference, cell,
+                p.direction, src_layer_md, src_iter_md, weights_layer_md,
+                weights_iter_md, bias_md, dst_layer_md, dst_iter_md);
+        auto ref_prim_desc = rnn_forward::primitive_desc(ref_desc, eng);
+        auto dst_layer_ref = memory({dst_layer_md, eng});
+        auto dst_iter_ref = memory({dst_iter_md, eng});
+        stream(stream::kind::eager).submit({rnn_forward(ref_prim_desc,
+                src_layer, src_iter, weights_layer, weights_iter, bias,
+                dst_layer_ref, dst_iter_ref, null_memory(eng))}).wait();
+
+        auto q_src_layer_md = memory::desc({t, mb, slc}, memory::data_type::u8, p.fmts.src_layer_fmt);
+        auto q_weights_layer_md = memory::desc({l, d, slc, g, dic}, memory::data_type::s8, memory::format::any);
+        auto q_weights_iter_md = memory::desc({l, d, sic, g, dic}, memory::data_type::s8, memory::format::any);
+        rnn_forward::desc q_desc(prop_kind::forward_inference, cell,
+                p.direction, q_src_layer_md, src_iter_md, q_weights_layer_md,
+                q_weights_iter_md, bias_md, dst_layer_md, dst_iter_md);
+        auto q_prim_desc = rnn_forward::primitive_desc(q_desc, attr, eng);
+
+        auto q_src_layer = memory(q_prim_desc.src_layer_primitive_desc());
+        auto q_weights_layer = memory(q_prim_desc.weights_layer_primitive_desc());
+        auto q_weights_iter = memory(q_prim_desc.weights_iter_primitive_desc());
+        auto quantize = [&](memory from, memory to) {
+            auto rpd = reorder::primitive_desc(from.get_primitive_desc(),
+                    to.get_primitive_desc(), attr);
+            stream(stream::kind::eager).submit({reorder(rpd, from, to)}).wait();
+        };
+        quantize(src_layer, q_src_layer);
+        quantize(weights_layer, q_weights_layer);
+        quantize(weights_iter, q_weights_iter);
+
+        auto dst_layer = memory({dst_layer_md, eng});
+        auto dst_iter = memory({dst_iter_md, eng});
+        stream(stream::kind::eager).submit({rnn_forward(q_prim_desc,
+                q_src_layer, src_iter, q_weights_layer, q_weights_iter, bias,
+                dst_layer, dst_iter, null_memory(eng))}).wait();
+
+        auto compare = [](memory ref, memory got, float threshold) {
+            auto ref_ptr = static_cast<const float *>(ref.get_data_handle());
+            auto got_ptr = static_cast<const float *>(got.get_data_handle());
+            size_t n_elems = ref.get_primitive_desc().get_size() / sizeof(float);
+            for (size_t i = 0; i < n_elems; i++)
+                EXPECT_NEAR(ref_ptr[i], got_ptr[i], threshold) << "Index: " << i;
+        };
+        compare(dst_layer_ref, dst_layer, 0.05f);
+        compare(dst_iter_ref, dst_iter, 0.05f);
+    }
+};
+
     using eng = engine::kind;
     using fmt = memory::format;
     using alg = algorithm;
@@ -240,4 +363,23 @@ INSTANTIATE_TEST_CASE_P(TestRnn, rnn_forward_test_f32,
             )
     );
 
+TEST_P(rnn_forward_test_u8s8, TestsRnn) { }
+INSTANTIATE_TEST_CASE_P(TestRnn, rnn_forward_test_u8s8,
+        ::testing::Values(
+            cfg_f32{eng::cpu, alg::vanilla_lstm, alg::eltwise_tanh, dir::unidirectional_left2right,
+                {fmt::tnc, fmt::ldsnc, fmt::ldigo, fmt::ldigo, fmt::ldgo, fmt::tnc, fmt::ldsnc},
+                    test_rnn_sizes_t(1, 1, 1, 1, 16, 16, 16, 16)},
+            cfg_f32{eng::cpu, alg::vanilla_lstm, alg::eltwise_tanh, dir::unidirectional_left2right,
+                {fmt::tnc, fmt::ldsnc, fmt::ldigo, fmt::ldigo, fmt::ldgo, fmt::tnc, fmt::ldsnc},
+                    test_rnn_sizes_t(1, 1, 10, 16, 100, 100, 100, 100)},
+            cfg_f32{eng::cpu, alg::vanilla_lstm, alg::eltwise_tanh, dir::unidirectional_left2right,
+                {fmt::tnc, fmt::ldsnc, fmt::ldigo, fmt::ldigo, fmt::ldgo, fmt::tnc, fmt::ldsnc},
+                    test_rnn_sizes_t(1, 1, 5, 3, 40, 24, 24, 24)},
+            /* int8 is implemented for lstm only */
+            cfg_f32{eng::cpu, alg::vanilla_gru, alg::eltwise_tanh, dir::unidirectional_left2right,
+                {fmt::tnc, fmt::ldsnc, fmt::ldigo, fmt::ldigo, fmt::ldgo, fmt::tnc, fmt::ldsnc},
+                    test_rnn_sizes_t(1, 1, 10, 16, 100, 100, 100, 100), true, mkldnn_unimplemented}
+            )
+    );
+
 }